@@ -21,16 +21,19 @@
 #include "arrow/compute/context.h"  // IWYU pragma: export
 #include "arrow/compute/kernel.h"   // IWYU pragma: export
 
-#include "arrow/compute/kernels/boolean.h"          // IWYU pragma: export
-#include "arrow/compute/kernels/cast.h"             // IWYU pragma: export
-#include "arrow/compute/kernels/compare.h"          // IWYU pragma: export
-#include "arrow/compute/kernels/count.h"            // IWYU pragma: export
-#include "arrow/compute/kernels/filter.h"           // IWYU pragma: export
-#include "arrow/compute/kernels/hash.h"             // IWYU pragma: export
-#include "arrow/compute/kernels/isin.h"             // IWYU pragma: export
-#include "arrow/compute/kernels/mean.h"             // IWYU pragma: export
-#include "arrow/compute/kernels/sort_to_indices.h"  // IWYU pragma: export
-#include "arrow/compute/kernels/sum.h"              // IWYU pragma: export
-#include "arrow/compute/kernels/take.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/approximate.h"       // IWYU pragma: export
+#include "arrow/compute/kernels/arithmetic.h"        // IWYU pragma: export
+#include "arrow/compute/kernels/boolean.h"           // IWYU pragma: export
+#include "arrow/compute/kernels/cast.h"              // IWYU pragma: export
+#include "arrow/compute/kernels/compare.h"           // IWYU pragma: export
+#include "arrow/compute/kernels/count.h"             // IWYU pragma: export
+#include "arrow/compute/kernels/filter.h"            // IWYU pragma: export
+#include "arrow/compute/kernels/hash.h"              // IWYU pragma: export
+#include "arrow/compute/kernels/isin.h"              // IWYU pragma: export
+#include "arrow/compute/kernels/mean.h"              // IWYU pragma: export
+#include "arrow/compute/kernels/sort_to_indices.h"   // IWYU pragma: export
+#include "arrow/compute/kernels/string_functions.h"  // IWYU pragma: export
+#include "arrow/compute/kernels/sum.h"               // IWYU pragma: export
+#include "arrow/compute/kernels/take.h"              // IWYU pragma: export
 
 #endif  // ARROW_COMPUTE_API_H
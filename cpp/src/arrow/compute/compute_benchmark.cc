@@ -26,6 +26,8 @@
 #include "arrow/testing/util.h"
 
 #include "arrow/compute/context.h"
+#include "arrow/compute/kernels/boolean.h"
+#include "arrow/compute/kernels/cast.h"
 #include "arrow/compute/kernels/hash.h"
 
 namespace arrow {
@@ -219,5 +221,111 @@ BENCHMARK(UniqueUInt8WithNulls)
     ->Args({kHashBenchmarkLength, 200})
     ->Unit(benchmark::kMicrosecond);
 
+constexpr int64_t kMorselBenchmarkLength = 1 << 24;
+
+// state.range(0) is the morsel length, or 0 to execute on the caller thread
+static void MakeMorselContext(benchmark::State& state, FunctionContext* ctx) {
+  if (state.range(0) > 0) {
+    ctx->set_use_threads(true);
+    ctx->set_morsel_length(state.range(0));
+  }
+}
+
+static void CastInt64ToInt32(benchmark::State& state) {
+  random::RandomArrayGenerator rand(0x5eed);
+  auto values =
+      rand.Int64(kMorselBenchmarkLength, -1000, 1000, /*null_probability=*/0.01);
+
+  FunctionContext ctx;
+  MakeMorselContext(state, &ctx);
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Cast(&ctx, Datum(values), int32(), CastOptions::Safe(), &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * kMorselBenchmarkLength * sizeof(int64_t));
+}
+
+static void InvertBoolean(benchmark::State& state) {
+  random::RandomArrayGenerator rand(0x5eed);
+  auto values = rand.Boolean(kMorselBenchmarkLength, 0.5, /*null_probability=*/0.01);
+
+  FunctionContext ctx;
+  MakeMorselContext(state, &ctx);
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Invert(&ctx, Datum(values), &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * kMorselBenchmarkLength / 8);
+}
+
+static void MorselSetArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t morsel_length : {0, 1 << 12, 1 << 15, 1 << 18}) {
+    bench->Arg(morsel_length);
+  }
+  bench->Unit(benchmark::kMicrosecond)->UseRealTime();
+}
+
+BENCHMARK(CastInt64ToInt32)->Apply(MorselSetArgs);
+BENCHMARK(InvertBoolean)->Apply(MorselSetArgs);
+
+constexpr int kChunkedHashBenchmarkChunks = 64;
+
+// state.range(0) is whether to hash the chunks in parallel
+template <typename Func, typename ParamType>
+void BenchChunkedHash(benchmark::State& state, Func&& func, const ParamType& params) {
+  std::shared_ptr<Array> arr;
+  params.GenerateTestData(kHashBenchmarkLength, 10 * 1 << 10, &arr);
+  ArrayVector chunks;
+  const int64_t chunk_length = kHashBenchmarkLength / kChunkedHashBenchmarkChunks;
+  for (int i = 0; i < kChunkedHashBenchmarkChunks; ++i) {
+    chunks.push_back(arr->Slice(i * chunk_length, chunk_length));
+  }
+  Datum values(std::make_shared<ChunkedArray>(chunks));
+
+  FunctionContext ctx;
+  ctx.set_use_threads(state.range(0) != 0);
+  for (auto _ : state) {
+    ABORT_NOT_OK(func(&ctx, values));
+  }
+  state.SetBytesProcessed(state.iterations() *
+                          params.GetBytesProcessed(kHashBenchmarkLength));
+}
+
+static Status ValueCountsChunked(FunctionContext* ctx, const Datum& values) {
+  std::shared_ptr<Array> out;
+  return ValueCounts(ctx, values, &out);
+}
+
+static Status DictionaryEncodeChunked(FunctionContext* ctx, const Datum& values) {
+  Datum out;
+  return DictionaryEncode(ctx, values, &out);
+}
+
+static void ValueCountsChunkedInt64(benchmark::State& state) {
+  BenchChunkedHash(state, ValueCountsChunked, HashParams<Int64Type>{0.05});
+}
+
+static void ValueCountsChunkedString10bytes(benchmark::State& state) {
+  BenchChunkedHash(state, ValueCountsChunked, HashParams<StringType>{0.05, 10});
+}
+
+static void DictionaryEncodeChunkedInt64(benchmark::State& state) {
+  BenchChunkedHash(state, DictionaryEncodeChunked, HashParams<Int64Type>{0.05});
+}
+
+static void DictionaryEncodeChunkedString10bytes(benchmark::State& state) {
+  BenchChunkedHash(state, DictionaryEncodeChunked, HashParams<StringType>{0.05, 10});
+}
+
+#define ADD_CHUNKED_HASH_ARGS(WHAT) \
+  WHAT->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond)->UseRealTime()
+
+ADD_CHUNKED_HASH_ARGS(BENCHMARK(ValueCountsChunkedInt64));
+ADD_CHUNKED_HASH_ARGS(BENCHMARK(ValueCountsChunkedString10bytes));
+ADD_CHUNKED_HASH_ARGS(BENCHMARK(DictionaryEncodeChunkedInt64));
+ADD_CHUNKED_HASH_ARGS(BENCHMARK(DictionaryEncodeChunkedString10bytes));
+
 }  // namespace compute
 }  // namespace arrow
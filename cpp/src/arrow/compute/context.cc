@@ -17,9 +17,11 @@
 
 #include "arrow/compute/context.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "arrow/buffer.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/cpu_info.h"
 
 namespace arrow {
@@ -44,5 +46,11 @@ void FunctionContext::SetStatus(const Status& status) {
 /// \brief Clear any error status
 void FunctionContext::ResetStatus() { status_ = Status::OK(); }
 
+constexpr int64_t FunctionContext::kDefaultMorselLength;
+
+void FunctionContext::set_morsel_length(int64_t morsel_length) {
+  morsel_length_ = BitUtil::RoundUpToMultipleOf64(std::max<int64_t>(morsel_length, 1));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -70,10 +70,34 @@ class ARROW_EXPORT FunctionContext {
 
   internal::CpuInfo* cpu_info() const { return cpu_info_; }
 
+  /// \brief Whether kernels which support it may split their input into morsels
+  /// and execute them on the CPU thread pool
+  ///
+  /// Defaults to false. Functions called from tasks already running on the CPU
+  /// thread pool should not enable this, since they would block a pool thread
+  /// while waiting for their morsels.
+  bool use_threads() const { return use_threads_; }
+
+  void set_use_threads(bool use_threads) { use_threads_ = use_threads; }
+
+  /// \brief The number of elements in each morsel of a parallel kernel execution
+  int64_t morsel_length() const { return morsel_length_; }
+
+  /// \brief Set the number of elements in each morsel
+  ///
+  /// Rounded up to a multiple of 64 so that morsels of bitmaps begin at byte
+  /// (and word) boundaries.
+  void set_morsel_length(int64_t morsel_length);
+
+  /// \brief By default a morsel of 8 byte values fills half of a typical L2 cache
+  static constexpr int64_t kDefaultMorselLength = 1 << 15;
+
  private:
   Status status_;
   MemoryPool* pool_;
   internal::CpuInfo* cpu_info_;
+  bool use_threads_ = false;
+  int64_t morsel_length_ = kDefaultMorselLength;
 };
 
 }  // namespace compute
@@ -15,50 +15,201 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include "arrow/compute/kernels/aggregate.h"
+
+#include <algorithm>
+#include <cstddef>
 #include <utility>
+#include <vector>
 
+#include "arrow/array.h"
+#include "arrow/buffer.h"
 #include "arrow/compute/context.h"
-#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/table.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace compute {
 
-// Helper class that properly invokes destructor when state goes out of scope.
-class ManagedAggregateState {
+// Helper class that properly invokes destructors when states go out of scope.
+//
+// The states of an aggregate function over all runs of its input are laid
+// out contiguously in a single buffer.
+class ManagedAggregateStates {
  public:
-  ManagedAggregateState(std::shared_ptr<AggregateFunction>& desc,
-                        std::shared_ptr<Buffer>&& buffer)
-      : desc_(desc), state_(buffer) {
-    desc_->New(state_->mutable_data());
+  ManagedAggregateStates(std::shared_ptr<AggregateFunction> desc,
+                         std::shared_ptr<Buffer> buffer, int64_t stride,
+                         int64_t num_states)
+      : desc_(std::move(desc)),
+        buffer_(std::move(buffer)),
+        stride_(stride),
+        num_states_(num_states) {
+    for (int64_t i = 0; i < num_states_; ++i) {
+      desc_->New(mutable_data(i));
+    }
   }
 
-  ~ManagedAggregateState() { desc_->Delete(state_->mutable_data()); }
-
-  void* mutable_data() { return state_->mutable_data(); }
+  ~ManagedAggregateStates() {
+    for (int64_t i = 0; i < num_states_; ++i) {
+      desc_->Delete(mutable_data(i));
+    }
+  }
 
-  static std::shared_ptr<ManagedAggregateState> Make(
-      std::shared_ptr<AggregateFunction>& desc, MemoryPool* pool) {
-    std::shared_ptr<Buffer> buf;
-    if (!AllocateBuffer(pool, desc->Size(), &buf).ok()) return nullptr;
+  void* mutable_data(int64_t i) { return buffer_->mutable_data() + i * stride_; }
 
-    return std::make_shared<ManagedAggregateState>(desc, std::move(buf));
+  static Status Make(const std::shared_ptr<AggregateFunction>& desc, int64_t num_states,
+                     MemoryPool* pool, std::unique_ptr<ManagedAggregateStates>* out) {
+    // Keep every state suitably aligned
+    const int64_t stride = BitUtil::RoundUp(desc->Size(), alignof(std::max_align_t));
+    std::shared_ptr<Buffer> buffer;
+    RETURN_NOT_OK(AllocateBuffer(pool, stride * num_states, &buffer));
+    out->reset(new ManagedAggregateStates(desc, std::move(buffer), stride, num_states));
+    return Status::OK();
   }
 
  private:
   std::shared_ptr<AggregateFunction> desc_;
-  std::shared_ptr<Buffer> state_;
+  std::shared_ptr<Buffer> buffer_;
+  int64_t stride_;
+  int64_t num_states_;
 };
 
-Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datum* out) {
-  if (!input.is_array()) return Status::Invalid("AggregateKernel expects Array datum");
+namespace {
+
+// The morsels of an input are grouped in at most this many runs, so that the
+// number of states (some of which, like sketches, are large) doesn't grow with
+// the input length.
+constexpr int64_t kMaxRunsPerInput = 64;
+
+// An aggregate function applied to one of several inputs
+struct InputAggregate {
+  size_t input;
+  std::shared_ptr<AggregateFunction> function;
+};
+
+// Consecutive morsels of an input, consumed by a single task
+struct AggregateRun {
+  size_t input;
+  // The index of the run among those of its input
+  int64_t index;
+  ArrayVector morsels;
+};
+
+// Split an array-like input into runs of morsels. Unless threads are allowed a
+// morsel is a whole chunk, and all of them form a single run.
+Status MakeRuns(FunctionContext* ctx, size_t input, const Datum& value,
+                std::vector<AggregateRun>* runs) {
+  ArrayVector chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.make_array());
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = value.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("AggregateKernel expects Array or ChunkedArray datum");
+  }
+
+  ArrayVector morsels;
+  for (const auto& chunk : chunks) {
+    if (!ctx->use_threads()) {
+      morsels.push_back(chunk);
+      continue;
+    }
+    const int64_t morsel_length = ctx->morsel_length();
+    for (int64_t offset = 0; offset < chunk->length(); offset += morsel_length) {
+      morsels.push_back(chunk->Slice(offset, morsel_length));
+    }
+  }
+
+  const auto num_morsels = static_cast<int64_t>(morsels.size());
+  const int64_t num_runs =
+      std::min(num_morsels, ctx->use_threads() ? kMaxRunsPerInput : 1);
+  for (int64_t i = 0; i < num_runs; ++i) {
+    const int64_t begin = num_morsels * i / num_runs;
+    const int64_t end = num_morsels * (i + 1) / num_runs;
+    runs->push_back({input, i, ArrayVector(morsels.begin() + begin,
+                                           morsels.begin() + end)});
+  }
+  return Status::OK();
+}
+
+// Consume the inputs in runs of morsels, applying all aggregates of an input to
+// each of its morsels in turn. Every aggregate has an accumulating state and a
+// scratch state per run; the states of the runs are then merged in input order
+// so that results don't depend on scheduling.
+Status ConsumeAndFinalize(FunctionContext* ctx, const std::vector<Datum>& inputs,
+                          const std::vector<InputAggregate>& aggregates,
+                          std::vector<Datum>* out) {
+  std::vector<AggregateRun> runs;
+  std::vector<int64_t> num_runs(inputs.size(), 0);
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    const size_t first_run = runs.size();
+    RETURN_NOT_OK(MakeRuns(ctx, i, inputs[i], &runs));
+    num_runs[i] = static_cast<int64_t>(runs.size() - first_run);
+  }
+
+  std::vector<std::vector<size_t>> aggregates_of_input(inputs.size());
+  std::vector<std::unique_ptr<ManagedAggregateStates>> states(aggregates.size());
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    const InputAggregate& aggregate = aggregates[i];
+    aggregates_of_input[aggregate.input].push_back(i);
+    // One more state accumulates the merged result
+    RETURN_NOT_OK(ManagedAggregateStates::Make(aggregate.function,
+                                               2 * num_runs[aggregate.input] + 1,
+                                               ctx->memory_pool(), &states[i]));
+  }
+
+  auto consume = [&](int i) {
+    const AggregateRun& run = runs[i];
+    const int64_t scratch = num_runs[run.input] + run.index;
+    for (size_t j = 0; j < run.morsels.size(); ++j) {
+      for (size_t aggregate : aggregates_of_input[run.input]) {
+        const AggregateFunction& function = *aggregates[aggregate].function;
+        void* state = states[aggregate]->mutable_data(run.index);
+        if (j == 0) {
+          RETURN_NOT_OK(function.Consume(*run.morsels[j], state));
+        } else {
+          void* scratch_state = states[aggregate]->mutable_data(scratch);
+          RETURN_NOT_OK(function.Consume(*run.morsels[j], scratch_state));
+          RETURN_NOT_OK(function.Merge(scratch_state, state));
+        }
+      }
+    }
+    return Status::OK();
+  };
+
+  const auto num_tasks = static_cast<int>(runs.size());
+  if (ctx->use_threads() && num_tasks > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_tasks, consume));
+  } else {
+    for (int i = 0; i < num_tasks; ++i) {
+      RETURN_NOT_OK(consume(i));
+    }
+  }
 
-  auto state = ManagedAggregateState::Make(aggregate_function_, ctx->memory_pool());
-  if (!state) return Status::OutOfMemory("AggregateState allocation failed");
+  out->resize(aggregates.size());
+  for (size_t i = 0; i < aggregates.size(); ++i) {
+    const AggregateFunction& function = *aggregates[i].function;
+    const int64_t input_runs = num_runs[aggregates[i].input];
+    void* merged_state = states[i]->mutable_data(2 * input_runs);
+    for (int64_t j = 0; j < input_runs; ++j) {
+      RETURN_NOT_OK(function.Merge(states[i]->mutable_data(j), merged_state));
+    }
+    RETURN_NOT_OK(function.Finalize(merged_state, &(*out)[i]));
+  }
+  return Status::OK();
+}
 
-  auto array = input.make_array();
-  RETURN_NOT_OK(aggregate_function_->Consume(*array, state->mutable_data()));
-  RETURN_NOT_OK(aggregate_function_->Finalize(state->mutable_data(), out));
+}  // namespace
 
+Status AggregateUnaryKernel::Call(FunctionContext* ctx, const Datum& input, Datum* out) {
+  if (!input.is_arraylike()) {
+    return Status::Invalid("AggregateKernel expects Array or ChunkedArray datum");
+  }
+
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(ConsumeAndFinalize(ctx, {input}, {{0, aggregate_function_}}, &outputs));
+  *out = std::move(outputs[0]);
   return Status::OK();
 }
 
@@ -66,5 +217,30 @@ std::shared_ptr<DataType> AggregateUnaryKernel::out_type() const {
   return aggregate_function_->out_type();
 }
 
+Status Aggregate(FunctionContext* ctx, const Table& table,
+                 const std::vector<ColumnAggregate>& aggregates,
+                 std::vector<Datum>* out) {
+  // Only pass the columns which are aggregated, each of them once
+  std::vector<Datum> inputs;
+  std::vector<int> input_of_column(table.num_columns(), -1);
+  std::vector<InputAggregate> input_aggregates;
+  for (const ColumnAggregate& aggregate : aggregates) {
+    if (aggregate.column < 0 || aggregate.column >= table.num_columns()) {
+      return Status::IndexError("Aggregated column ", aggregate.column,
+                                " out of bounds");
+    }
+    if (aggregate.function == nullptr) {
+      return Status::Invalid("No aggregate function for column ", aggregate.column);
+    }
+    int& input = input_of_column[aggregate.column];
+    if (input < 0) {
+      input = static_cast<int>(inputs.size());
+      inputs.emplace_back(table.column(aggregate.column));
+    }
+    input_aggregates.push_back({static_cast<size_t>(input), aggregate.function});
+  }
+  return ConsumeAndFinalize(ctx, inputs, input_aggregates, out);
+}
+
 }  // namespace compute
 }  // namespace arrow
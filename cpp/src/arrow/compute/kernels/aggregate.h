@@ -18,6 +18,8 @@
 #pragma once
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "arrow/compute/kernel.h"
 
@@ -25,6 +27,7 @@ namespace arrow {
 
 class Array;
 class Status;
+class Table;
 
 namespace compute {
 
@@ -46,7 +49,7 @@ struct Datum;
 /// Design inspired by ClickHouse aggregate functions.
 class AggregateFunction {
  public:
-  /// \brief Consume an array into a state.
+  /// \brief Consume an array into a state, replacing its previous contents.
   virtual Status Consume(const Array& input, void* state) const = 0;
 
   /// \brief Merge states.
@@ -98,6 +101,10 @@ class AggregateFunctionStaticState : public AggregateFunction {
 };
 
 /// \brief UnaryKernel implemented by an AggregateState
+///
+/// The input may be an Array or a ChunkedArray. If the FunctionContext allows
+/// threads, its chunks are split into morsels, whose runs are consumed in
+/// parallel into separate states, then merged.
 class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
  public:
   explicit AggregateUnaryKernel(std::shared_ptr<AggregateFunction>& aggregate)
@@ -111,5 +118,34 @@ class ARROW_EXPORT AggregateUnaryKernel : public UnaryKernel {
   std::shared_ptr<AggregateFunction> aggregate_function_;
 };
 
+/// \brief An aggregate to compute over a column of a Table
+struct ARROW_EXPORT ColumnAggregate {
+  ColumnAggregate(int column, std::shared_ptr<AggregateFunction> function)
+      : column(column), function(std::move(function)) {}
+
+  /// Index of the aggregated column
+  int column;
+  std::shared_ptr<AggregateFunction> function;
+};
+
+/// \brief Compute several aggregates over the columns of a Table in one pass
+///
+/// Each morsel of a column is consumed by all the aggregates over that column
+/// in turn while it is in cache, so a column is scanned once regardless of how
+/// many aggregates use it. If ctx->use_threads(), morsels of all columns are
+/// consumed in parallel.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] table the input table
+/// \param[in] aggregates the aggregates to compute
+/// \param[out] out the result of each aggregate, in the same order
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Aggregate(FunctionContext* ctx, const Table& table,
+                 const std::vector<ColumnAggregate>& aggregates,
+                 std::vector<Datum>* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -17,14 +17,21 @@
 
 #include "benchmark/benchmark.h"
 
+#include <string>
 #include <vector>
 
 #include "arrow/builder.h"
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/approximate.h"
+#include "arrow/compute/kernels/count.h"
+#include "arrow/compute/kernels/mean.h"
+#include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/memory_pool.h"
+#include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/bit_util.h"
@@ -328,5 +335,145 @@ static void SumKernel(benchmark::State& state) {
 
 BENCHMARK(SumKernel)->Apply(RegressionSetArgs);
 
+constexpr int64_t kChunkedAggregateLength = 1 << 24;
+constexpr int kChunkedAggregateColumns = 4;
+
+static std::shared_ptr<ChunkedArray> MakeChunkedInt64(
+    random::RandomArrayGenerator* rand) {
+  // Chunks of 1M values
+  ArrayVector chunks;
+  for (int64_t i = 0; i < kChunkedAggregateLength; i += 1 << 20) {
+    chunks.push_back(rand->Int64(1 << 20, -100, 100, /*null_probability=*/0.01));
+  }
+  return std::make_shared<ChunkedArray>(chunks);
+}
+
+// state.range(0) is the morsel length, or 0 to consume chunks serially
+static void SumChunked(benchmark::State& state) {
+  auto rand = random::RandomArrayGenerator(1923);
+  Datum values(MakeChunkedInt64(&rand));
+
+  FunctionContext ctx;
+  if (state.range(0) > 0) {
+    ctx.set_use_threads(true);
+    ctx.set_morsel_length(state.range(0));
+  }
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Sum(&ctx, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * kChunkedAggregateLength * sizeof(int64_t));
+}
+
+static void ApproxCountDistinctChunked(benchmark::State& state) {
+  auto rand = random::RandomArrayGenerator(1923);
+  Datum values(MakeChunkedInt64(&rand));
+
+  FunctionContext ctx;
+  ctx.set_use_threads(state.range(0) > 0);
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(ApproxCountDistinct(&ctx, ApproxCountDistinctOptions(), values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * kChunkedAggregateLength * sizeof(int64_t));
+}
+
+static void ApproxMedianChunked(benchmark::State& state) {
+  auto rand = random::RandomArrayGenerator(1923);
+  Datum values(MakeChunkedInt64(&rand));
+
+  FunctionContext ctx;
+  ctx.set_use_threads(state.range(0) > 0);
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(ApproxQuantile(&ctx, ApproxQuantileOptions(), values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * kChunkedAggregateLength * sizeof(int64_t));
+}
+
+static std::shared_ptr<Table> MakeAggregateTable() {
+  auto rand = random::RandomArrayGenerator(1923);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<ChunkedArray>> columns;
+  for (int i = 0; i < kChunkedAggregateColumns; ++i) {
+    fields.push_back(field("c" + std::to_string(i), int64()));
+    columns.push_back(MakeChunkedInt64(&rand));
+  }
+  return Table::Make(schema(fields), columns);
+}
+
+static std::vector<ColumnAggregate> MakeTableAggregates(FunctionContext* ctx) {
+  std::vector<ColumnAggregate> aggregates;
+  for (int i = 0; i < kChunkedAggregateColumns; ++i) {
+    aggregates.emplace_back(i, MakeSumAggregateFunction(*int64(), ctx));
+    aggregates.emplace_back(i, MakeMeanAggregateFunction(*int64(), ctx));
+    aggregates.emplace_back(
+        i, MakeMinMaxAggregateFunction(*int64(), ctx, MinMaxOptions()));
+    aggregates.emplace_back(
+        i, MakeCountAggregateFunction(ctx, CountOptions(CountOptions::COUNT_NULL)));
+  }
+  return aggregates;
+}
+
+// Every aggregate over each column, consuming each column once
+static void AggregateTable(benchmark::State& state) {
+  auto table = MakeAggregateTable();
+  FunctionContext ctx;
+  ctx.set_use_threads(state.range(0) != 0);
+  auto aggregates = MakeTableAggregates(&ctx);
+  for (auto _ : state) {
+    std::vector<Datum> out;
+    ABORT_NOT_OK(Aggregate(&ctx, *table, aggregates, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetBytesProcessed(state.iterations() * kChunkedAggregateColumns *
+                          kChunkedAggregateLength * sizeof(int64_t));
+}
+
+// The same aggregates, consuming each column once per aggregate
+static void AggregateTableSeparately(benchmark::State& state) {
+  auto table = MakeAggregateTable();
+  FunctionContext ctx;
+  ctx.set_use_threads(state.range(0) != 0);
+  auto aggregates = MakeTableAggregates(&ctx);
+  for (auto _ : state) {
+    for (const auto& aggregate : aggregates) {
+      Datum out;
+      auto function = aggregate.function;
+      AggregateUnaryKernel kernel(function);
+      ABORT_NOT_OK(kernel.Call(&ctx, table->column(aggregate.column), &out));
+      benchmark::DoNotOptimize(out);
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * kChunkedAggregateColumns *
+                          kChunkedAggregateLength * sizeof(int64_t));
+}
+
+BENCHMARK(SumChunked)
+    ->Arg(0)
+    ->Arg(1 << 15)
+    ->Arg(1 << 18)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(ApproxCountDistinctChunked)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(ApproxMedianChunked)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+BENCHMARK(AggregateTable)->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(AggregateTableSeparately)
+    ->Arg(0)
+    ->Arg(1)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
 }  // namespace compute
 }  // namespace arrow
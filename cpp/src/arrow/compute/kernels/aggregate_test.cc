@@ -16,20 +16,28 @@
 // under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <memory>
+#include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/compute/kernels/approximate.h"
 #include "arrow/compute/kernels/count.h"
 #include "arrow/compute/kernels/mean.h"
 #include "arrow/compute/kernels/minmax.h"
 #include "arrow/compute/kernels/sum.h"
 #include "arrow/compute/kernels/sum_internal.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/table.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
@@ -40,6 +48,7 @@
 
 namespace arrow {
 
+using internal::checked_cast;
 using internal::checked_pointer_cast;
 
 namespace compute {
@@ -364,5 +373,295 @@ TYPED_TEST(TestFloatingMinMaxKernel, Floats) {
   this->AssertMinMaxIs("[5, -Inf, 2, 3, 4]", -INFINITY, 5, options);
 }
 
+///
+/// Chunked and parallel aggregation
+///
+
+class TestAggregateChunked : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<ChunkedArray> Chunk(const std::shared_ptr<Array>& array,
+                                      const std::vector<int64_t>& lengths) {
+    ArrayVector chunks;
+    int64_t offset = 0;
+    for (auto length : lengths) {
+      chunks.push_back(array->Slice(offset, length));
+      offset += length;
+    }
+    return std::make_shared<ChunkedArray>(chunks);
+  }
+
+  // The results over chunks, whether consumed serially or in parallel morsels, must
+  // equal those over the unchunked array
+  void CheckChunked(const std::shared_ptr<Array>& array,
+                    const std::shared_ptr<ChunkedArray>& chunked) {
+    const CountOptions count_nulls(CountOptions::COUNT_NULL);
+    Datum expected_sum, expected_mean, expected_minmax, expected_count;
+    ASSERT_OK(Sum(&ctx_, array, &expected_sum));
+    ASSERT_OK(Mean(&ctx_, array, &expected_mean));
+    ASSERT_OK(MinMax(&ctx_, MinMaxOptions(), array, &expected_minmax));
+    ASSERT_OK(Count(&ctx_, count_nulls, array, &expected_count));
+
+    for (bool use_threads : {false, true}) {
+      ctx_.set_use_threads(use_threads);
+      ctx_.set_morsel_length(64);
+
+      Datum out;
+      ASSERT_OK(Sum(&ctx_, chunked, &out));
+      AssertDatumsEqual(expected_sum, out);
+      ASSERT_OK(Mean(&ctx_, chunked, &out));
+      AssertDatumsEqual(expected_mean, out);
+      ASSERT_OK(MinMax(&ctx_, MinMaxOptions(), chunked, &out));
+      AssertDatumsEqual(expected_minmax, out);
+      ASSERT_OK(Count(&ctx_, count_nulls, chunked, &out));
+      AssertDatumsEqual(expected_count, out);
+    }
+  }
+
+  random::RandomArrayGenerator rand_{0x5416447};
+};
+
+TEST_F(TestAggregateChunked, Integers) {
+  auto array = rand_.Int32(1000, -1000, 1000, 0.1);
+  CheckChunked(array, Chunk(array, {0, 100, 1, 0, 499, 400}));
+  CheckChunked(array->Slice(3, 10), Chunk(array->Slice(3, 10), {5, 5}));
+
+  // More morsels than runs of morsels consumed by a single task
+  auto long_array = rand_.Int32(20000, -1000, 1000, 0.1);
+  CheckChunked(long_array, Chunk(long_array, {5000, 1, 14999}));
+}
+
+TEST_F(TestAggregateChunked, Empty) {
+  auto array = ArrayFromJSON(int64(), "[]");
+  CheckChunked(array, std::make_shared<ChunkedArray>(ArrayVector{}, int64()));
+  CheckChunked(array, Chunk(array, {0, 0}));
+}
+
+TEST_F(TestAggregateChunked, Table) {
+  auto ints = rand_.Int64(1000, -1000, 1000, 0.1);
+  // Round doubles to small integers, so that their sum doesn't depend on the order
+  // of additions
+  auto doubles = rand_.Float64(1000, 0, 1, 0.2);
+  std::shared_ptr<Array> floors;
+  {
+    DoubleBuilder builder;
+    const auto& values = checked_cast<const DoubleArray&>(*doubles);
+    for (int64_t i = 0; i < values.length(); ++i) {
+      if (values.IsNull(i)) {
+        ASSERT_OK(builder.AppendNull());
+      } else {
+        ASSERT_OK(builder.Append(std::floor(values.Value(i) * 100)));
+      }
+    }
+    ASSERT_OK(builder.Finish(&floors));
+  }
+  auto table = Table::Make(
+      schema({field("i", int64()), field("f", float64())}),
+      {Chunk(ints, {300, 700}), Chunk(floors, {10, 90, 900})});
+
+  const CountOptions count_all(CountOptions::COUNT_ALL);
+  std::vector<ColumnAggregate> aggregates = {
+      {0, MakeSumAggregateFunction(*int64(), &ctx_)},
+      {1, MakeMeanAggregateFunction(*float64(), &ctx_)},
+      {0, MakeMinMaxAggregateFunction(*int64(), &ctx_, MinMaxOptions())},
+      {1, MakeCountAggregateFunction(&ctx_, count_all)},
+      {1, MakeSumAggregateFunction(*float64(), &ctx_)}};
+
+  std::vector<Datum> expected(5);
+  ASSERT_OK(Sum(&ctx_, ints, &expected[0]));
+  ASSERT_OK(Mean(&ctx_, floors, &expected[1]));
+  ASSERT_OK(MinMax(&ctx_, MinMaxOptions(), ints, &expected[2]));
+  ASSERT_OK(Count(&ctx_, count_all, floors, &expected[3]));
+  ASSERT_OK(Sum(&ctx_, floors, &expected[4]));
+
+  for (bool use_threads : {false, true}) {
+    ctx_.set_use_threads(use_threads);
+    ctx_.set_morsel_length(64);
+
+    std::vector<Datum> out;
+    ASSERT_OK(Aggregate(&ctx_, *table, aggregates, &out));
+    ASSERT_EQ(out.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      AssertDatumsEqual(expected[i], out[i]);
+    }
+  }
+
+  std::vector<Datum> out;
+  ASSERT_RAISES(IndexError,
+                Aggregate(&ctx_, *table, {{2, aggregates[0].function}}, &out));
+  ASSERT_RAISES(Invalid, Aggregate(&ctx_, *table, {{0, nullptr}}, &out));
+}
+
+///
+/// Approximate aggregates
+///
+
+class TestApproxAggregates : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<ChunkedArray> Split(const std::shared_ptr<Array>& array, int64_t n) {
+    ArrayVector chunks;
+    for (int64_t offset = 0; offset < array->length(); offset += n) {
+      chunks.push_back(array->Slice(offset, n));
+    }
+    return std::make_shared<ChunkedArray>(chunks);
+  }
+
+  // Check an approximate distinct count over the array, serially and in parallel
+  void CheckCountDistinct(const Datum& value, int64_t expected, int precision) {
+    const double error = 4 * 1.04 / std::sqrt(std::ldexp(1.0, precision));
+    for (bool use_threads : {false, true}) {
+      ctx_.set_use_threads(use_threads);
+      ctx_.set_morsel_length(64);
+
+      Datum out;
+      ASSERT_OK(ApproxCountDistinct(&ctx_, ApproxCountDistinctOptions(precision),
+                                    value, &out));
+      const auto count = checked_cast<const Int64Scalar&>(*out.scalar()).value;
+      ASSERT_NEAR(static_cast<double>(count), static_cast<double>(expected),
+                  expected * error + 1);
+    }
+  }
+
+  random::RandomArrayGenerator rand_{0x2a91f};
+};
+
+TEST_F(TestApproxAggregates, CountDistinctIntegers) {
+  // Values in [0, 2000), nearly all of which appear among 50000 values
+  auto values = rand_.Int64(50000, 0, 1999, 0.1);
+  std::unordered_set<int64_t> distinct;
+  const auto& int_values = checked_cast<const Int64Array&>(*values);
+  for (int64_t i = 0; i < int_values.length(); ++i) {
+    if (int_values.IsValid(i)) {
+      distinct.insert(int_values.Value(i));
+    }
+  }
+  const auto expected = static_cast<int64_t>(distinct.size());
+  CheckCountDistinct(values, expected, 12);
+  CheckCountDistinct(Split(values, 7000), expected, 12);
+  CheckCountDistinct(Split(values, 7000), expected, 16);
+
+  CheckCountDistinct(ArrayFromJSON(int32(), "[]"), 0, 12);
+  CheckCountDistinct(ArrayFromJSON(int32(), "[null, null]"), 0, 12);
+  CheckCountDistinct(ArrayFromJSON(float64(), "[0.0, -0.0, 1.5, 1.5, NaN]"), 3, 12);
+}
+
+TEST_F(TestApproxAggregates, CountDistinctStrings) {
+  auto values = rand_.String(20000, 0, 3, 0.05);
+  std::unordered_set<std::string> distinct;
+  const auto& string_values = checked_cast<const StringArray&>(*values);
+  for (int64_t i = 0; i < string_values.length(); ++i) {
+    if (string_values.IsValid(i)) {
+      distinct.insert(string_values.GetString(i));
+    }
+  }
+  CheckCountDistinct(Split(values, 3000), static_cast<int64_t>(distinct.size()), 12);
+
+  Datum out;
+  ASSERT_RAISES(NotImplemented,
+                ApproxCountDistinct(&ctx_, ApproxCountDistinctOptions(),
+                                    ArrayFromJSON(null(), "[null]"), &out));
+}
+
+TEST_F(TestApproxAggregates, Quantiles) {
+  auto values = rand_.Float64(50000, -100, 100, 0.1);
+  std::vector<double> sorted;
+  const auto& double_values = checked_cast<const DoubleArray&>(*values);
+  for (int64_t i = 0; i < double_values.length(); ++i) {
+    if (double_values.IsValid(i)) {
+      sorted.push_back(double_values.Value(i));
+    }
+  }
+  std::sort(sorted.begin(), sorted.end());
+
+  const std::vector<double> quantiles = {0, 0.01, 0.5, 0.9, 1};
+  const ApproxQuantileOptions options(quantiles);
+  for (bool use_threads : {false, true}) {
+    ctx_.set_use_threads(use_threads);
+    ctx_.set_morsel_length(64);
+
+    Datum out;
+    ASSERT_OK(ApproxQuantile(&ctx_, options, Split(values, 10000), &out));
+    ASSERT_EQ(out.kind(), Datum::COLLECTION);
+    ASSERT_EQ(out.collection().size(), quantiles.size());
+    for (size_t i = 0; i < quantiles.size(); ++i) {
+      const auto estimate =
+          checked_cast<const DoubleScalar&>(*out.collection()[i].scalar()).value;
+      // The estimate must be within 1% of the exact quantile, in rank space
+      auto exact = [&](double q) {
+        q = std::min(std::max(q, 0.0), 1.0);
+        return sorted[static_cast<size_t>(q * (sorted.size() - 1))];
+      };
+      ASSERT_GE(estimate, exact(quantiles[i] - 0.01));
+      ASSERT_LE(estimate, exact(quantiles[i] + 0.01));
+    }
+  }
+
+  Datum out;
+  ASSERT_OK(ApproxQuantile(&ctx_, options, ArrayFromJSON(int8(), "[null]"), &out));
+  for (const Datum& quantile : out.collection()) {
+    ASSERT_FALSE(quantile.scalar()->is_valid);
+  }
+  ASSERT_RAISES(Invalid, ApproxQuantile(&ctx_, ApproxQuantileOptions({1.5}), values,
+                                        &out));
+  ASSERT_RAISES(Invalid, ApproxQuantile(&ctx_, options,
+                                        ArrayFromJSON(utf8(), R"(["a"])"), &out));
+}
+
+TEST_F(TestApproxAggregates, MergeSketches) {
+  // Sketches computed separately, e.g. in other processes, merge into the
+  // sketch of all values
+  auto left = rand_.Int32(10000, 0, 100000, 0);
+  auto right = rand_.Int32(10000, 0, 100000, 0);
+  const ApproxCountDistinctOptions count_options(12, /*output_sketch=*/true);
+  const ApproxQuantileOptions quantile_options({0.5}, 100, /*output_sketch=*/true);
+
+  Datum left_out, right_out, both_out;
+  auto both = std::make_shared<ChunkedArray>(ArrayVector{left, right});
+  ASSERT_OK(ApproxCountDistinct(&ctx_, count_options, left, &left_out));
+  ASSERT_OK(ApproxCountDistinct(&ctx_, count_options, right, &right_out));
+  ASSERT_OK(ApproxCountDistinct(&ctx_, count_options, both, &both_out));
+
+  auto sketch_data = [](const Datum& datum) {
+    return util::string_view(
+        *checked_cast<const BinaryScalar&>(*datum.scalar()).value);
+  };
+  util::HyperLogLog merged, right_sketch, both_sketch;
+  ASSERT_OK(util::HyperLogLog::Deserialize(sketch_data(left_out), &merged));
+  ASSERT_OK(util::HyperLogLog::Deserialize(sketch_data(right_out), &right_sketch));
+  ASSERT_OK(util::HyperLogLog::Deserialize(sketch_data(both_out), &both_sketch));
+  ASSERT_OK(merged.Merge(right_sketch));
+  ASSERT_EQ(merged.Serialize(), both_sketch.Serialize());
+
+  ASSERT_OK(ApproxQuantile(&ctx_, quantile_options, left, &left_out));
+  ASSERT_OK(ApproxQuantile(&ctx_, quantile_options, right, &right_out));
+  util::TDigest merged_digest, right_digest;
+  ASSERT_OK(util::TDigest::Deserialize(sketch_data(left_out), &merged_digest));
+  ASSERT_OK(util::TDigest::Deserialize(sketch_data(right_out), &right_digest));
+  merged_digest.Merge(right_digest);
+  ASSERT_NEAR(merged_digest.Quantile(0.5), 50000, 1000);
+}
+
+TEST_F(TestApproxAggregates, Table) {
+  auto ints = rand_.Int64(10000, 0, 499, 0.1);
+  auto table = Table::Make(schema({field("i", int64())}), {Split(ints, 3000)});
+  std::vector<ColumnAggregate> aggregates = {
+      {0, MakeApproxCountDistinctAggregateFunction(*int64(), &ctx_,
+                                                   ApproxCountDistinctOptions())},
+      {0, MakeApproxQuantileAggregateFunction(*int64(), &ctx_,
+                                              ApproxQuantileOptions({0.5}))}};
+
+  std::vector<Datum> expected(2);
+  ASSERT_OK(ApproxCountDistinct(&ctx_, ApproxCountDistinctOptions(), ints,
+                                &expected[0]));
+  ASSERT_OK(ApproxQuantile(&ctx_, ApproxQuantileOptions({0.5}), ints, &expected[1]));
+
+  std::vector<Datum> out;
+  ASSERT_OK(Aggregate(&ctx_, *table, aggregates, &out));
+  // The sketch of the distinct count doesn't depend on how values are split
+  AssertDatumsEqual(expected[0], out[0]);
+  const auto median =
+      checked_cast<const DoubleScalar&>(*out[1].collection()[0].scalar()).value;
+  ASSERT_NEAR(median, 250, 10);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,302 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/approximate.h"
+
+#include <cmath>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/aggregate.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/string_view.h"
+#include "arrow/visitor_inline.h"
+
+namespace arrow {
+
+using util::HyperLogLog;
+using util::TDigest;
+
+namespace compute {
+
+namespace {
+
+template <typename T>
+enable_if_t<std::is_integral<T>::value, uint64_t> HashValue(T value) {
+  return internal::ScalarHelper<T, 0>::ComputeHash(value);
+}
+
+template <typename T>
+enable_if_t<std::is_floating_point<T>::value, uint64_t> HashValue(T value) {
+  // Equal values must have equal hashes, whatever their bit representation
+  if (value == 0) {
+    value = 0;
+  } else if (std::isnan(value)) {
+    value = std::numeric_limits<T>::quiet_NaN();
+  }
+  return internal::ScalarHelper<T, 0>::ComputeHash(value);
+}
+
+uint64_t HashValue(util::string_view value) {
+  return internal::ComputeStringHash<0>(value.data(),
+                                        static_cast<int64_t>(value.size()));
+}
+
+// Add the hashes of the non-null values of an array to a sketch
+struct HashingVisitor {
+  Status VisitNull() { return Status::OK(); }
+
+  template <typename Value>
+  Status VisitValue(Value value) {
+    sketch->Update(HyperLogLog::MixHash(HashValue(value)));
+    return Status::OK();
+  }
+
+  HyperLogLog* sketch;
+};
+
+std::shared_ptr<Scalar> SketchAsScalar(std::string sketch) {
+  return std::make_shared<BinaryScalar>(Buffer::FromString(std::move(sketch)));
+}
+
+}  // namespace
+
+// ----------------------------------------------------------------------
+// Approximate distinct count
+
+template <typename ArrowType>
+class ApproxCountDistinctAggregateFunction final : public AggregateFunction {
+ public:
+  explicit ApproxCountDistinctAggregateFunction(const ApproxCountDistinctOptions& options)
+      : options_(options) {}
+
+  Status Consume(const Array& input, void* state) const override {
+    HashingVisitor visitor{static_cast<HyperLogLog*>(state)};
+    visitor.sketch->Reset();
+    // Make sure the null count is known before visiting the raw data
+    input.null_count();
+    return ArrayDataVisitor<ArrowType>::Visit(*input.data(), &visitor);
+  }
+
+  Status Merge(const void* src, void* dst) const override {
+    return static_cast<HyperLogLog*>(dst)->Merge(*static_cast<const HyperLogLog*>(src));
+  }
+
+  Status Finalize(const void* src, Datum* output) const override {
+    const auto& sketch = *static_cast<const HyperLogLog*>(src);
+    if (options_.output_sketch) {
+      *output = SketchAsScalar(sketch.Serialize());
+    } else {
+      *output = MakeScalar(static_cast<int64_t>(std::llround(sketch.Estimate())));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return options_.output_sketch ? binary() : int64();
+  }
+
+  int64_t Size() const override { return sizeof(HyperLogLog); }
+
+  void New(void* ptr) const override { new (ptr) HyperLogLog(options_.precision); }
+
+  void Delete(void* ptr) const override {
+    static_cast<HyperLogLog*>(ptr)->~HyperLogLog();
+  }
+
+ private:
+  ApproxCountDistinctOptions options_;
+};
+
+#define APPROX_COUNT_DISTINCT_TYPES(PROCESS) \
+  PROCESS(BooleanType)                       \
+  PROCESS(UInt8Type)                         \
+  PROCESS(Int8Type)                          \
+  PROCESS(UInt16Type)                        \
+  PROCESS(Int16Type)                         \
+  PROCESS(UInt32Type)                        \
+  PROCESS(Int32Type)                         \
+  PROCESS(UInt64Type)                        \
+  PROCESS(Int64Type)                         \
+  PROCESS(FloatType)                         \
+  PROCESS(DoubleType)                        \
+  PROCESS(Date32Type)                        \
+  PROCESS(Date64Type)                        \
+  PROCESS(Time32Type)                        \
+  PROCESS(Time64Type)                        \
+  PROCESS(TimestampType)                     \
+  PROCESS(BinaryType)                        \
+  PROCESS(StringType)                        \
+  PROCESS(LargeBinaryType)                   \
+  PROCESS(LargeStringType)                   \
+  PROCESS(FixedSizeBinaryType)               \
+  PROCESS(Decimal128Type)
+
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinctAggregateFunction(
+    const DataType& type, FunctionContext* ctx,
+    const ApproxCountDistinctOptions& options) {
+  switch (type.id()) {
+#define PROCESS(T)                                      \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<ApproxCountDistinctAggregateFunction<T>>(options));
+
+    APPROX_COUNT_DISTINCT_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      return nullptr;
+  }
+}
+
+#undef APPROX_COUNT_DISTINCT_TYPES
+
+Status ApproxCountDistinct(FunctionContext* ctx,
+                           const ApproxCountDistinctOptions& options, const Datum& value,
+                           Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeApproxCountDistinctAggregateFunction(*data_type, ctx, options);
+  if (!aggregate) {
+    return Status::NotImplemented("No approximate distinct count for type ", *data_type);
+  }
+  return AggregateUnaryKernel(aggregate).Call(ctx, value, out);
+}
+
+// ----------------------------------------------------------------------
+// Approximate quantiles
+
+template <typename ArrowType>
+class ApproxQuantileAggregateFunction final : public AggregateFunction {
+ public:
+  explicit ApproxQuantileAggregateFunction(const ApproxQuantileOptions& options)
+      : options_(options) {}
+
+  Status Consume(const Array& input, void* state) const override {
+    struct Visitor {
+      Status VisitNull() { return Status::OK(); }
+
+      Status VisitValue(typename ArrowType::c_type value) {
+        digest->Add(static_cast<double>(value));
+        return Status::OK();
+      }
+
+      TDigest* digest;
+    };
+
+    Visitor visitor{static_cast<TDigest*>(state)};
+    visitor.digest->Reset();
+    // Make sure the null count is known before visiting the raw data
+    input.null_count();
+    return ArrayDataVisitor<ArrowType>::Visit(*input.data(), &visitor);
+  }
+
+  Status Merge(const void* src, void* dst) const override {
+    static_cast<TDigest*>(dst)->Merge(*static_cast<const TDigest*>(src));
+    return Status::OK();
+  }
+
+  Status Finalize(const void* src, Datum* output) const override {
+    TDigest digest = *static_cast<const TDigest*>(src);
+    if (options_.output_sketch) {
+      *output = SketchAsScalar(digest.Serialize());
+      return Status::OK();
+    }
+
+    std::vector<Datum> quantiles;
+    for (double q : options_.quantiles) {
+      if (digest.is_empty()) {
+        quantiles.emplace_back(MakeNullScalar(float64()));
+      } else {
+        quantiles.emplace_back(MakeScalar(digest.Quantile(q)));
+      }
+    }
+    *output = Datum(std::move(quantiles));
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return options_.output_sketch ? binary() : float64();
+  }
+
+  int64_t Size() const override { return sizeof(TDigest); }
+
+  void New(void* ptr) const override { new (ptr) TDigest(options_.compression); }
+
+  void Delete(void* ptr) const override { static_cast<TDigest*>(ptr)->~TDigest(); }
+
+ private:
+  ApproxQuantileOptions options_;
+};
+
+#define APPROX_QUANTILE_AGG_FN_CASE(T)                  \
+  case T::type_id:                                      \
+    return std::static_pointer_cast<AggregateFunction>( \
+        std::make_shared<ApproxQuantileAggregateFunction<T>>(options));
+
+std::shared_ptr<AggregateFunction> MakeApproxQuantileAggregateFunction(
+    const DataType& type, FunctionContext* ctx, const ApproxQuantileOptions& options) {
+  switch (type.id()) {
+    APPROX_QUANTILE_AGG_FN_CASE(UInt8Type);
+    APPROX_QUANTILE_AGG_FN_CASE(Int8Type);
+    APPROX_QUANTILE_AGG_FN_CASE(UInt16Type);
+    APPROX_QUANTILE_AGG_FN_CASE(Int16Type);
+    APPROX_QUANTILE_AGG_FN_CASE(UInt32Type);
+    APPROX_QUANTILE_AGG_FN_CASE(Int32Type);
+    APPROX_QUANTILE_AGG_FN_CASE(UInt64Type);
+    APPROX_QUANTILE_AGG_FN_CASE(Int64Type);
+    APPROX_QUANTILE_AGG_FN_CASE(FloatType);
+    APPROX_QUANTILE_AGG_FN_CASE(DoubleType);
+    default:
+      return nullptr;
+  }
+}
+
+#undef APPROX_QUANTILE_AGG_FN_CASE
+
+Status ApproxQuantile(FunctionContext* ctx, const ApproxQuantileOptions& options,
+                      const Datum& value, Datum* out) {
+  auto data_type = value.type();
+  if (data_type == nullptr) {
+    return Status::Invalid("Datum must be array-like");
+  }
+  for (double q : options.quantiles) {
+    if (!(q >= 0 && q <= 1)) {
+      return Status::Invalid("Quantile must be in [0, 1], got ", q);
+    }
+  }
+
+  std::shared_ptr<AggregateFunction> aggregate =
+      MakeApproxQuantileAggregateFunction(*data_type, ctx, options);
+  if (!aggregate) {
+    return Status::Invalid("Datum must contain a NumericType");
+  }
+  return AggregateUnaryKernel(aggregate).Call(ctx, value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,139 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "arrow/util/hyperloglog.h"
+#include "arrow/util/tdigest.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class DataType;
+class Status;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+class AggregateFunction;
+
+/// \class ApproxCountDistinctOptions
+///
+/// The user can control the ApproxCountDistinct kernel behavior with this class.
+struct ARROW_EXPORT ApproxCountDistinctOptions {
+  explicit ApproxCountDistinctOptions(
+      int precision = util::HyperLogLog::kDefaultPrecision, bool output_sketch = false)
+      : precision(precision), output_sketch(output_sketch) {}
+
+  /// The HyperLogLog sketch has 2^precision registers; see util::HyperLogLog
+  int precision;
+  /// If true, output the serialized sketch as a binary scalar instead of the
+  /// estimate, so that it can be merged with sketches computed elsewhere
+  bool output_sketch;
+};
+
+/// \brief Return an approximate distinct count aggregate
+///
+/// \param[in] type required to specialize the kernel
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxCountDistinctOptions for more information
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxCountDistinctAggregateFunction(
+    const DataType& type, FunctionContext* ctx,
+    const ApproxCountDistinctOptions& options);
+
+/// \brief Estimate the number of distinct non-null values of an array with a
+/// HyperLogLog sketch
+///
+/// Memory use is bounded by the sketch size regardless of the number of values.
+/// The result is an int64 scalar, or a binary scalar if options.output_sketch.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxCountDistinctOptions for more information
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[out] out resulting datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxCountDistinct(FunctionContext* ctx,
+                           const ApproxCountDistinctOptions& options, const Datum& value,
+                           Datum* out);
+
+/// \class ApproxQuantileOptions
+///
+/// The user can control the ApproxQuantile kernel behavior with this class. By
+/// default, it estimates the median.
+struct ARROW_EXPORT ApproxQuantileOptions {
+  explicit ApproxQuantileOptions(
+      std::vector<double> quantiles = {0.5},
+      uint32_t compression = util::TDigest::kDefaultCompression,
+      bool output_sketch = false)
+      : quantiles(std::move(quantiles)),
+        compression(compression),
+        output_sketch(output_sketch) {}
+
+  /// The quantiles to estimate, each in [0, 1]
+  std::vector<double> quantiles;
+  /// The t-digest compression: higher values are more accurate and use more memory
+  uint32_t compression;
+  /// If true, output the serialized sketch as a binary scalar instead of the
+  /// quantiles, so that it can be merged with sketches computed elsewhere
+  bool output_sketch;
+};
+
+/// \brief Return an approximate quantile aggregate
+///
+/// \param[in] type required to specialize the kernel
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxQuantileOptions for more information
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+std::shared_ptr<AggregateFunction> MakeApproxQuantileAggregateFunction(
+    const DataType& type, FunctionContext* ctx, const ApproxQuantileOptions& options);
+
+/// \brief Estimate quantiles of the non-null values of a numeric array with a
+/// t-digest sketch
+///
+/// The result is a collection of double scalars, one per requested quantile,
+/// which are null if there are no values. If options.output_sketch, the result
+/// is a binary scalar instead.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] options see ApproxQuantileOptions for more information
+/// \param[in] value input datum, expecting Array or ChunkedArray
+/// \param[out] out resulting datum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status ApproxQuantile(FunctionContext* ctx, const ApproxQuantileOptions& options,
+                      const Datum& value, Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
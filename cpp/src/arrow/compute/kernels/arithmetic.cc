@@ -0,0 +1,731 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/arithmetic.h"
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+
+namespace compute {
+
+namespace {
+
+template <typename T, typename R = T>
+using EnableIfSigned = typename std::enable_if<
+    std::is_integral<T>::value && std::is_signed<T>::value, R>::type;
+
+template <typename T, typename R = T>
+using EnableIfUnsigned = typename std::enable_if<
+    std::is_integral<T>::value && std::is_unsigned<T>::value, R>::type;
+
+template <typename T, typename R = T>
+using EnableIfFloating =
+    typename std::enable_if<std::is_floating_point<T>::value, R>::type;
+
+// Unsigned integers at least as wide as int, so that arithmetic on them wraps around
+// without undefined behaviour even for narrow types (which would be promoted to int)
+template <typename T>
+using WrappingType =
+    typename std::conditional<(sizeof(T) < sizeof(unsigned int)), unsigned int,
+                              typename std::make_unsigned<T>::type>::type;
+
+// Integers which can hold the product of any two T (for T narrower than 64 bits)
+template <typename T>
+using WideType = typename std::conditional<std::is_signed<T>::value, int64_t,
+                                           uint64_t>::type;
+
+template <typename T>
+T WrappingNegate(T value) {
+  return static_cast<T>(0U - static_cast<WrappingType<T>>(value));
+}
+
+Status OverflowStatus() { return Status::Invalid("overflow"); }
+
+// Each binary operation provides
+// - Call, which never has undefined behaviour: integers wrap around on overflow and
+//   results which are errors (such as division by zero) are arbitrary
+// - IsError<kCheckOverflow>, whether Call's result for these arguments is an error
+// - ErrorStatus, the error to raise for arguments which are an error
+
+struct AddOp {
+  template <typename T>
+  static EnableIfSigned<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) +
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) +
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static EnableIfFloating<T> Call(T left, T right) {
+    return left + right;
+  }
+
+  template <typename T>
+  static EnableIfSigned<T, bool> Overflows(T left, T right) {
+    // The sum's sign differs from both arguments'
+    const T result = Call(left, right);
+    return ((left ^ result) & (right ^ result)) < 0;
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T, bool> Overflows(T left, T right) {
+    return Call(left, right) < left;
+  }
+
+  template <typename T>
+  static EnableIfFloating<T, bool> Overflows(T, T) {
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static bool IsError(T left, T right) {
+    return kCheckOverflow && Overflows(left, right);
+  }
+
+  template <typename T>
+  static Status ErrorStatus(T, T) {
+    return OverflowStatus();
+  }
+};
+
+struct SubtractOp {
+  template <typename T>
+  static EnableIfSigned<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) -
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) -
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static EnableIfFloating<T> Call(T left, T right) {
+    return left - right;
+  }
+
+  template <typename T>
+  static EnableIfSigned<T, bool> Overflows(T left, T right) {
+    // The arguments' signs differ and the difference's sign differs from left's
+    const T result = Call(left, right);
+    return ((left ^ right) & (left ^ result)) < 0;
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T, bool> Overflows(T left, T right) {
+    return left < right;
+  }
+
+  template <typename T>
+  static EnableIfFloating<T, bool> Overflows(T, T) {
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static bool IsError(T left, T right) {
+    return kCheckOverflow && Overflows(left, right);
+  }
+
+  template <typename T>
+  static Status ErrorStatus(T, T) {
+    return OverflowStatus();
+  }
+};
+
+struct MultiplyOp {
+  template <typename T>
+  static EnableIfSigned<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) *
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T> Call(T left, T right) {
+    return static_cast<T>(static_cast<WrappingType<T>>(left) *
+                          static_cast<WrappingType<T>>(right));
+  }
+
+  template <typename T>
+  static EnableIfFloating<T> Call(T left, T right) {
+    return left * right;
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value && (sizeof(T) < 8),
+                                 bool>::type
+  Overflows(T left, T right) {
+    using Wide = WideType<T>;
+    const auto result = static_cast<Wide>(left) * static_cast<Wide>(right);
+    return result != static_cast<T>(result);
+  }
+
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value && (sizeof(T) == 8),
+                                 bool>::type
+  Overflows(T left, T right) {
+    if (left == 0 || right == 0) {
+      return false;
+    }
+    if (std::is_signed<T>::value && (left == T(-1) || right == T(-1))) {
+      // The only product of -1 which overflows is -1 * min
+      return Call(left, right) == std::numeric_limits<T>::min();
+    }
+    return Call(left, right) / right != left;
+  }
+
+  template <typename T>
+  static EnableIfFloating<T, bool> Overflows(T, T) {
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static bool IsError(T left, T right) {
+    return kCheckOverflow && Overflows(left, right);
+  }
+
+  template <typename T>
+  static Status ErrorStatus(T, T) {
+    return OverflowStatus();
+  }
+};
+
+struct DivideOp {
+  template <typename T>
+  static EnableIfSigned<T> Call(T left, T right) {
+    // Dividing min by -1 traps on x86, so negate instead
+    return right == 0 ? 0
+                      : right == -1 ? WrappingNegate(left) : static_cast<T>(left / right);
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T> Call(T left, T right) {
+    return right == 0 ? 0 : static_cast<T>(left / right);
+  }
+
+  template <typename T>
+  static EnableIfFloating<T> Call(T left, T right) {
+    return left / right;
+  }
+
+  template <typename T>
+  static EnableIfSigned<T, bool> Overflows(T left, T right) {
+    return right == -1 && left == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T, bool> Overflows(T, T) {
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static typename std::enable_if<std::is_integral<T>::value, bool>::type IsError(
+      T left, T right) {
+    return right == 0 || (kCheckOverflow && Overflows(left, right));
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static EnableIfFloating<T, bool> IsError(T, T) {
+    return false;
+  }
+
+  template <typename T>
+  static Status ErrorStatus(T, T right) {
+    return right == 0 ? Status::Invalid("divide by zero") : OverflowStatus();
+  }
+};
+
+struct PowerOp {
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value, T>::type Call(T base,
+                                                                           T exponent) {
+    if (IsNegative(exponent)) {
+      return 0;
+    }
+    // Exponentiation by squaring
+    WrappingType<T> result = 1, square = static_cast<WrappingType<T>>(base);
+    for (uint64_t bits = static_cast<uint64_t>(exponent); bits != 0; bits >>= 1) {
+      if (bits & 1) {
+        result *= square;
+      }
+      square *= square;
+    }
+    return static_cast<T>(result);
+  }
+
+  template <typename T>
+  static EnableIfFloating<T> Call(T base, T exponent) {
+    return std::pow(base, exponent);
+  }
+
+  template <typename T>
+  static bool Overflows(T base, T exponent) {
+    if (base == 0 || base == 1 || (std::is_signed<T>::value && base == T(-1))) {
+      return false;
+    }
+    // Otherwise the magnitude at least doubles with every factor, so this overflows
+    // within 64 iterations
+    T result = 1;
+    for (T i = 0; i < exponent; ++i) {
+      if (MultiplyOp::Overflows(result, base)) {
+        return true;
+      }
+      result = MultiplyOp::Call(result, base);
+    }
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static typename std::enable_if<std::is_integral<T>::value, bool>::type IsError(
+      T base, T exponent) {
+    return IsNegative(exponent) || (kCheckOverflow && Overflows(base, exponent));
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static EnableIfFloating<T, bool> IsError(T, T) {
+    return false;
+  }
+
+  template <typename T>
+  static Status ErrorStatus(T, T exponent) {
+    return IsNegative(exponent)
+               ? Status::Invalid("integers to negative integer powers are not allowed")
+               : OverflowStatus();
+  }
+
+  template <typename T>
+  static EnableIfSigned<T, bool> IsNegative(T value) {
+    return value < 0;
+  }
+
+  template <typename T>
+  static typename std::enable_if<
+      !std::is_signed<T>::value || std::is_floating_point<T>::value, bool>::type
+  IsNegative(T) {
+    // Negative floating point exponents are allowed
+    return false;
+  }
+};
+
+// Unary operations provide the same interface as binary operations
+
+struct NegateOp {
+  template <typename T>
+  static typename std::enable_if<std::is_integral<T>::value, T>::type Call(T value) {
+    return WrappingNegate(value);
+  }
+
+  template <typename T>
+  static EnableIfFloating<T> Call(T value) {
+    return -value;
+  }
+
+  template <typename T>
+  static EnableIfSigned<T, bool> Overflows(T value) {
+    return value == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T, bool> Overflows(T value) {
+    return value != 0;
+  }
+
+  template <typename T>
+  static EnableIfFloating<T, bool> Overflows(T) {
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static bool IsError(T value) {
+    return kCheckOverflow && Overflows(value);
+  }
+
+  template <typename T>
+  static Status ErrorStatus(T) {
+    return OverflowStatus();
+  }
+};
+
+struct AbsoluteValueOp {
+  template <typename T>
+  static EnableIfSigned<T> Call(T value) {
+    return value < 0 ? WrappingNegate(value) : value;
+  }
+
+  template <typename T>
+  static EnableIfUnsigned<T> Call(T value) {
+    return value;
+  }
+
+  template <typename T>
+  static EnableIfFloating<T> Call(T value) {
+    return std::fabs(value);
+  }
+
+  template <typename T>
+  static EnableIfSigned<T, bool> Overflows(T value) {
+    return value == std::numeric_limits<T>::min();
+  }
+
+  template <typename T>
+  static typename std::enable_if<
+      !std::is_signed<T>::value || std::is_floating_point<T>::value, bool>::type
+  Overflows(T) {
+    return false;
+  }
+
+  template <bool kCheckOverflow, typename T>
+  static bool IsError(T value) {
+    return kCheckOverflow && Overflows(value);
+  }
+
+  template <typename T>
+  static Status ErrorStatus(T) {
+    return OverflowStatus();
+  }
+};
+
+template <typename T>
+struct ArrayValues {
+  T operator[](int64_t i) const { return values[i]; }
+
+  const T* values;
+};
+
+template <typename T>
+struct ScalarValue {
+  T operator[](int64_t) const { return value; }
+
+  T value;
+};
+
+inline bool IsValid(const ArrayData& out, int64_t i) {
+  return out.buffers[0] == NULLPTR ||
+         BitUtil::GetBit(out.buffers[0]->data(), out.offset + i);
+}
+
+// Op is applied to every slot, null or not, so that the loop has no branches and can
+// be vectorized. Whether any slot is an error is only known after the whole loop.
+template <typename Op, bool kCheckOverflow, typename T, typename Left, typename Right>
+bool ApplyBinaryLoop(Left left, Right right, int64_t length, T* out) {
+  bool any_error = false;
+  for (int64_t i = 0; i < length; ++i) {
+    any_error |= Op::template IsError<kCheckOverflow>(left[i], right[i]);
+    out[i] = Op::Call(left[i], right[i]);
+  }
+  return any_error;
+}
+
+// Compute out's values, whose validity must already be assigned
+template <typename Op, bool kCheckOverflow, typename T, typename Left, typename Right>
+Status ApplyBinary(Left left, Right right, ArrayData* out) {
+  if (!ApplyBinaryLoop<Op, kCheckOverflow>(left, right, out->length,
+                                           out->GetMutableValues<T>(1))) {
+    return Status::OK();
+  }
+  // Null slots hold arbitrary values, so errors may have been reported for them
+  for (int64_t i = 0; i < out->length; ++i) {
+    if (Op::template IsError<kCheckOverflow>(left[i], right[i]) && IsValid(*out, i)) {
+      return Op::ErrorStatus(left[i], right[i]);
+    }
+  }
+  return Status::OK();
+}
+
+template <typename Op, typename T, typename Left, typename Right>
+Status ApplyBinary(bool check_overflow, Left left, Right right, ArrayData* out) {
+  return check_overflow ? ApplyBinary<Op, true, T>(left, right, out)
+                        : ApplyBinary<Op, false, T>(left, right, out);
+}
+
+template <typename Op, bool kCheckOverflow, typename T>
+bool ApplyUnaryLoop(const T* values, int64_t length, T* out) {
+  bool any_error = false;
+  for (int64_t i = 0; i < length; ++i) {
+    any_error |= Op::template IsError<kCheckOverflow>(values[i]);
+    out[i] = Op::Call(values[i]);
+  }
+  return any_error;
+}
+
+template <typename Op, bool kCheckOverflow, typename T>
+Status ApplyUnary(const T* values, ArrayData* out) {
+  if (!ApplyUnaryLoop<Op, kCheckOverflow>(values, out->length,
+                                          out->GetMutableValues<T>(1))) {
+    return Status::OK();
+  }
+  for (int64_t i = 0; i < out->length; ++i) {
+    if (Op::template IsError<kCheckOverflow>(values[i]) && IsValid(*out, i)) {
+      return Op::ErrorStatus(values[i]);
+    }
+  }
+  return Status::OK();
+}
+
+// The kernels write into preallocated values, so they can be executed in morsels
+
+template <typename Op, typename ArrowType>
+class ArithmeticArrayArrayKernel : public BinaryKernel {
+  using T = typename ArrowType::c_type;
+
+ public:
+  ArithmeticArrayArrayKernel(std::shared_ptr<DataType> type, ArithmeticOptions options)
+      : type_(std::move(type)), options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    const ArrayData& left_data = *left.array();
+    const ArrayData& right_data = *right.array();
+    ArrayData* result = out->array().get();
+
+    RETURN_NOT_OK(detail::AssignNullIntersection(ctx, left_data, right_data, result));
+    return ApplyBinary<Op, T>(options_.check_overflow,
+                              ArrayValues<T>{left_data.GetValues<T>(1)},
+                              ArrayValues<T>{right_data.GetValues<T>(1)}, result);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  ArithmeticOptions options_;
+};
+
+// A binary operation with one argument bound to a scalar
+template <typename Op, typename ArrowType>
+class ArithmeticArrayScalarKernel : public UnaryKernel {
+  using T = typename ArrowType::c_type;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+ public:
+  ArithmeticArrayScalarKernel(std::shared_ptr<DataType> type, const Scalar& scalar,
+                              bool scalar_on_left, ArithmeticOptions options)
+      : type_(std::move(type)),
+        scalar_(checked_cast<const ScalarType&>(scalar)),
+        scalar_on_left_(scalar_on_left),
+        options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& array = *input.array();
+    ArrayData* result = out->array().get();
+
+    if (!scalar_.is_valid) {
+      return detail::SetAllNulls(ctx, array, result);
+    }
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, result));
+
+    const ArrayValues<T> values{array.GetValues<T>(1)};
+    const ScalarValue<T> scalar{scalar_.value};
+    if (scalar_on_left_) {
+      return ApplyBinary<Op, T>(options_.check_overflow, scalar, values, result);
+    }
+    return ApplyBinary<Op, T>(options_.check_overflow, values, scalar, result);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  const ScalarType& scalar_;
+  bool scalar_on_left_;
+  ArithmeticOptions options_;
+};
+
+template <typename Op, typename ArrowType>
+class ArithmeticUnaryKernel : public UnaryKernel {
+  using T = typename ArrowType::c_type;
+
+ public:
+  ArithmeticUnaryKernel(std::shared_ptr<DataType> type, ArithmeticOptions options)
+      : type_(std::move(type)), options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& array = *input.array();
+    ArrayData* result = out->array().get();
+
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, result));
+    return options_.check_overflow
+               ? ApplyUnary<Op, true>(array.GetValues<T>(1), result)
+               : ApplyUnary<Op, false>(array.GetValues<T>(1), result);
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  ArithmeticOptions options_;
+};
+
+Status InvokeUnary(FunctionContext* ctx, UnaryKernel* kernel, const Datum& value,
+                   Datum* out) {
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernelInMorsels(ctx, kernel, value, &outputs));
+  *out = detail::WrapDatumsLike(value, outputs);
+  return Status::OK();
+}
+
+template <typename Op>
+struct BinaryExecutor {
+  template <typename ArrowType>
+  static Status Execute(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                        const Datum& left, const Datum& right, ArithmeticOptions options,
+                        Datum* out) {
+    if (left.is_arraylike() && right.is_arraylike()) {
+      ArithmeticArrayArrayKernel<Op, ArrowType> kernel(type, options);
+      return detail::InvokeBinaryArrayKernelInMorsels(ctx, &kernel, left, right, out);
+    }
+    if (left.is_arraylike() && right.is_scalar()) {
+      ArithmeticArrayScalarKernel<Op, ArrowType> kernel(
+          type, *right.scalar(), /*scalar_on_left=*/false, options);
+      return InvokeUnary(ctx, &kernel, left, out);
+    }
+    if (left.is_scalar() && right.is_arraylike()) {
+      ArithmeticArrayScalarKernel<Op, ArrowType> kernel(
+          type, *left.scalar(), /*scalar_on_left=*/true, options);
+      return InvokeUnary(ctx, &kernel, right, out);
+    }
+    return Status::Invalid("Arithmetic requires an array-like argument");
+  }
+};
+
+template <typename Op>
+struct UnaryExecutor {
+  template <typename ArrowType>
+  static Status Execute(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                        const Datum& value, ArithmeticOptions options, Datum* out) {
+    if (!value.is_arraylike()) {
+      return Status::Invalid("Arithmetic requires an array-like argument");
+    }
+    ArithmeticUnaryKernel<Op, ArrowType> kernel(type, options);
+    return InvokeUnary(ctx, &kernel, value, out);
+  }
+};
+
+template <typename Executor, typename... Args>
+Status DispatchNumeric(const std::shared_ptr<DataType>& type, Args&&... args) {
+  switch (type->id()) {
+    case Type::UINT8:
+      return Executor::template Execute<UInt8Type>(std::forward<Args>(args)...);
+    case Type::INT8:
+      return Executor::template Execute<Int8Type>(std::forward<Args>(args)...);
+    case Type::UINT16:
+      return Executor::template Execute<UInt16Type>(std::forward<Args>(args)...);
+    case Type::INT16:
+      return Executor::template Execute<Int16Type>(std::forward<Args>(args)...);
+    case Type::UINT32:
+      return Executor::template Execute<UInt32Type>(std::forward<Args>(args)...);
+    case Type::INT32:
+      return Executor::template Execute<Int32Type>(std::forward<Args>(args)...);
+    case Type::UINT64:
+      return Executor::template Execute<UInt64Type>(std::forward<Args>(args)...);
+    case Type::INT64:
+      return Executor::template Execute<Int64Type>(std::forward<Args>(args)...);
+    case Type::FLOAT:
+      return Executor::template Execute<FloatType>(std::forward<Args>(args)...);
+    case Type::DOUBLE:
+      return Executor::template Execute<DoubleType>(std::forward<Args>(args)...);
+    default:
+      return Status::NotImplemented("Arithmetic not implemented for type ", *type);
+  }
+}
+
+template <typename Op>
+Status ExecuteBinary(FunctionContext* ctx, const Datum& left, const Datum& right,
+                     ArithmeticOptions options, Datum* out) {
+  auto type = left.type();
+  if (type == NULLPTR || right.type() == NULLPTR) {
+    return Status::Invalid("Arithmetic requires array-like or scalar arguments");
+  }
+  if (!type->Equals(right.type())) {
+    return Status::TypeError("Cannot apply arithmetic to data of differing type ", *type,
+                             " vs ", *right.type());
+  }
+  return DispatchNumeric<BinaryExecutor<Op>>(type, ctx, type, left, right, options, out);
+}
+
+template <typename Op>
+Status ExecuteUnary(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+                    Datum* out) {
+  auto type = value.type();
+  if (type == NULLPTR) {
+    return Status::Invalid("Arithmetic requires an array-like argument");
+  }
+  return DispatchNumeric<UnaryExecutor<Op>>(type, ctx, type, value, options, out);
+}
+
+}  // namespace
+
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           ArithmeticOptions options, Datum* out) {
+  return ExecuteBinary<AddOp>(ctx, left, right, options, out);
+}
+
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out) {
+  return ExecuteBinary<SubtractOp>(ctx, left, right, options, out);
+}
+
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out) {
+  return ExecuteBinary<MultiplyOp>(ctx, left, right, options, out);
+}
+
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              ArithmeticOptions options, Datum* out) {
+  return ExecuteBinary<DivideOp>(ctx, left, right, options, out);
+}
+
+Status Power(FunctionContext* ctx, const Datum& base, const Datum& exponent,
+             ArithmeticOptions options, Datum* out) {
+  return ExecuteBinary<PowerOp>(ctx, base, exponent, options, out);
+}
+
+Status Negate(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+              Datum* out) {
+  return ExecuteUnary<NegateOp>(ctx, value, options, out);
+}
+
+Status AbsoluteValue(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+                     Datum* out) {
+  return ExecuteUnary<AbsoluteValueOp>(ctx, value, options, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,118 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Status;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+struct ARROW_EXPORT ArithmeticOptions {
+  ArithmeticOptions() = default;
+
+  explicit ArithmeticOptions(bool check_overflow) : check_overflow(check_overflow) {}
+
+  /// If true, an Invalid status is returned when an integer result overflows.
+  /// Otherwise integer results wrap around.
+  bool check_overflow = false;
+};
+
+/// \brief Add two numeric datums.
+///
+/// Either argument may be a Scalar, the others must be Arrays or ChunkedArrays of
+/// the same length. Both arguments must have the same type, which is also the output
+/// type. A slot of the output is null if either input is null there.
+///
+/// \param[in] ctx the FunctionContext
+/// \param[in] left the augend
+/// \param[in] right the addend
+/// \param[in] options arithmetic options
+/// \param[out] out the sum
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Add(FunctionContext* ctx, const Datum& left, const Datum& right,
+           ArithmeticOptions options, Datum* out);
+
+/// \brief Subtract two numeric datums; see Add for the supported arguments.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Subtract(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out);
+
+/// \brief Multiply two numeric datums; see Add for the supported arguments.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Multiply(FunctionContext* ctx, const Datum& left, const Datum& right,
+                ArithmeticOptions options, Datum* out);
+
+/// \brief Divide two numeric datums; see Add for the supported arguments.
+///
+/// Integer division truncates towards zero, and an integer division by zero
+/// returns an Invalid status whether or not overflow is checked. Floating point
+/// division follows IEEE 754.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Divide(FunctionContext* ctx, const Datum& left, const Datum& right,
+              ArithmeticOptions options, Datum* out);
+
+/// \brief Raise a numeric datum to the power of another; see Add for the
+/// supported arguments.
+///
+/// Raising an integer to a negative power returns an Invalid status.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Power(FunctionContext* ctx, const Datum& base, const Datum& exponent,
+             ArithmeticOptions options, Datum* out);
+
+/// \brief Negate a numeric Array or ChunkedArray.
+///
+/// Negating an unsigned integer wraps around, so with overflow checked only
+/// zero can be negated.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Negate(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+              Datum* out);
+
+/// \brief Compute the absolute value of a numeric Array or ChunkedArray.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AbsoluteValue(FunctionContext* ctx, const Datum& value, ArithmeticOptions options,
+                     Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,122 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/add.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+using BinaryArithmetic = Status (*)(FunctionContext*, const Datum&, const Datum&,
+                                    ArithmeticOptions, Datum*);
+
+// The previous, builder based Add kernel, as a baseline
+static void AddArrayArrayBaseline(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = rand.Int64(array_size, -100, 100, args.null_proportion);
+  auto rhs = rand.Int64(array_size, -100, 100, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(Add(&ctx, *lhs, *rhs, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+template <BinaryArithmetic Op, bool kCheckOverflow>
+static void ArithmeticArrayArray(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = rand.Int64(array_size, -100, 100, args.null_proportion);
+  auto rhs = rand.Int64(array_size, 1, 100, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Op(&ctx, lhs, rhs, ArithmeticOptions(kCheckOverflow), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+template <BinaryArithmetic Op, bool kCheckOverflow>
+static void ArithmeticArrayScalar(benchmark::State& state) {
+  RegressionArgs args(state);
+
+  const int64_t array_size = args.size / sizeof(int64_t);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto lhs = rand.Int64(array_size, -100, 100, args.null_proportion);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(
+        Op(&ctx, lhs, Datum(int64_t(7)), ArithmeticOptions(kCheckOverflow), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void AddArrayArray(benchmark::State& state) {
+  ArithmeticArrayArray<Add, false>(state);
+}
+
+static void AddArrayArrayChecked(benchmark::State& state) {
+  ArithmeticArrayArray<Add, true>(state);
+}
+
+static void AddArrayScalar(benchmark::State& state) {
+  ArithmeticArrayScalar<Add, false>(state);
+}
+
+static void MultiplyArrayArray(benchmark::State& state) {
+  ArithmeticArrayArray<Multiply, false>(state);
+}
+
+static void MultiplyArrayArrayChecked(benchmark::State& state) {
+  ArithmeticArrayArray<Multiply, true>(state);
+}
+
+static void DivideArrayArray(benchmark::State& state) {
+  ArithmeticArrayArray<Divide, false>(state);
+}
+
+BENCHMARK(AddArrayArrayBaseline)->Apply(RegressionSetArgs);
+BENCHMARK(AddArrayArray)->Apply(RegressionSetArgs);
+BENCHMARK(AddArrayArrayChecked)->Apply(RegressionSetArgs);
+BENCHMARK(AddArrayScalar)->Apply(RegressionSetArgs);
+BENCHMARK(MultiplyArrayArray)->Apply(RegressionSetArgs);
+BENCHMARK(MultiplyArrayArrayChecked)->Apply(RegressionSetArgs);
+BENCHMARK(DivideArrayArray)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,378 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/arithmetic.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/scalar.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/int_util.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using internal::checked_cast;
+using internal::checked_pointer_cast;
+
+namespace compute {
+
+using BinaryArithmetic = Status (*)(FunctionContext*, const Datum&, const Datum&,
+                                    ArithmeticOptions, Datum*);
+using UnaryArithmetic = Status (*)(FunctionContext*, const Datum&, ArithmeticOptions,
+                                   Datum*);
+
+template <typename ArrowType>
+class TestArithmetic : public ComputeFixture, public TestBase {
+ protected:
+  using CType = typename ArrowType::c_type;
+
+  static std::shared_ptr<DataType> type() {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+  static CType min() { return std::numeric_limits<CType>::min(); }
+  static CType max() { return std::numeric_limits<CType>::max(); }
+
+  static std::string ToJSON(CType value) {
+    return std::to_string(internal::UpcastInt(value));
+  }
+
+  std::shared_ptr<Array> MakeArray(const std::string& json) {
+    return ArrayFromJSON(type(), json);
+  }
+
+  Datum MakeScalar(CType value) { return Datum(arrow::MakeScalar(value)); }
+
+  // An array with the values of one array and the validity of another
+  std::shared_ptr<Array> WithValidity(const std::string& values_json,
+                                      const std::string& validity_json) {
+    auto data = MakeArray(values_json)->data()->Copy();
+    auto validity = MakeArray(validity_json)->data();
+    data->buffers[0] = validity->buffers[0];
+    data->null_count = validity->null_count;
+    return ::arrow::MakeArray(data);
+  }
+
+  void AssertBinary(BinaryArithmetic op, const Datum& left, const Datum& right,
+                    const std::string& expected, bool check_overflow = false) {
+    Datum out;
+    ASSERT_OK(op(&this->ctx_, left, right, ArithmeticOptions(check_overflow), &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*MakeArray(expected), *actual);
+  }
+
+  void AssertBinaryRaises(BinaryArithmetic op, const Datum& left, const Datum& right,
+                          bool check_overflow = true) {
+    Datum out;
+    ASSERT_RAISES(Invalid,
+                  op(&this->ctx_, left, right, ArithmeticOptions(check_overflow), &out));
+  }
+
+  void AssertUnary(UnaryArithmetic op, const Datum& value, const std::string& expected,
+                   bool check_overflow = false) {
+    Datum out;
+    ASSERT_OK(op(&this->ctx_, value, ArithmeticOptions(check_overflow), &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*MakeArray(expected), *actual);
+  }
+
+  void AssertUnaryRaises(UnaryArithmetic op, const Datum& value) {
+    Datum out;
+    ASSERT_RAISES(Invalid, op(&this->ctx_, value, ArithmeticOptions(true), &out));
+  }
+};
+
+template <typename ArrowType>
+class TestArithmeticNumeric : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticNumeric, NumericArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticIntegral : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticIntegral, IntegralArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticSigned : public TestArithmetic<ArrowType> {};
+using SignedArrowTypes = ::testing::Types<Int8Type, Int16Type, Int32Type, Int64Type>;
+TYPED_TEST_CASE(TestArithmeticSigned, SignedArrowTypes);
+
+template <typename ArrowType>
+class TestArithmeticReal : public TestArithmetic<ArrowType> {};
+TYPED_TEST_CASE(TestArithmeticReal, RealArrowTypes);
+
+TYPED_TEST(TestArithmeticNumeric, ArrayArray) {
+  for (bool check_overflow : {false, true}) {
+    this->AssertBinary(Add, this->MakeArray("[]"), this->MakeArray("[]"), "[]",
+                       check_overflow);
+    this->AssertBinary(Add, this->MakeArray("[1, 2, null, 4]"),
+                       this->MakeArray("[4, null, 2, 1]"), "[5, null, null, 5]",
+                       check_overflow);
+    this->AssertBinary(Subtract, this->MakeArray("[5, 4, null, 3]"),
+                       this->MakeArray("[1, 2, 3, null]"), "[4, 2, null, null]",
+                       check_overflow);
+    this->AssertBinary(Multiply, this->MakeArray("[1, 2, 3, null]"),
+                       this->MakeArray("[4, 5, 6, 7]"), "[4, 10, 18, null]",
+                       check_overflow);
+    this->AssertBinary(Divide, this->MakeArray("[8, 9, null, 10]"),
+                       this->MakeArray("[2, 3, 4, 5]"), "[4, 3, null, 2]",
+                       check_overflow);
+    this->AssertBinary(Power, this->MakeArray("[2, 3, null, 1, 0]"),
+                       this->MakeArray("[3, 2, 2, 0, 0]"), "[8, 9, null, 1, 1]",
+                       check_overflow);
+  }
+}
+
+TYPED_TEST(TestArithmeticNumeric, ArrayScalar) {
+  this->AssertBinary(Add, this->MakeArray("[1, 2, null]"), this->MakeScalar(2),
+                     "[3, 4, null]");
+  this->AssertBinary(Subtract, this->MakeScalar(10), this->MakeArray("[1, 2, null]"),
+                     "[9, 8, null]");
+  this->AssertBinary(Subtract, this->MakeArray("[10, 9, null]"), this->MakeScalar(1),
+                     "[9, 8, null]");
+  this->AssertBinary(Divide, this->MakeScalar(12), this->MakeArray("[1, 2, null]"),
+                     "[12, 6, null]");
+  this->AssertBinary(Power, this->MakeArray("[1, 2, null]"), this->MakeScalar(2),
+                     "[1, 4, null]");
+
+  // A null scalar makes every slot null
+  Datum null_scalar(MakeNullScalar(this->type()));
+  this->AssertBinary(Multiply, this->MakeArray("[1, 2, null]"), null_scalar,
+                     "[null, null, null]");
+  this->AssertBinary(Multiply, null_scalar, this->MakeArray("[1, 2, null]"),
+                     "[null, null, null]");
+}
+
+TYPED_TEST(TestArithmeticNumeric, ChunkedArrays) {
+  auto left = std::make_shared<ChunkedArray>(
+      ArrayVector{this->MakeArray("[1, 2]"), this->MakeArray("[null, 4, 5]")});
+  auto right = std::make_shared<ChunkedArray>(
+      ArrayVector{this->MakeArray("[1]"), this->MakeArray("[2, 3, null, 5]")});
+
+  Datum out;
+  ASSERT_OK(Add(&this->ctx_, left, right, ArithmeticOptions(), &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  AssertChunkedEqual(*out.chunked_array(),
+                     {this->MakeArray("[2]"), this->MakeArray("[4]"),
+                      this->MakeArray("[null, null, 10]")});
+
+  ASSERT_OK(Multiply(&this->ctx_, left, this->MakeScalar(2), ArithmeticOptions(), &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  AssertChunkedEqual(*out.chunked_array(),
+                     {this->MakeArray("[2, 4]"), this->MakeArray("[null, 8, 10]")});
+}
+
+TYPED_TEST(TestArithmeticNumeric, AbsoluteValue) {
+  for (bool check_overflow : {false, true}) {
+    this->AssertUnary(AbsoluteValue, this->MakeArray("[]"), "[]", check_overflow);
+    this->AssertUnary(AbsoluteValue, this->MakeArray("[1, null, 0, 7]"),
+                      "[1, null, 0, 7]", check_overflow);
+  }
+}
+
+TYPED_TEST(TestArithmeticNumeric, InvalidArguments) {
+  Datum out;
+  ASSERT_RAISES(TypeError, Add(&this->ctx_, this->MakeArray("[1]"),
+                               ArrayFromJSON(utf8(), R"(["a"])"), ArithmeticOptions(),
+                               &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, this->MakeScalar(1), this->MakeScalar(1),
+                             ArithmeticOptions(), &out));
+  ASSERT_RAISES(Invalid, Add(&this->ctx_, this->MakeArray("[1, 2]"),
+                             this->MakeArray("[1]"), ArithmeticOptions(), &out));
+  ASSERT_RAISES(NotImplemented,
+                Negate(&this->ctx_, ArrayFromJSON(utf8(), R"(["a"])"),
+                       ArithmeticOptions(), &out));
+}
+
+TYPED_TEST(TestArithmeticIntegral, Overflow) {
+  const auto max = this->ToJSON(this->max());
+  const auto min = this->ToJSON(this->min());
+
+  this->AssertBinary(Add, this->MakeArray("[" + max + ", 1]"), this->MakeScalar(1),
+                     "[" + min + ", 2]");
+  this->AssertBinaryRaises(Add, this->MakeArray("[" + max + ", 1]"), this->MakeScalar(1));
+
+  this->AssertBinary(Subtract, this->MakeArray("[" + min + ", 1]"),
+                     this->MakeArray("[1, 1]"), "[" + max + ", 0]");
+  this->AssertBinaryRaises(Subtract, this->MakeArray("[" + min + ", 1]"),
+                           this->MakeArray("[1, 1]"));
+
+  this->AssertBinary(Multiply, this->MakeArray("[" + max + ", 1]"),
+                     this->MakeArray("[1, 1]"), "[" + max + ", 1]", true);
+  this->AssertBinaryRaises(Multiply, this->MakeArray("[" + max + ", 1]"),
+                           this->MakeArray("[2, 1]"));
+
+  this->AssertBinaryRaises(Power, this->MakeArray("[2]"), this->MakeScalar(64));
+  this->AssertBinary(Power, this->MakeArray("[2]"), this->MakeScalar(64), "[0]");
+
+  // Overflow in null slots is ignored
+  this->AssertBinary(Add, this->WithValidity("[" + max + ", 1]", "[null, 1]"),
+                     this->MakeArray("[1, 1]"), "[null, 2]", true);
+  this->AssertBinary(Multiply, this->MakeArray("[" + max + ", 1]"),
+                     this->WithValidity("[2, 1]", "[null, 1]"), "[null, 1]", true);
+}
+
+TYPED_TEST(TestArithmeticIntegral, DivideByZero) {
+  for (bool check_overflow : {false, true}) {
+    this->AssertBinaryRaises(Divide, this->MakeArray("[1, 2]"), this->MakeArray("[1, 0]"),
+                             check_overflow);
+    this->AssertBinaryRaises(Divide, this->MakeArray("[1, 2]"), this->MakeScalar(0),
+                             check_overflow);
+    // Null divisors are never an error
+    this->AssertBinary(Divide, this->MakeArray("[1, 2]"), this->MakeArray("[null, 1]"),
+                       "[null, 2]", check_overflow);
+    this->AssertBinary(Divide, this->MakeArray("[1, null]"),
+                       this->WithValidity("[1, 0]", "[1, null]"), "[1, null]",
+                       check_overflow);
+  }
+}
+
+TYPED_TEST(TestArithmeticSigned, Negate) {
+  const auto max = this->ToJSON(this->max());
+  const auto min = this->ToJSON(this->min());
+
+  this->AssertUnary(Negate, this->MakeArray("[1, -2, null, 0, " + max + "]"),
+                    "[-1, 2, null, 0, -" + max + "]", true);
+  this->AssertUnary(Negate, this->MakeArray("[" + min + "]"), "[" + min + "]");
+  this->AssertUnaryRaises(Negate, this->MakeArray("[" + min + "]"));
+
+  this->AssertUnary(AbsoluteValue, this->MakeArray("[1, -2, null, 0]"), "[1, 2, null, 0]",
+                    true);
+  this->AssertUnary(AbsoluteValue, this->MakeArray("[" + min + "]"), "[" + min + "]");
+  this->AssertUnaryRaises(AbsoluteValue, this->MakeArray("[" + min + "]"));
+}
+
+TYPED_TEST(TestArithmeticSigned, Divide) {
+  const auto min = this->ToJSON(this->min());
+
+  this->AssertBinary(Divide, this->MakeArray("[7, -7, 7, -7]"),
+                     this->MakeArray("[2, 2, -2, -2]"), "[3, -3, -3, 3]");
+  this->AssertBinary(Divide, this->MakeArray("[" + min + "]"), this->MakeScalar(-1),
+                     "[" + min + "]");
+  this->AssertBinaryRaises(Divide, this->MakeArray("[" + min + "]"),
+                           this->MakeScalar(-1));
+}
+
+TYPED_TEST(TestArithmeticSigned, Power) {
+  this->AssertBinary(Power, this->MakeArray("[-2, -2, -1, -1]"),
+                     this->MakeArray("[3, 2, 5, 6]"), "[-8, 4, -1, 1]", true);
+  for (bool check_overflow : {false, true}) {
+    this->AssertBinaryRaises(Power, this->MakeArray("[2]"), this->MakeScalar(-1),
+                             check_overflow);
+  }
+}
+
+TYPED_TEST(TestArithmeticReal, Special) {
+  this->AssertUnary(Negate, this->MakeArray("[1.5, -2, null, 0]"), "[-1.5, 2, null, -0]");
+  this->AssertUnary(AbsoluteValue, this->MakeArray("[1.5, -2, null]"), "[1.5, 2, null]");
+  this->AssertBinary(Power, this->MakeArray("[4, 2]"), this->MakeArray("[0.5, -1]"),
+                     "[2, 0.5]");
+
+  // Floating point division by zero follows IEEE 754
+  Datum out;
+  ASSERT_OK(Divide(&this->ctx_, this->MakeArray("[1, -1]"), this->MakeScalar(0),
+                   ArithmeticOptions(true), &out));
+  const auto& quotients = checked_cast<const NumericArray<TypeParam>&>(*out.make_array());
+  ASSERT_TRUE(std::isinf(quotients.Value(0)) && quotients.Value(0) > 0);
+  ASSERT_TRUE(std::isinf(quotients.Value(1)) && quotients.Value(1) < 0);
+}
+
+class TestArithmeticRandom : public ComputeFixture, public TestBase {
+ protected:
+  // The expected wrapping int32 results, computed one slot at a time
+  template <typename Op>
+  std::shared_ptr<Array> Expected(const Int32Array& left, const Int32Array& right,
+                                  Op&& op) {
+    Int32Builder builder;
+    for (int64_t i = 0; i < left.length(); ++i) {
+      if (left.IsNull(i) || right.IsNull(i)) {
+        ABORT_NOT_OK(builder.AppendNull());
+      } else {
+        ABORT_NOT_OK(builder.Append(static_cast<int32_t>(
+            static_cast<uint32_t>(op(int64_t(left.Value(i)), int64_t(right.Value(i)))))));
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+    return out;
+  }
+
+  std::shared_ptr<ChunkedArray> Chunk(const std::shared_ptr<Array>& array,
+                                      const std::vector<int64_t>& lengths) {
+    ArrayVector chunks;
+    int64_t offset = 0;
+    for (auto length : lengths) {
+      chunks.push_back(array->Slice(offset, length));
+      offset += length;
+    }
+    return std::make_shared<ChunkedArray>(chunks);
+  }
+
+  random::RandomArrayGenerator rand_{0x7e57};
+};
+
+TEST_F(TestArithmeticRandom, ChunkedInMorsels) {
+  const int64_t length = 1000;
+  auto left = checked_pointer_cast<Int32Array>(
+      rand_.Int32(length + 3, -(1 << 30), 1 << 30, 0.1)->Slice(3));
+  auto right =
+      checked_pointer_cast<Int32Array>(rand_.Int32(length, -(1 << 30), 1 << 30, 0.1));
+  auto left_chunked = Chunk(left, {0, 300, 7, 693});
+  auto right_chunked = Chunk(right, {500, 500});
+
+  auto add = Expected(*left, *right, [](int64_t l, int64_t r) { return l + r; });
+  auto multiply = Expected(*left, *right, [](int64_t l, int64_t r) {
+    return static_cast<int64_t>(static_cast<uint64_t>(l) * static_cast<uint64_t>(r));
+  });
+
+  for (bool use_threads : {false, true}) {
+    ctx_.set_use_threads(use_threads);
+    ctx_.set_morsel_length(64);
+
+    Datum out;
+    ASSERT_OK(Add(&ctx_, left_chunked, right_chunked, ArithmeticOptions(), &out));
+    ASSERT_OK(out.chunked_array()->ValidateFull());
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({add})));
+
+    ASSERT_OK(Multiply(&ctx_, left_chunked, right_chunked, ArithmeticOptions(), &out));
+    ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray({multiply})));
+    ASSERT_RAISES(Invalid, Multiply(&ctx_, left_chunked, right_chunked,
+                                    ArithmeticOptions(true), &out));
+
+    ASSERT_OK(Add(&ctx_, left, right, ArithmeticOptions(), &out));
+    AssertArraysEqual(*add, *out.make_array());
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
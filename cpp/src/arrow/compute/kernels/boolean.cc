@@ -70,10 +70,9 @@ class InvertKernel : public BooleanUnaryKernel {
 
 Status Invert(FunctionContext* ctx, const Datum& value, Datum* out) {
   InvertKernel invert;
-  detail::PrimitiveAllocatingUnaryKernel kernel(&invert);
 
   std::vector<Datum> result;
-  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, &kernel, value, &result));
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernelInMorsels(ctx, &invert, value, &result));
 
   *out = detail::WrapDatumsLike(value, result);
   return Status::OK();
@@ -191,8 +190,7 @@ class AndKernel : public BinaryBooleanKernel {
 
 Status And(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
   AndKernel and_kernel(ResolveNull::PROPAGATE);
-  detail::PrimitiveAllocatingBinaryKernel kernel(&and_kernel);
-  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
+  return detail::InvokeBinaryArrayKernelInMorsels(ctx, &and_kernel, left, right, out);
 }
 
 Status KleeneAnd(FunctionContext* ctx, const Datum& left, const Datum& right,
@@ -232,8 +230,7 @@ class OrKernel : public BinaryBooleanKernel {
 
 Status Or(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
   OrKernel or_kernel(ResolveNull::PROPAGATE);
-  detail::PrimitiveAllocatingBinaryKernel kernel(&or_kernel);
-  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
+  return detail::InvokeBinaryArrayKernelInMorsels(ctx, &or_kernel, left, right, out);
 }
 
 Status KleeneOr(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
@@ -260,8 +257,7 @@ class XorKernel : public BinaryBooleanKernel {
 
 Status Xor(FunctionContext* ctx, const Datum& left, const Datum& right, Datum* out) {
   XorKernel xor_kernel;
-  detail::PrimitiveAllocatingBinaryKernel kernel(&xor_kernel);
-  return detail::InvokeBinaryArrayKernel(ctx, &kernel, left, right, out);
+  return detail::InvokeBinaryArrayKernelInMorsels(ctx, &xor_kernel, left, right, out);
 }
 
 }  // namespace compute
@@ -919,6 +919,29 @@ struct CastFunctor<T, DictionaryType> {
 // ----------------------------------------------------------------------
 // String to Number
 
+// Parse all values of a string-like array in a single pass over its raw
+// offsets and data, reporting the first value that failed to parse
+template <typename I, typename Converter>
+void ConvertStrings(FunctionContext* ctx, const ArrayData& input, Converter* converter,
+                    typename Converter::value_type* out_data,
+                    const DataType& out_type) {
+  using offset_type = typename I::offset_type;
+
+  const offset_type* offsets = input.GetValues<offset_type>(1);
+  const uint8_t* data = input.buffers[2] ? input.buffers[2]->data() : NULLPTR;
+  const uint8_t* null_bitmap =
+      input.GetNullCount() != 0 ? input.buffers[0]->data() : NULLPTR;
+
+  const int64_t failed = internal::ConvertStrings(
+      converter, offsets, data, null_bitmap, input.offset, input.length, out_data);
+  if (ARROW_PREDICT_FALSE(failed != input.length)) {
+    const util::string_view str(reinterpret_cast<const char*>(data + offsets[failed]),
+                                offsets[failed + 1] - offsets[failed]);
+    ctx->SetStatus(Status::Invalid("Failed to cast String '", str, "' into ",
+                                   out_type.ToString(), " (at index ", failed, ")"));
+  }
+}
+
 template <typename I, typename O>
 struct CastFunctor<
     O, I, enable_if_t<is_string_like_type<I>::value && is_number_type<O>::value>> {
@@ -926,22 +949,9 @@ struct CastFunctor<
                   const ArrayData& input, ArrayData* output) {
     using out_type = typename O::c_type;
 
-    typename TypeTraits<I>::ArrayType input_array(input.Copy());
     auto out_data = output->GetMutableValues<out_type>(1);
     internal::StringConverter<O> converter;
-
-    for (int64_t i = 0; i < input.length; ++i, ++out_data) {
-      if (input_array.IsNull(i)) {
-        continue;
-      }
-
-      auto str = input_array.GetView(i);
-      if (!converter(str.data(), str.length(), out_data)) {
-        ctx->SetStatus(Status::Invalid("Failed to cast String '", str, "' into ",
-                                       output->type->ToString()));
-        return;
-      }
-    }
+    ConvertStrings<I>(ctx, input, &converter, out_data, *output->type);
   }
 };
 
@@ -992,22 +1002,9 @@ struct CastFunctor<TimestampType, I, enable_if_t<is_string_like_type<I>::value>>
                   const ArrayData& input, ArrayData* output) {
     using out_type = TimestampType::c_type;
 
-    typename TypeTraits<I>::ArrayType input_array(input.Copy());
     auto out_data = output->GetMutableValues<out_type>(1);
     internal::StringConverter<TimestampType> converter(output->type);
-
-    for (int64_t i = 0; i < input.length; ++i, ++out_data) {
-      if (input_array.IsNull(i)) {
-        continue;
-      }
-
-      const auto str = input_array.GetView(i);
-      if (!converter(str.data(), str.length(), out_data)) {
-        ctx->SetStatus(Status::Invalid("Failed to cast String '", str, "' into ",
-                                       output->type->ToString()));
-        return;
-      }
-    }
+    ConvertStrings<I>(ctx, input, &converter, out_data, *output->type);
   }
 };
 
@@ -1268,6 +1265,12 @@ inline bool IsZeroCopyCast(Type::type in_type, Type::type out_type) {
   return false;
 }
 
+inline bool IsNumericCast(const DataType& in_type, const DataType& out_type) {
+  auto is_numeric = [](Type::type id) { return is_integer(id) || is_floating(id); };
+  return is_numeric(in_type.id()) && is_numeric(out_type.id()) &&
+         !in_type.Equals(out_type);
+}
+
 Status GetCastFunction(const DataType& in_type, std::shared_ptr<DataType> out_type,
                        const CastOptions& options, std::unique_ptr<UnaryKernel>* kernel) {
   if (in_type.Equals(out_type)) {
@@ -1337,6 +1340,17 @@ Status Cast(FunctionContext* ctx, const Datum& value, std::shared_ptr<DataType>
   // Dynamic dispatch to obtain right cast function
   std::unique_ptr<UnaryKernel> func;
   RETURN_NOT_OK(GetCastFunction(in_type, std::move(out_type), options, &func));
+
+  if (IsNumericCast(in_type, *func->out_type())) {
+    // Numeric casts only write into their preallocated output, so they can be
+    // executed on morsels in parallel
+    std::vector<Datum> result;
+    RETURN_NOT_OK(
+        detail::InvokeUnaryArrayKernelInMorsels(ctx, func.get(), value, &result));
+    ARROW_RETURN_IF_ERROR(ctx);
+    *out = detail::WrapDatumsLike(value, result);
+    return Status::OK();
+  }
   return InvokeWithAllocation(ctx, func.get(), value, out);
 }
 
@@ -1219,6 +1219,24 @@ TEST_F(TestCast, StringToNumberErrors) {
   CheckFails<StringType, std::string>(utf8(), {"z"}, is_valid, float32(), options);
 }
 
+TEST_F(TestCast, StringToNumberErrorIndex) {
+  std::shared_ptr<Array> result;
+  auto input = ArrayFromJSON(utf8(), R"(["1", null, "2", "x", "y"])");
+  ASSERT_RAISES_WITH_MESSAGE(
+      Invalid, "Invalid: Failed to cast String 'x' into int32 (at index 3)",
+      Cast(&ctx_, *input, int32(), CastOptions(), &result));
+  // Index is relative to the start of a sliced array
+  ASSERT_RAISES_WITH_MESSAGE(
+      Invalid, "Invalid: Failed to cast String 'x' into double (at index 1)",
+      Cast(&ctx_, *input->Slice(2), float64(), CastOptions(), &result));
+
+  input = ArrayFromJSON(utf8(), R"(["1970-01-01", null, "1970-01-0x"])");
+  ASSERT_RAISES_WITH_MESSAGE(
+      Invalid,
+      "Invalid: Failed to cast String '1970-01-0x' into timestamp[s] (at index 2)",
+      Cast(&ctx_, *input, timestamp(TimeUnit::SECOND), CastOptions(), &result));
+}
+
 TEST_F(TestCast, StringToTimestamp) { TestCastStringToTimestamp<StringType>(); }
 
 TEST_F(TestCast, LargeStringToTimestamp) { TestCastStringToTimestamp<LargeStringType>(); }
@@ -17,16 +17,24 @@
 
 #include "arrow/compute/kernels/compare.h"
 
+#include <cstring>
+#include <type_traits>
+
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/scalar.h"
 #include "arrow/util/bit_util.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/string_view.h"
 
 namespace arrow {
 
 namespace compute {
 
+using internal::checked_cast;
+
 std::shared_ptr<DataType> CompareBinaryKernel::out_type() const {
   return compare_function_->out_type();
 }
@@ -57,45 +65,117 @@ Status CompareBinaryKernel::Call(FunctionContext* ctx, const Datum& left,
   return Status::Invalid("Invalid datum signature for CompareBinaryKernel");
 }
 
-template <typename ArrowType, CompareOperator Op,
-          typename ScalarType = typename TypeTraits<ArrowType>::ScalarType,
-          typename T = typename TypeTraits<ArrowType>::CType>
-static Status CompareArrayScalar(const ArrayData& array, const ScalarType& scalar,
+// Comparisons are evaluated in blocks of values, one byte per value, in a
+// loop which the compiler can vectorize.  The bytes of each block are then
+// packed eight at a time into the output bitmap.
+constexpr int64_t kCompareBlockSize = 64;
+
+// Pack eight bytes holding 0 or 1 into the bits of a single byte: the
+// multiplication moves the low bit of byte i to bit 56 + i, without carries.
+static inline uint8_t PackBooleanBytes(const uint8_t* bytes) {
+  uint64_t word;
+  std::memcpy(&word, bytes, sizeof(word));
+  word = BitUtil::FromLittleEndian(word);
+  return static_cast<uint8_t>((word * 0x0102040810204080ULL) >> 56);
+}
+
+template <typename Predicate>
+static void GenerateComparisonBitmap(int64_t length, uint8_t* output_bitmap,
+                                     Predicate&& predicate) {
+  int64_t i = 0;
+  uint8_t* out = output_bitmap;
+  for (; i + kCompareBlockSize <= length; i += kCompareBlockSize) {
+    uint8_t bytes[kCompareBlockSize];
+    for (int64_t j = 0; j < kCompareBlockSize; ++j) {
+      bytes[j] = static_cast<uint8_t>(predicate(i + j));
+    }
+    for (int64_t j = 0; j < kCompareBlockSize; j += 8) {
+      *out++ = PackBooleanBytes(bytes + j);
+    }
+  }
+  internal::GenerateBitsUnrolled(output_bitmap, i, length - i,
+                                 [&]() -> bool { return predicate(i++); });
+}
+
+// Access to the values of arrays and scalars of a comparable type
+template <typename ArrowType, typename Enable = void>
+struct CompareTraits {
+  using T = typename TypeTraits<ArrowType>::CType;
+  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
+
+  static const T* ArrayValues(const ArrayData& array) { return array.GetValues<T>(1); }
+
+  static T ScalarValue(const Scalar& scalar) {
+    return checked_cast<const ScalarType&>(scalar).value;
+  }
+};
+
+// Fixed size binary values compare lexicographically, as unsigned bytes
+template <typename ArrowType>
+struct CompareTraits<ArrowType,
+                     enable_if_t<std::is_same<ArrowType, FixedSizeBinaryType>::value>> {
+  using T = util::string_view;
+
+  struct Values {
+    T operator[](int64_t i) const {
+      return T(reinterpret_cast<const char*>(data + i * width), width);
+    }
+
+    const uint8_t* data;
+    int32_t width;
+  };
+
+  static Values ArrayValues(const ArrayData& array) {
+    const int32_t width =
+        checked_cast<const FixedSizeBinaryType&>(*array.type).byte_width();
+    return {array.buffers[1]->data() + array.offset * width, width};
+  }
+
+  static T ScalarValue(const Scalar& scalar) {
+    return util::string_view(*checked_cast<const FixedSizeBinaryScalar&>(scalar).value);
+  }
+};
+
+template <typename ArrowType, CompareOperator Op>
+static Status CompareArrayScalar(const ArrayData& array, const Scalar& scalar,
                                  uint8_t* output_bitmap) {
-  const T* left = array.GetValues<T>(1);
-  const T right = scalar.value;
+  using Traits = CompareTraits<ArrowType>;
+  using T = typename Traits::T;
+  const auto left = Traits::ArrayValues(array);
+  const T right = Traits::ScalarValue(scalar);
 
-  internal::GenerateBitsUnrolled(
-      output_bitmap, 0, array.length,
-      [&left, right]() -> bool { return Comparator<T, Op>::Compare(*left++, right); });
+  GenerateComparisonBitmap(array.length, output_bitmap, [left, right](int64_t i) {
+    return Comparator<T, Op>::Compare(left[i], right);
+  });
 
   return Status::OK();
 }
 
-template <typename ArrowType, CompareOperator Op,
-          typename ScalarType = typename TypeTraits<ArrowType>::ScalarType,
-          typename T = typename TypeTraits<ArrowType>::CType>
-static Status CompareScalarArray(const ScalarType& scalar, const ArrayData& array,
+template <typename ArrowType, CompareOperator Op>
+static Status CompareScalarArray(const Scalar& scalar, const ArrayData& array,
                                  uint8_t* output_bitmap) {
-  const T left = scalar.value;
-  const T* right = array.GetValues<T>(1);
+  using Traits = CompareTraits<ArrowType>;
+  using T = typename Traits::T;
+  const T left = Traits::ScalarValue(scalar);
+  const auto right = Traits::ArrayValues(array);
 
-  internal::GenerateBitsUnrolled(
-      output_bitmap, 0, array.length,
-      [left, &right]() -> bool { return Comparator<T, Op>::Compare(left, *right++); });
+  GenerateComparisonBitmap(array.length, output_bitmap, [left, right](int64_t i) {
+    return Comparator<T, Op>::Compare(left, right[i]);
+  });
 
   return Status::OK();
 }
 
-template <typename ArrowType, CompareOperator Op,
-          typename T = typename TypeTraits<ArrowType>::CType>
+template <typename ArrowType, CompareOperator Op>
 static Status CompareArrayArray(const ArrayData& lhs, const ArrayData& rhs,
                                 uint8_t* output_bitmap) {
-  const T* left = lhs.GetValues<T>(1);
-  const T* right = rhs.GetValues<T>(1);
+  using Traits = CompareTraits<ArrowType>;
+  using T = typename Traits::T;
+  const auto left = Traits::ArrayValues(lhs);
+  const auto right = Traits::ArrayValues(rhs);
 
-  internal::GenerateBitsUnrolled(output_bitmap, 0, lhs.length, [&left, &right]() -> bool {
-    return Comparator<T, Op>::Compare(*left++, *right++);
+  GenerateComparisonBitmap(lhs.length, output_bitmap, [left, right](int64_t i) {
+    return Comparator<T, Op>::Compare(left[i], right[i]);
   });
 
   return Status::OK();
@@ -103,9 +183,6 @@ static Status CompareArrayArray(const ArrayData& lhs, const ArrayData& rhs,
 
 template <typename ArrowType, CompareOperator Op>
 class CompareFunctionImpl final : public CompareFunction {
-  using ArrayType = typename TypeTraits<ArrowType>::ArrayType;
-  using ScalarType = typename TypeTraits<ArrowType>::ScalarType;
-
  public:
   explicit CompareFunctionImpl(FunctionContext* ctx) : ctx_(ctx) {}
 
@@ -126,8 +203,7 @@ class CompareFunctionImpl final : public CompareFunction {
     RETURN_NOT_OK(detail::PropagateNulls(ctx_, array, output));
 
     uint8_t* bitmap_result = output->buffers[1]->mutable_data();
-    return CompareArrayScalar<ArrowType, Op>(
-        array, static_cast<const ScalarType&>(scalar), bitmap_result);
+    return CompareArrayScalar<ArrowType, Op>(array, scalar, bitmap_result);
   }
 
   Status Compare(const Scalar& scalar, const ArrayData& array, ArrayData* output) const {
@@ -147,8 +223,7 @@ class CompareFunctionImpl final : public CompareFunction {
     RETURN_NOT_OK(detail::PropagateNulls(ctx_, array, output));
 
     uint8_t* bitmap_result = output->buffers[1]->mutable_data();
-    return CompareScalarArray<ArrowType, Op>(static_cast<const ScalarType&>(scalar),
-                                             array, bitmap_result);
+    return CompareScalarArray<ArrowType, Op>(scalar, array, bitmap_result);
   }
 
   Status Compare(const ArrayData& lhs, const ArrayData& rhs, ArrayData* output) const {
@@ -233,6 +308,8 @@ std::shared_ptr<CompareFunction> MakeCompareFunction(FunctionContext* ctx,
       return MakeCompareFunctionType<Time32Type>(ctx, options);
     case Time64Type::type_id:
       return MakeCompareFunctionType<Time64Type>(ctx, options);
+    case FixedSizeBinaryType::type_id:
+      return MakeCompareFunctionType<FixedSizeBinaryType>(ctx, options);
     default:
       return nullptr;
   }
@@ -263,5 +340,102 @@ Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
   return kernel.Call(context, left, right, out);
 }
 
+// ----------------------------------------------------------------------
+// Between
+
+template <typename ArrowType>
+class BetweenKernel final : public UnaryKernel {
+ public:
+  BetweenKernel(std::shared_ptr<Scalar> lower, std::shared_ptr<Scalar> upper)
+      : lower_(std::move(lower)), upper_(std::move(upper)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    using Traits = CompareTraits<ArrowType>;
+    using T = typename Traits::T;
+    const ArrayData& array = *input.array();
+    ArrayData* output = out->array().get();
+
+    // A null bound makes all comparisons null
+    if (!lower_->is_valid || !upper_->is_valid) {
+      return detail::SetAllNulls(ctx, array, output);
+    }
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, array, output));
+
+    const auto values = Traits::ArrayValues(array);
+    const T lower = Traits::ScalarValue(*lower_);
+    const T upper = Traits::ScalarValue(*upper_);
+    // Both comparisons are evaluated without branching so that they fuse
+    // into a single vectorized pass
+    auto in_range = [values, lower, upper](int64_t i) {
+      return Comparator<T, LESS_EQUAL>::Compare(lower, values[i]) &
+             Comparator<T, LESS>::Compare(values[i], upper);
+    };
+    GenerateComparisonBitmap(array.length, output->buffers[1]->mutable_data(), in_range);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+ private:
+  std::shared_ptr<Scalar> lower_;
+  std::shared_ptr<Scalar> upper_;
+};
+
+static std::unique_ptr<UnaryKernel> MakeBetweenKernel(const DataType& type,
+                                                      std::shared_ptr<Scalar> lower,
+                                                      std::shared_ptr<Scalar> upper) {
+  switch (type.id()) {
+#define BETWEEN_CASE(T)                                                       \
+  case T::type_id:                                                            \
+    return std::unique_ptr<UnaryKernel>(                                      \
+        new BetweenKernel<T>(std::move(lower), std::move(upper)));
+
+    BETWEEN_CASE(UInt8Type)
+    BETWEEN_CASE(Int8Type)
+    BETWEEN_CASE(UInt16Type)
+    BETWEEN_CASE(Int16Type)
+    BETWEEN_CASE(UInt32Type)
+    BETWEEN_CASE(Int32Type)
+    BETWEEN_CASE(UInt64Type)
+    BETWEEN_CASE(Int64Type)
+    BETWEEN_CASE(FloatType)
+    BETWEEN_CASE(DoubleType)
+    BETWEEN_CASE(Date32Type)
+    BETWEEN_CASE(Date64Type)
+    BETWEEN_CASE(TimestampType)
+    BETWEEN_CASE(Time32Type)
+    BETWEEN_CASE(Time64Type)
+    BETWEEN_CASE(FixedSizeBinaryType)
+#undef BETWEEN_CASE
+    default:
+      return nullptr;
+  }
+}
+
+Status Between(FunctionContext* context, const Datum& values, const Datum& lower,
+               const Datum& upper, Datum* out) {
+  DCHECK(out);
+
+  if (values.kind() != Datum::ARRAY) {
+    return Status::Invalid("Between expects an array of values");
+  }
+  if (!lower.is_scalar() || !upper.is_scalar()) {
+    return Status::NotImplemented("Between is only implemented with scalar bounds");
+  }
+  auto type = values.type();
+  if (!type->Equals(lower.type()) || !type->Equals(upper.type())) {
+    return Status::TypeError("Cannot compare data of differing type ", *type, " vs ",
+                             *lower.type(), " and ", *upper.type());
+  }
+  auto between_kernel = MakeBetweenKernel(*type, lower.scalar(), upper.scalar());
+  if (between_kernel == nullptr) {
+    return Status::NotImplemented("Between not implemented for type ", type->ToString());
+  }
+
+  detail::PrimitiveAllocatingUnaryKernel kernel(between_kernel.get());
+  out->value = ArrayData::Make(boolean(), values.length());
+  return kernel.Call(context, values, out);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -165,6 +165,7 @@ std::shared_ptr<CompareFunction> MakeCompareFunction(FunctionContext* context,
 /// \param[out] out resulting datum
 ///
 /// Note on floating point arrays, this uses ieee-754 compare semantics.
+/// Fixed size binary values are compared lexicographically as unsigned bytes.
 ///
 /// \since 0.14.0
 /// \note API not yet finalized
@@ -172,5 +173,25 @@ ARROW_EXPORT
 Status Compare(FunctionContext* context, const Datum& left, const Datum& right,
                struct CompareOptions options, Datum* out);
 
+/// \brief Test whether the values of an array lie in the half-open interval
+/// [lower, upper).
+///
+/// Both bounds are evaluated in a single pass over the values, which is
+/// cheaper than two Compare calls followed by a boolean And.
+///
+/// \param[in] context the FunctionContext
+/// \param[in] values datum to test, must be an Array
+/// \param[in] lower inclusive lower bound, must be a Scalar of the same type
+///            as values
+/// \param[in] upper exclusive upper bound, must be a Scalar of the same type
+///            as values
+/// \param[out] out resulting datum, null where values or either bound is null
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Between(FunctionContext* context, const Datum& values, const Datum& lower,
+               const Datum& upper, Datum* out);
+
 }  // namespace compute
 }  // namespace arrow
@@ -21,6 +21,7 @@
 
 #include "arrow/compute/benchmark_util.h"
 #include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/boolean.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/test_util.h"
 #include "arrow/testing/gtest_util.h"
@@ -77,8 +78,76 @@ static void CompareArrayArrayKernel(benchmark::State& state) {
   state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t) * 2);
 }
 
+static void CompareArrayScalarDoubleKernel(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(double);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Float64(array_size, -100, 100, null_percent);
+
+  CompareOptions lt{LESS};
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Compare(&ctx, Datum(array), Datum(0.0), lt, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(double));
+}
+
+// The fused kernel, to be compared with BetweenCompareAndKernel
+static void BetweenKernel(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Int64(array_size, -100, 100, null_percent);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Between(&ctx, Datum(array), Datum(int64_t(-50)), Datum(int64_t(50)),
+                         &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+}
+
+static void BetweenCompareAndKernel(benchmark::State& state) {
+  const int64_t memory_size = state.range(0);
+  const int64_t array_size = memory_size / sizeof(int64_t);
+  const double null_percent = static_cast<double>(state.range(1)) / 100.0;
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto array = rand.Int64(array_size, -100, 100, null_percent);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum lower, upper, out;
+    ABORT_NOT_OK(Compare(&ctx, Datum(array), Datum(int64_t(-50)),
+                         CompareOptions(GREATER_EQUAL), &lower));
+    ABORT_NOT_OK(
+        Compare(&ctx, Datum(array), Datum(int64_t(50)), CompareOptions(LESS), &upper));
+    ABORT_NOT_OK(And(&ctx, lower, upper, &out));
+    benchmark::DoNotOptimize(out);
+  }
+
+  state.counters["size"] = static_cast<double>(memory_size);
+  state.counters["null_percent"] = static_cast<double>(state.range(1));
+  state.SetBytesProcessed(state.iterations() * array_size * sizeof(int64_t));
+}
+
 BENCHMARK(CompareArrayScalarKernel)->Apply(RegressionSetArgs);
 BENCHMARK(CompareArrayArrayKernel)->Apply(RegressionSetArgs);
+BENCHMARK(CompareArrayScalarDoubleKernel)->Apply(RegressionSetArgs);
+BENCHMARK(BetweenKernel)->Apply(RegressionSetArgs);
+BENCHMARK(BetweenCompareAndKernel)->Apply(RegressionSetArgs);
 
 }  // namespace compute
 }  // namespace arrow
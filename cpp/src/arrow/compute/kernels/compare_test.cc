@@ -25,6 +25,8 @@
 #include <gtest/gtest.h>
 
 #include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/builder.h"
 #include "arrow/compute/kernel.h"
 #include "arrow/compute/kernels/compare.h"
 #include "arrow/compute/test_util.h"
@@ -386,5 +388,169 @@ TYPED_TEST(TestNumericCompareKernel, RandomCompareArrayArray) {
   }
 }
 
+TYPED_TEST(TestNumericCompareKernel, RandomCompareSlicedArrayScalar) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  auto fifty = Datum(std::make_shared<ScalarType>(CType(50)));
+  for (auto null_probability : {0.0, 0.1}) {
+    auto array = rand.Numeric<TypeParam>(1000, 0, 100, null_probability);
+    for (int64_t offset : {1, 3, 64, 67}) {
+      for (auto op : {EQUAL, GREATER, LESS_EQUAL}) {
+        auto options = CompareOptions(op);
+        ValidateCompare<TypeParam>(&this->ctx_, options, array->Slice(offset), fifty);
+        ValidateCompare<TypeParam>(&this->ctx_, options, fifty, array->Slice(offset));
+      }
+    }
+  }
+}
+
+template <typename ArrowType>
+static void ValidateBetween(FunctionContext* ctx, const char* values_str,
+                            const Datum& lower, const Datum& upper,
+                            const char* expected_str) {
+  auto values = ArrayFromJSON(TypeTraits<ArrowType>::type_singleton(), values_str);
+  auto expected = ArrayFromJSON(boolean(), expected_str);
+  Datum result;
+  ASSERT_OK(Between(ctx, values, lower, upper, &result));
+  AssertArraysEqual(*expected, *result.make_array());
+}
+
+TYPED_TEST(TestNumericCompareKernel, SimpleBetween) {
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  Datum one(std::make_shared<ScalarType>(CType(1)));
+  Datum three(std::make_shared<ScalarType>(CType(3)));
+  Datum null(std::make_shared<ScalarType>());
+
+  ValidateBetween<TypeParam>(&this->ctx_, "[]", one, three, "[]");
+  ValidateBetween<TypeParam>(&this->ctx_, "[null]", one, three, "[null]");
+  ValidateBetween<TypeParam>(&this->ctx_, "[0,1,2,3,4]", one, three, "[0,1,1,0,0]");
+  ValidateBetween<TypeParam>(&this->ctx_, "[null,1,null,3]", one, three,
+                             "[null,1,null,0]");
+  // Empty interval
+  ValidateBetween<TypeParam>(&this->ctx_, "[0,1,2,3,4]", three, one, "[0,0,0,0,0]");
+  // Null bounds
+  ValidateBetween<TypeParam>(&this->ctx_, "[0,1,2]", null, three, "[null,null,null]");
+  ValidateBetween<TypeParam>(&this->ctx_, "[0,1,2]", one, null, "[null,null,null]");
+}
+
+TYPED_TEST(TestNumericCompareKernel, RandomBetween) {
+  using ArrayType = typename TypeTraits<TypeParam>::ArrayType;
+  using ScalarType = typename TypeTraits<TypeParam>::ScalarType;
+  using CType = typename TypeTraits<TypeParam>::CType;
+
+  auto rand = random::RandomArrayGenerator(0x5416447);
+  Datum lower(std::make_shared<ScalarType>(CType(25)));
+  Datum upper(std::make_shared<ScalarType>(CType(75)));
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto array = std::static_pointer_cast<ArrayType>(
+        rand.Numeric<TypeParam>(1000, 0, 100, null_probability)->Slice(5));
+
+    std::vector<bool> is_valid(array->length()), in_range(array->length());
+    for (int64_t i = 0; i < array->length(); i++) {
+      is_valid[i] = array->IsValid(i);
+      in_range[i] = array->Value(i) >= CType(25) && array->Value(i) < CType(75);
+    }
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<BooleanType>(is_valid, in_range, &expected);
+
+    Datum result;
+    ASSERT_OK(Between(&this->ctx_, array, lower, upper, &result));
+    AssertArraysEqual(*expected, *result.make_array());
+  }
+}
+
+TEST(TestBetween, Errors) {
+  FunctionContext ctx;
+  Datum result;
+  auto values = ArrayFromJSON(int32(), "[1, 2, 3]");
+
+  ASSERT_RAISES(TypeError, Between(&ctx, values, Datum(int64_t(1)), Datum(int32_t(3)),
+                                   &result));
+  ASSERT_RAISES(NotImplemented, Between(&ctx, values, values, Datum(int32_t(3)),
+                                        &result));
+  ASSERT_RAISES(Invalid, Between(&ctx, Datum(int32_t(1)), Datum(int32_t(1)),
+                                 Datum(int32_t(3)), &result));
+}
+
+class TestFixedSizeBinaryCompareKernel : public ComputeFixture, public TestBase {
+ protected:
+  std::shared_ptr<Array> MakeArray(const std::vector<std::string>& values,
+                                   const std::vector<bool>& is_valid) {
+    FixedSizeBinaryBuilder builder(type_);
+    for (size_t i = 0; i < values.size(); ++i) {
+      if (is_valid[i]) {
+        ABORT_NOT_OK(builder.Append(values[i]));
+      } else {
+        ABORT_NOT_OK(builder.AppendNull());
+      }
+    }
+    std::shared_ptr<Array> out;
+    ABORT_NOT_OK(builder.Finish(&out));
+    return out;
+  }
+
+  Datum MakeScalar(std::string value) {
+    return Datum(
+        std::make_shared<FixedSizeBinaryScalar>(Buffer::FromString(std::move(value)),
+                                                type_));
+  }
+
+  void AssertResult(const Datum& result, const std::vector<bool>& is_valid,
+                    const std::vector<bool>& expected_values) {
+    std::shared_ptr<Array> expected;
+    ArrayFromVector<BooleanType>(is_valid, expected_values, &expected);
+    AssertArraysEqual(*expected, *result.make_array());
+  }
+
+  std::shared_ptr<DataType> type_ = fixed_size_binary(3);
+};
+
+TEST_F(TestFixedSizeBinaryCompareKernel, Compare) {
+  // Bytes compare as unsigned values
+  auto lhs = MakeArray({"abc", "abd", "\xff\x00\x00", "", "abb"},
+                       {true, true, true, false, true});
+  auto rhs = MakeArray({"abc", "abc", "abc", "abc", "abc"},
+                       {true, true, true, true, true});
+  std::vector<bool> is_valid = {true, true, true, false, true};
+  Datum result;
+
+  ASSERT_OK(Compare(&ctx_, lhs, rhs, CompareOptions(EQUAL), &result));
+  AssertResult(result, is_valid, {true, false, false, false, false});
+  ASSERT_OK(Compare(&ctx_, lhs, rhs, CompareOptions(GREATER), &result));
+  AssertResult(result, is_valid, {false, true, true, false, false});
+
+  ASSERT_OK(Compare(&ctx_, lhs, MakeScalar("abc"), CompareOptions(LESS_EQUAL), &result));
+  AssertResult(result, is_valid, {true, false, false, false, true});
+  ASSERT_OK(Compare(&ctx_, MakeScalar("abc"), lhs, CompareOptions(LESS), &result));
+  AssertResult(result, is_valid, {false, true, true, false, false});
+
+  ASSERT_OK(Between(&ctx_, lhs, MakeScalar("abc"), MakeScalar("abe"), &result));
+  AssertResult(result, is_valid, {true, true, false, false, false});
+}
+
+TEST_F(TestFixedSizeBinaryCompareKernel, Sliced) {
+  std::vector<std::string> values;
+  std::vector<bool> is_valid;
+  for (int i = 0; i < 200; ++i) {
+    values.push_back(std::string(1, static_cast<char>('a' + i % 7)) + "xy");
+    is_valid.push_back(i % 11 != 0);
+  }
+  auto array = MakeArray(values, is_valid)->Slice(9);
+
+  std::vector<bool> expected_valid, expected_values;
+  for (size_t i = 9; i < values.size(); ++i) {
+    expected_valid.push_back(is_valid[i]);
+    expected_values.push_back(values[i] >= "cxy");
+  }
+  Datum result;
+  ASSERT_OK(Compare(&ctx_, array, MakeScalar("cxy"), CompareOptions(GREATER_EQUAL),
+                    &result));
+  AssertResult(result, expected_valid, expected_values);
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -98,7 +98,9 @@ std::shared_ptr<AggregateFunction> MakeCountAggregateFunction(
 
 Status Count(FunctionContext* context, const CountOptions& options, const Datum& value,
              Datum* out) {
-  if (!value.is_array()) return Status::Invalid("Count is expecting an array datum.");
+  if (!value.is_arraylike()) {
+    return Status::Invalid("Count is expecting an array-like datum.");
+  }
 
   auto aggregate = MakeCountAggregateFunction(context, options);
   auto kernel = std::make_shared<AggregateUnaryKernel>(aggregate);
@@ -55,14 +55,14 @@ struct ARROW_EXPORT CountOptions {
 
 /// \brief Return Count function aggregate
 ARROW_EXPORT
-std::shared_ptr<AggregateFunction> MakeCount(FunctionContext* context,
-                                             const CountOptions& options);
+std::shared_ptr<AggregateFunction> MakeCountAggregateFunction(
+    FunctionContext* context, const CountOptions& options);
 
 /// \brief Count non-null (or null) values in an array.
 ///
 /// \param[in] context the FunctionContext
 /// \param[in] options counting options, see CountOptions for more information
-/// \param[in] datum to count
+/// \param[in] datum to count, expecting Array or ChunkedArray
 /// \param[out] out resulting datum
 ///
 /// \since 0.13.0
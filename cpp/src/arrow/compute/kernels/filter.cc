@@ -17,16 +17,21 @@
 
 #include "arrow/compute/kernels/filter.h"
 
+#include <array>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
 #include "arrow/array/concatenate.h"
+#include "arrow/buffer_builder.h"
 #include "arrow/builder.h"
 #include "arrow/compute/kernels/take_internal.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
@@ -36,6 +41,61 @@ namespace compute {
 using internal::checked_cast;
 using internal::checked_pointer_cast;
 
+// A copy of a filter's selection: bit i is set iff slot i of the filter is
+// either null or true. The bitmap begins at offset 0 and is padded with clear
+// bits to a whole number of 64 bit words, so it can be read a word at a time.
+class FilterSelection {
+ public:
+  static Status Make(MemoryPool* pool, const BooleanArray& filter, FilterSelection* out) {
+    const int64_t length = filter.length();
+    out->num_words_ = BitUtil::CeilDiv(length, 64);
+    RETURN_NOT_OK(AllocateWords(pool, out->num_words_, &out->bitmap_));
+    auto selection = out->bitmap_->mutable_data();
+    internal::CopyBitmap(filter.values()->data(), filter.offset(), length, selection, 0,
+                         /*restore_trailing_bits=*/false);
+
+    if (filter.null_count() != 0) {
+      // null slots are selected too
+      std::shared_ptr<Buffer> nulls;
+      RETURN_NOT_OK(AllocateWords(pool, out->num_words_, &nulls));
+      internal::InvertBitmap(filter.null_bitmap_data(), filter.offset(), length,
+                             nulls->mutable_data(), 0);
+      internal::BitmapOr(selection, 0, nulls->data(), 0, length, 0, selection);
+    }
+
+    // clear the padding so that it is never selected
+    if (length % 64 != 0) {
+      auto last_word = out->word(out->num_words_ - 1);
+      last_word &= (uint64_t(1) << (length % 64)) - 1;
+      std::memcpy(selection + (out->num_words_ - 1) * 8, &last_word, sizeof(last_word));
+    }
+    return Status::OK();
+  }
+
+  // Allocate a zeroed bitmap of num_words 64 bit words
+  static Status AllocateWords(MemoryPool* pool, int64_t num_words,
+                              std::shared_ptr<Buffer>* out) {
+    RETURN_NOT_OK(AllocateBuffer(pool, num_words * 8, out));
+    std::memset((*out)->mutable_data(), 0, static_cast<size_t>(num_words * 8));
+    return Status::OK();
+  }
+
+  int64_t num_words() const { return num_words_; }
+
+  // Bit j of word i is the selection of slot 64 * i + j
+  uint64_t word(int64_t i) const { return LoadWord(bitmap_->data(), i); }
+
+  static uint64_t LoadWord(const uint8_t* bitmap, int64_t i) {
+    uint64_t word;
+    std::memcpy(&word, bitmap + i * 8, sizeof(word));
+    return BitUtil::FromLittleEndian(word);
+  }
+
+ private:
+  std::shared_ptr<Buffer> bitmap_;
+  int64_t num_words_ = 0;
+};
+
 // IndexSequence which yields the indices of positions in a BooleanArray
 // which are either null or true
 class FilterIndexSequence {
@@ -46,16 +106,19 @@ class FilterIndexSequence {
 
   constexpr FilterIndexSequence() = default;
 
-  FilterIndexSequence(const BooleanArray& filter, int64_t out_length)
-      : filter_(&filter), out_length_(out_length) {}
+  FilterIndexSequence(const BooleanArray& filter, const FilterSelection& selection,
+                      int64_t out_length)
+      : filter_(&filter), selection_(&selection), out_length_(out_length) {}
 
   std::pair<int64_t, bool> Next() {
-    // skip until an index is found at which the filter is either null or true
-    while (filter_->IsValid(index_) && !filter_->Value(index_)) {
-      ++index_;
+    // skip words in which nothing is selected
+    while (word_ == 0) {
+      word_ = selection_->word(++word_index_);
     }
-    bool is_valid = filter_->IsValid(index_);
-    return std::make_pair(index_++, is_valid);
+    int64_t index = word_index_ * 64 + BitUtil::CountTrailingZeros(word_);
+    // clear the lowest set bit
+    word_ &= word_ - 1;
+    return std::make_pair(index, filter_->IsValid(index));
   }
 
   int64_t length() const { return out_length_; }
@@ -64,18 +127,25 @@ class FilterIndexSequence {
 
  private:
   const BooleanArray* filter_ = nullptr;
-  int64_t index_ = 0, out_length_ = -1;
+  const FilterSelection* selection_ = nullptr;
+  int64_t word_index_ = -1, out_length_ = -1;
+  uint64_t word_ = 0;
 };
 
-// TODO(bkietz) this can be optimized
 static int64_t OutputSize(const BooleanArray& filter) {
-  int64_t size = 0;
-  for (auto i = 0; i < filter.length(); ++i) {
-    if (filter.IsNull(i) || filter.Value(i)) {
-      ++size;
-    }
+  // null slots are selected, as are valid slots which are true
+  const uint8_t* values = filter.values()->data();
+  if (filter.null_count() == 0) {
+    return internal::CountSetBits(values, filter.offset(), filter.length());
   }
-  return size;
+  int64_t valid_true_count = 0;
+  internal::Bitmap bitmaps[] = {
+      {filter.values(), filter.offset(), filter.length()},
+      {filter.null_bitmap(), filter.offset(), filter.length()}};
+  internal::Bitmap::VisitWords(bitmaps, [&](std::array<uint64_t, 2> words) {
+    valid_true_count += BitUtil::PopCount(words[0] & words[1]);
+  });
+  return filter.null_count() + valid_true_count;
 }
 
 static Result<std::shared_ptr<BooleanArray>> GetFilterArray(const Datum& filter) {
@@ -86,6 +156,60 @@ static Result<std::shared_ptr<BooleanArray>> GetFilterArray(const Datum& filter)
   return checked_pointer_cast<BooleanArray>(filter.make_array());
 }
 
+// The validity of each output slot, indexed like a FilterSelection: bit i is set iff
+// slot i of both the values and the filter is valid. Only materialized if either
+// contains nulls.
+class FilterValidity {
+ public:
+  static Status Make(MemoryPool* pool, const Array& values, const BooleanArray& filter,
+                     FilterValidity* out) {
+    const int64_t length = filter.length();
+    out->has_nulls_ = values.null_count() != 0 || filter.null_count() != 0;
+    if (!out->has_nulls_) {
+      return Status::OK();
+    }
+    const int64_t num_words = BitUtil::CeilDiv(length, 64);
+    RETURN_NOT_OK(
+        FilterSelection::AllocateWords(pool, num_words, &out->values_validity_));
+    RETURN_NOT_OK(
+        FilterSelection::AllocateWords(pool, num_words, &out->filter_validity_));
+    CopyValidity(values, out->values_validity_->mutable_data());
+    CopyValidity(filter, out->filter_validity_->mutable_data());
+    return Status::OK();
+  }
+
+  bool has_nulls() const { return has_nulls_; }
+
+  uint64_t word(int64_t i) const {
+    return FilterSelection::LoadWord(values_validity_->data(), i) &
+           FilterSelection::LoadWord(filter_validity_->data(), i);
+  }
+
+ private:
+  static void CopyValidity(const Array& array, uint8_t* out) {
+    if (array.null_count() == 0) {
+      BitUtil::SetBitsTo(out, 0, array.length(), true);
+    } else {
+      internal::CopyBitmap(array.null_bitmap_data(), array.offset(), array.length(), out,
+                           0, /*restore_trailing_bits=*/false);
+    }
+  }
+
+  bool has_nulls_ = false;
+  std::shared_ptr<Buffer> values_validity_, filter_validity_;
+};
+
+constexpr uint64_t kAllSelected = ~static_cast<uint64_t>(0);
+
+// Returns the end of the run of fully selected words beginning at word_index
+static int64_t FullySelectedRunEnd(const FilterSelection& selection, int64_t word_index) {
+  int64_t run_end = word_index;
+  while (run_end < selection.num_words() && selection.word(run_end) == kAllSelected) {
+    ++run_end;
+  }
+  return run_end;
+}
+
 class FilterKernelImpl : public FilterKernel {
  public:
   FilterKernelImpl(const std::shared_ptr<DataType>& type,
@@ -97,16 +221,250 @@ class FilterKernelImpl : public FilterKernel {
     if (values.length() != filter.length()) {
       return Status::Invalid("filter and value array must have identical lengths");
     }
+    FilterSelection selection;
+    RETURN_NOT_OK(FilterSelection::Make(ctx->memory_pool(), filter, &selection));
     RETURN_NOT_OK(taker_->SetContext(ctx));
-    RETURN_NOT_OK(taker_->Take(values, FilterIndexSequence(filter, out_length)));
+    RETURN_NOT_OK(
+        taker_->Take(values, FilterIndexSequence(filter, selection, out_length)));
     return taker_->Finish(out);
   }
 
   std::unique_ptr<Taker<FilterIndexSequence>> taker_;
 };
 
+// Filters values whose type has a fixed byte width by copying slots directly out of
+// the values buffer. Runs of fully selected words are copied with a single memcpy.
+// kByteWidth == 0 indicates a byte width which is only known at runtime.
+template <int kByteWidth>
+class FixedWidthFilterImpl : public FilterKernel {
+ public:
+  FixedWidthFilterImpl(const std::shared_ptr<DataType>& type, int byte_width)
+      : FilterKernel(type), byte_width_(byte_width) {}
+
+  Status Filter(FunctionContext* ctx, const Array& values, const BooleanArray& filter,
+                int64_t out_length, std::shared_ptr<Array>* out) override {
+    if (values.length() != filter.length()) {
+      return Status::Invalid("filter and value array must have identical lengths");
+    }
+    const int64_t byte_width = kByteWidth > 0 ? kByteWidth : byte_width_;
+    auto pool = ctx->memory_pool();
+
+    std::shared_ptr<Buffer> out_values, out_null_bitmap;
+    if (values.length() == 0) {
+      // Empty arrays may have no values buffer
+      RETURN_NOT_OK(AllocateBuffer(pool, 0, &out_values));
+      *out = MakeArray(ArrayData::Make(type_, 0, {nullptr, out_values}, 0));
+      return Status::OK();
+    }
+
+    FilterSelection selection;
+    RETURN_NOT_OK(FilterSelection::Make(pool, filter, &selection));
+    FilterValidity validity;
+    RETURN_NOT_OK(FilterValidity::Make(pool, values, filter, &validity));
+
+    RETURN_NOT_OK(AllocateBuffer(pool, out_length * byte_width, &out_values));
+    uint8_t* out_bitmap = nullptr;
+    if (validity.has_nulls()) {
+      RETURN_NOT_OK(AllocateEmptyBitmap(pool, out_length, &out_null_bitmap));
+      out_bitmap = out_null_bitmap->mutable_data();
+    }
+
+    const auto& data = *values.data();
+    const uint8_t* in = data.buffers[1]->data() + data.offset * byte_width;
+    uint8_t* out_data = out_values->mutable_data();
+
+    int64_t out_position = 0;
+    for (int64_t word_index = 0; word_index < selection.num_words();) {
+      uint64_t word = selection.word(word_index);
+
+      if (word == kAllSelected) {
+        auto run_end = FullySelectedRunEnd(selection, word_index);
+        const int64_t run_length = (run_end - word_index) * 64;
+        std::memcpy(out_data + out_position * byte_width,
+                    in + word_index * 64 * byte_width, run_length * byte_width);
+        if (validity.has_nulls()) {
+          for (int64_t i = word_index; i < run_end; ++i) {
+            WriteValidity(validity.word(i), out_position + (i - word_index) * 64,
+                          out_bitmap);
+          }
+        }
+        out_position += run_length;
+        word_index = run_end;
+        continue;
+      }
+
+      const uint64_t valid_word = validity.has_nulls() ? validity.word(word_index) : 0;
+      for (; word != 0; word &= word - 1) {
+        const int bit = BitUtil::CountTrailingZeros(word);
+        const int64_t index = word_index * 64 + bit;
+        std::memcpy(out_data + out_position * byte_width, in + index * byte_width,
+                    byte_width);
+        if (valid_word & (static_cast<uint64_t>(1) << bit)) {
+          BitUtil::SetBit(out_bitmap, out_position);
+        }
+        ++out_position;
+      }
+      ++word_index;
+    }
+    DCHECK_EQ(out_position, out_length);
+
+    int64_t null_count = 0;
+    if (validity.has_nulls()) {
+      null_count = out_length - internal::CountSetBits(out_bitmap, 0, out_length);
+    }
+    *out = MakeArray(ArrayData::Make(type_, out_length, {out_null_bitmap, out_values},
+                                     null_count));
+    return Status::OK();
+  }
+
+ private:
+  // Write the validity of a fully selected word
+  static void WriteValidity(uint64_t valid_word, int64_t out_position,
+                            uint8_t* out_bitmap) {
+    valid_word = BitUtil::ToLittleEndian(valid_word);
+    internal::CopyBitmap(reinterpret_cast<const uint8_t*>(&valid_word), 0, 64,
+                         out_bitmap, out_position);
+  }
+
+  int byte_width_;
+};
+
+// Filters binary-like values by copying the bytes of selected slots directly out of
+// the data buffer. Runs of fully selected words with no nulls are copied with a single
+// memcpy, after which their offsets need only be rebased.
+template <typename OffsetType>
+class BinaryFilterImpl : public FilterKernel {
+ public:
+  explicit BinaryFilterImpl(const std::shared_ptr<DataType>& type) : FilterKernel(type) {}
+
+  Status Filter(FunctionContext* ctx, const Array& values, const BooleanArray& filter,
+                int64_t out_length, std::shared_ptr<Array>* out) override {
+    if (values.length() != filter.length()) {
+      return Status::Invalid("filter and value array must have identical lengths");
+    }
+    auto pool = ctx->memory_pool();
+
+    FilterSelection selection;
+    RETURN_NOT_OK(FilterSelection::Make(pool, filter, &selection));
+    FilterValidity validity;
+    RETURN_NOT_OK(FilterValidity::Make(pool, values, filter, &validity));
+
+    std::shared_ptr<Buffer> out_null_bitmap;
+    uint8_t* out_bitmap = nullptr;
+    if (validity.has_nulls()) {
+      RETURN_NOT_OK(AllocateEmptyBitmap(pool, out_length, &out_null_bitmap));
+      out_bitmap = out_null_bitmap->mutable_data();
+    }
+
+    const auto& data = *values.data();
+    const OffsetType* in_offsets = data.GetValues<OffsetType>(1);
+    const uint8_t* in_data = data.buffers[2] ? data.buffers[2]->data() : NULLPTR;
+
+    TypedBufferBuilder<OffsetType> offset_builder(pool);
+    BufferBuilder data_builder(pool);
+    RETURN_NOT_OK(offset_builder.Reserve(out_length + 1));
+    offset_builder.UnsafeAppend(0);
+    OffsetType out_offset = 0;
+
+    int64_t out_position = 0;
+    for (int64_t word_index = 0; word_index < selection.num_words(); ++word_index) {
+      uint64_t word = selection.word(word_index);
+      const uint64_t valid_word =
+          validity.has_nulls() ? validity.word(word_index) : kAllSelected;
+
+      if (word == kAllSelected && valid_word == kAllSelected) {
+        const int64_t begin = word_index * 64;
+        const OffsetType begin_offset = in_offsets[begin];
+        const OffsetType end_offset = in_offsets[begin + 64];
+        RETURN_NOT_OK(
+            data_builder.Append(in_data + begin_offset, end_offset - begin_offset));
+        for (int64_t i = begin + 1; i <= begin + 64; ++i) {
+          offset_builder.UnsafeAppend(out_offset + (in_offsets[i] - begin_offset));
+        }
+        out_offset += end_offset - begin_offset;
+        if (validity.has_nulls()) {
+          BitUtil::SetBitsTo(out_bitmap, out_position, 64, true);
+        }
+        out_position += 64;
+        continue;
+      }
+
+      for (; word != 0; word &= word - 1) {
+        const int bit = BitUtil::CountTrailingZeros(word);
+        if (valid_word & (static_cast<uint64_t>(1) << bit)) {
+          const int64_t index = word_index * 64 + bit;
+          const OffsetType value_length = in_offsets[index + 1] - in_offsets[index];
+          RETURN_NOT_OK(data_builder.Append(in_data + in_offsets[index], value_length));
+          out_offset += value_length;
+          if (validity.has_nulls()) {
+            BitUtil::SetBit(out_bitmap, out_position);
+          }
+        }
+        offset_builder.UnsafeAppend(out_offset);
+        ++out_position;
+      }
+    }
+    DCHECK_EQ(out_position, out_length);
+
+    std::shared_ptr<Buffer> out_offsets, out_data;
+    RETURN_NOT_OK(offset_builder.Finish(&out_offsets));
+    RETURN_NOT_OK(data_builder.Finish(&out_data));
+
+    int64_t null_count = 0;
+    if (validity.has_nulls()) {
+      null_count = out_length - internal::CountSetBits(out_bitmap, 0, out_length);
+    }
+    *out = MakeArray(ArrayData::Make(
+        type_, out_length, {out_null_bitmap, out_offsets, out_data}, null_count));
+    return Status::OK();
+  }
+};
+
+template <int kByteWidth>
+static std::unique_ptr<FilterKernel> MakeFixedWidthFilter(
+    const std::shared_ptr<DataType>& type, int byte_width) {
+  return std::unique_ptr<FilterKernel>(
+      new FixedWidthFilterImpl<kByteWidth>(type, byte_width));
+}
+
 Status FilterKernel::Make(const std::shared_ptr<DataType>& value_type,
                           std::unique_ptr<FilterKernel>* out) {
+  const auto id = value_type->id();
+  if (id == Type::BINARY || id == Type::STRING) {
+    out->reset(new BinaryFilterImpl<int32_t>(value_type));
+    return Status::OK();
+  }
+  if (id == Type::LARGE_BINARY || id == Type::LARGE_STRING) {
+    out->reset(new BinaryFilterImpl<int64_t>(value_type));
+    return Status::OK();
+  }
+  if (is_fixed_width(id) && id != Type::NA && id != Type::BOOL &&
+      id != Type::DICTIONARY) {
+    const int byte_width =
+        checked_cast<const FixedWidthType&>(*value_type).bit_width() / 8;
+    switch (byte_width) {
+      case 1:
+        *out = MakeFixedWidthFilter<1>(value_type, byte_width);
+        break;
+      case 2:
+        *out = MakeFixedWidthFilter<2>(value_type, byte_width);
+        break;
+      case 4:
+        *out = MakeFixedWidthFilter<4>(value_type, byte_width);
+        break;
+      case 8:
+        *out = MakeFixedWidthFilter<8>(value_type, byte_width);
+        break;
+      case 16:
+        *out = MakeFixedWidthFilter<16>(value_type, byte_width);
+        break;
+      default:
+        *out = MakeFixedWidthFilter<0>(value_type, byte_width);
+        break;
+    }
+    return Status::OK();
+  }
+
   std::unique_ptr<Taker<FilterIndexSequence>> taker;
   RETURN_NOT_OK(Taker<FilterIndexSequence>::Make(value_type, &taker));
 
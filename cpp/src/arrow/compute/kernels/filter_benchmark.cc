@@ -92,6 +92,45 @@ static void FilterString(benchmark::State& state) {
   }
 }
 
+// Filter values with a filter which selects state.range(1) out of every 1000 slots
+template <typename GenerateValues>
+static void FilterSelectivity(benchmark::State& state, GenerateValues&& generate) {
+  const int64_t array_size = state.range(0);
+  const double selectivity = static_cast<double>(state.range(1)) / 1000;
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  std::shared_ptr<Array> array = generate(&rand, array_size);
+  auto filter = rand.Boolean(array_size, selectivity, /*null_probability=*/0);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Filter(&ctx, Datum(array), Datum(filter), &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
+static void FilterInt64Selectivity(benchmark::State& state) {
+  FilterSelectivity(state, [](random::RandomArrayGenerator* rand, int64_t size) {
+    return rand->Int64(size, -100, 100, /*null_probability=*/0);
+  });
+}
+
+static void FilterStringSelectivity(benchmark::State& state) {
+  FilterSelectivity(state, [](random::RandomArrayGenerator* rand, int64_t size) {
+    return rand->String(size, 0, 32, /*null_probability=*/0);
+  });
+}
+
+// Array length, selected slots per thousand (0.1%, 1%, 50%, 99%, 99.9%)
+static void SelectivitySetArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t per_thousand : {1, 10, 500, 990, 999}) {
+    bench->Args({1 << 20, per_thousand});
+  }
+  bench->Unit(benchmark::TimeUnit::kMicrosecond);
+}
+
 BENCHMARK(FilterInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -113,5 +152,8 @@ BENCHMARK(FilterString)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+BENCHMARK(FilterInt64Selectivity)->Apply(SelectivitySetArgs);
+BENCHMARK(FilterStringSelectivity)->Apply(SelectivitySetArgs);
+
 }  // namespace compute
 }  // namespace arrow
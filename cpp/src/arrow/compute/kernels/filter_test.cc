@@ -159,6 +159,12 @@ TYPED_TEST(TestFilterKernelWithNumeric, FilterNumeric) {
   ASSERT_RAISES(Invalid, this->Filter(this->type_singleton(), "[7, 8, 9]", "[]", &arr));
 }
 
+TYPED_TEST(TestFilterKernelWithNumeric, FilterEmptyWithoutValuesBuffer) {
+  auto values = MakeArray(ArrayData::Make(this->type_singleton(), 0, {nullptr, nullptr}));
+  this->AssertFilterArrays(values, ArrayFromJSON(boolean(), "[]"),
+                           ArrayFromJSON(this->type_singleton(), "[]"));
+}
+
 TYPED_TEST(TestFilterKernelWithNumeric, FilterRandomNumeric) {
   auto rand = random::RandomArrayGenerator(kSeed);
   for (size_t i = 3; i < 13; i++) {
@@ -173,6 +179,22 @@ TYPED_TEST(TestFilterKernelWithNumeric, FilterRandomNumeric) {
   }
 }
 
+TYPED_TEST(TestFilterKernelWithNumeric, FilterSlicedRandomNumeric) {
+  // exercise selection words which aren't aligned with the values or filter
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = 1 << 10;
+  for (auto null_probability : {0.0, 0.01, 0.25}) {
+    for (auto filter_probability : {0.0, 0.01, 0.5, 0.99, 1.0}) {
+      auto values = rand.Numeric<TypeParam>(length, 0, 127, null_probability);
+      auto filter = rand.Boolean(length, filter_probability, null_probability);
+      for (int64_t offset : {1, 7, 63, 65}) {
+        this->ValidateFilter(values->Slice(offset, length - 70),
+                             filter->Slice(70 - offset, length - 70));
+      }
+    }
+  }
+}
+
 template <typename CType>
 decltype(Comparator<CType, EQUAL>::Compare)* GetComparator(CompareOperator op) {
   using cmp_t = decltype(Comparator<CType, EQUAL>::Compare);
@@ -329,6 +351,28 @@ TYPED_TEST(TestFilterKernelWithString, FilterString) {
   this->AssertFilter(R"(["a", "b", "c"])", "[null, 1, 0]", R"([null, "b"])");
 }
 
+TYPED_TEST(TestFilterKernelWithString, FilterRandomString) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = 1 << 10;
+  for (auto null_probability : {0.0, 0.01, 0.25}) {
+    for (auto filter_probability : {0.0, 0.01, 0.5, 0.99, 1.0}) {
+      std::shared_ptr<Array> values;
+      if (is_large_binary_like(this->value_type()->id())) {
+        values = rand.LargeString(length, 0, 16, null_probability);
+      } else {
+        values = rand.String(length, 0, 16, null_probability);
+      }
+      ASSERT_OK(values->View(this->value_type(), &values));
+      auto filter = rand.Boolean(length, filter_probability, null_probability);
+      this->ValidateFilter(values, filter);
+      for (int64_t offset : {1, 63, 65}) {
+        this->ValidateFilter(values->Slice(offset, length - 70),
+                             filter->Slice(70 - offset, length - 70));
+      }
+    }
+  }
+}
+
 TYPED_TEST(TestFilterKernelWithString, FilterDictionary) {
   auto dict = R"(["a", "b", "c", "d", "e"])";
   this->AssertFilterDictionary(dict, "[3, 4, 2]", "[0, 1, 0]", "[4]");
@@ -336,6 +380,17 @@ TYPED_TEST(TestFilterKernelWithString, FilterDictionary) {
   this->AssertFilterDictionary(dict, "[3, 4, 2]", "[null, 1, 0]", "[null, 4]");
 }
 
+class TestFilterKernelWithFixedSizeBinary
+    : public TestFilterKernel<FixedSizeBinaryType> {};
+
+TEST_F(TestFilterKernelWithFixedSizeBinary, FilterFixedSizeBinary) {
+  auto type = fixed_size_binary(3);
+  this->AssertFilter(type, "[]", "[]", "[]");
+  this->AssertFilter(type, R"(["aaa", "bbb", "ccc"])", "[0, 1, 0]", R"(["bbb"])");
+  this->AssertFilter(type, R"(["aaa", null, "ccc", "ddd"])", "[1, 1, null, 0]",
+                     R"(["aaa", null, null])");
+}
+
 class TestFilterKernelWithList : public TestFilterKernel<ListType> {};
 
 TEST_F(TestFilterKernelWithList, FilterListInt32) {
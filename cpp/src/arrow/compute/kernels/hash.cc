@@ -39,9 +39,12 @@
 #include "arrow/type_traits.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/hashing.h"
+#include "arrow/util/int_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/parallel.h"
 #include "arrow/util/string_view.h"
+#include "arrow/util/thread_pool.h"
 #include "arrow/visitor_inline.h"
 
 namespace arrow {
@@ -221,6 +224,60 @@ class DictEncodeAction final : public ActionBase {
   Int32Builder indices_builder_;
 };
 
+// ----------------------------------------------------------------------
+// Memo indices implementation (see HashKernel for description of methods)
+//
+// Like dictionary encoding, except that nulls are memoized as well. This is
+// used to merge the memo tables of hash kernels run in parallel.
+
+class MemoIndicesAction final : public ActionBase {
+ public:
+  using ActionBase::ActionBase;
+
+  MemoIndicesAction(const std::shared_ptr<DataType>& type, MemoryPool* pool)
+      : ActionBase(type, pool), indices_builder_(pool) {}
+
+  Status Reset() {
+    indices_builder_.Reset();
+    return Status::OK();
+  }
+
+  Status Reserve(const int64_t length) { return indices_builder_.Reserve(length); }
+
+  template <class Index>
+  void ObserveNullFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+  }
+
+  template <class Index>
+  void ObserveNullNotFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+  }
+
+  template <class Index>
+  void ObserveFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+  }
+
+  template <class Index>
+  void ObserveNotFound(Index index) {
+    indices_builder_.UnsafeAppend(index);
+  }
+
+  Status Flush(Datum* out) {
+    std::shared_ptr<ArrayData> result;
+    RETURN_NOT_OK(indices_builder_.FinishInternal(&result));
+    out->value = std::move(result);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const { return int32(); }
+  Status FlushFinal(Datum* out) { return Status::OK(); }
+
+ private:
+  Int32Builder indices_builder_;
+};
+
 /// \brief Invoke hash table kernel on input array, returning any output
 /// values. Implementations should be thread-safe
 ///
@@ -530,6 +587,30 @@ Status GetValueCountsKernel(FunctionContext* ctx, const std::shared_ptr<DataType
   return Status::OK();
 }
 
+Status GetMemoIndicesKernel(FunctionContext* ctx, const std::shared_ptr<DataType>& type,
+                            std::unique_ptr<HashKernel>* out) {
+  std::unique_ptr<HashKernel> kernel;
+
+  switch (type->id()) {
+#define PROCESS(InType)                                                                 \
+  case InType::type_id:                                                                 \
+    kernel.reset(                                                                       \
+        new typename HashKernelTraits<InType, MemoIndicesAction, false,                 \
+                                      true>::HashKernelImpl(type, ctx->memory_pool())); \
+    break;
+
+    PROCESS_SUPPORTED_HASH_TYPES(PROCESS)
+#undef PROCESS
+    default:
+      break;
+  }
+
+  CHECK_IMPLEMENTED(kernel, "memo-indices", type);
+  RETURN_NOT_OK(kernel->Reset());
+  *out = std::move(kernel);
+  return Status::OK();
+}
+
 namespace {
 
 Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
@@ -543,9 +624,129 @@ Status InvokeHash(FunctionContext* ctx, HashKernel* func, const Datum& value,
   return Status::OK();
 }
 
+// ----------------------------------------------------------------------
+// Parallel hashing of ChunkedArrays
+//
+// Runs of contiguous chunks are hashed into separate memo tables on separate
+// threads. The dictionaries of these partitions are then merged into a single
+// memo table in input order, which yields exactly the dictionary of a serial run
+// along with a mapping from each partition's memo indices to the merged ones.
+
+using HashKernelFactory = Status (*)(FunctionContext*, const std::shared_ptr<DataType>&,
+                                     std::unique_ptr<HashKernel>*);
+
+struct HashPartition {
+  int begin_chunk;
+  int end_chunk;
+  std::unique_ptr<HashKernel> kernel;
+  // The kernel's output for each chunk of the partition
+  std::vector<Datum> outputs;
+  // The index in the merged dictionary of each value in the partition's dictionary
+  std::shared_ptr<ArrayData> transpose_map;
+};
+
+bool ShouldHashInPartitions(FunctionContext* ctx, const Datum& value) {
+  return ctx->use_threads() && GetCpuThreadPoolCapacity() > 1 &&
+         value.kind() == Datum::CHUNKED_ARRAY &&
+         value.chunked_array()->num_chunks() > 1 && value.type()->id() != Type::NA;
+}
+
+Status HashInPartitions(FunctionContext* ctx, HashKernelFactory make_kernel,
+                        const ChunkedArray& values, std::vector<HashPartition>* out,
+                        std::shared_ptr<Array>* dictionary) {
+  // Split the chunks into one run of roughly equal length per thread
+  const int num_chunks = values.num_chunks();
+  const int num_partitions = std::min(num_chunks, GetCpuThreadPoolCapacity());
+  std::vector<HashPartition> partitions(num_partitions);
+  int64_t partitioned_length = 0;
+  int chunk = 0;
+  for (int i = 0; i < num_partitions; ++i) {
+    HashPartition& partition = partitions[i];
+    partition.begin_chunk = chunk;
+    // Leave at least one chunk to each following partition
+    const int max_end_chunk = num_chunks - (num_partitions - i - 1);
+    const int64_t end_length = values.length() * (i + 1) / num_partitions;
+    while (chunk < max_end_chunk &&
+           (chunk == partition.begin_chunk || partitioned_length < end_length ||
+            i == num_partitions - 1)) {
+      partitioned_length += values.chunk(chunk)->length();
+      ++chunk;
+    }
+    partition.end_chunk = chunk;
+  }
+
+  auto hash_partition = [&](int i) {
+    HashPartition& partition = partitions[i];
+    RETURN_NOT_OK(make_kernel(ctx, values.type(), &partition.kernel));
+    for (int j = partition.begin_chunk; j < partition.end_chunk; ++j) {
+      Datum output;
+      output.value =
+          ArrayData::Make(partition.kernel->out_type(), values.chunk(j)->length());
+      RETURN_NOT_OK(partition.kernel->Call(ctx, values.chunk(j), &output));
+      partition.outputs.push_back(std::move(output));
+    }
+    return Status::OK();
+  };
+  RETURN_NOT_OK(internal::ParallelFor(num_partitions, hash_partition));
+
+  std::unique_ptr<HashKernel> merge_kernel;
+  RETURN_NOT_OK(GetMemoIndicesKernel(ctx, values.type(), &merge_kernel));
+  for (HashPartition& partition : partitions) {
+    std::shared_ptr<ArrayData> partition_dictionary;
+    RETURN_NOT_OK(partition.kernel->GetDictionary(&partition_dictionary));
+    Datum transpose_map;
+    RETURN_NOT_OK(merge_kernel->Call(ctx, partition_dictionary, &transpose_map));
+    partition.transpose_map = transpose_map.array();
+  }
+
+  std::shared_ptr<ArrayData> dict_data;
+  RETURN_NOT_OK(merge_kernel->GetDictionary(&dict_data));
+  *dictionary = MakeArray(dict_data);
+  *out = std::move(partitions);
+  return Status::OK();
+}
+
+// Replace the partition memo indices of a dictionary encoding with merged ones
+void TransposeIndices(const ArrayData& transpose_map, ArrayData* indices) {
+  // Null slots hold index 0, which is in range unless the partition has no values
+  if (transpose_map.length > 0) {
+    internal::TransposeInts(indices->GetValues<int32_t>(1),
+                            indices->GetMutableValues<int32_t>(1), indices->length,
+                            transpose_map.GetValues<int32_t>(1));
+  }
+}
+
+// Sum the value counts of all partitions
+Status MergeValueCounts(FunctionContext* ctx, int64_t dictionary_length,
+                        std::vector<HashPartition>* partitions, Datum* out) {
+  std::shared_ptr<Buffer> counts_buffer;
+  RETURN_NOT_OK(ctx->Allocate(dictionary_length * sizeof(int64_t), &counts_buffer));
+  auto counts = reinterpret_cast<int64_t*>(counts_buffer->mutable_data());
+  std::fill(counts, counts + dictionary_length, 0);
+
+  for (HashPartition& partition : *partitions) {
+    Datum partition_counts;
+    RETURN_NOT_OK(partition.kernel->FlushFinal(&partition_counts));
+    const int32_t* transpose_map = partition.transpose_map->GetValues<int32_t>(1);
+    const int64_t* partition_counts_data =
+        partition_counts.array()->GetValues<int64_t>(1);
+    for (int64_t i = 0; i < partition_counts.array()->length; ++i) {
+      counts[transpose_map[i]] += partition_counts_data[i];
+    }
+  }
+  out->value = ArrayData::Make(int64(), dictionary_length, {NULLPTR, counts_buffer}, 0);
+  return Status::OK();
+}
+
 }  // namespace
 
 Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>* out) {
+  if (ShouldHashInPartitions(ctx, value)) {
+    std::vector<HashPartition> partitions;
+    return HashInPartitions(ctx, GetUniqueKernel, *value.chunked_array(), &partitions,
+                            out);
+  }
+
   std::unique_ptr<HashKernel> func;
   RETURN_NOT_OK(GetUniqueKernel(ctx, value.type(), &func));
 
@@ -554,12 +755,23 @@ Status Unique(FunctionContext* ctx, const Datum& value, std::shared_ptr<Array>*
 }
 
 Status DictionaryEncode(FunctionContext* ctx, const Datum& value, Datum* out) {
-  std::unique_ptr<HashKernel> func;
-  RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
-
   std::shared_ptr<Array> dictionary;
   std::vector<Datum> indices_outputs;
-  RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dictionary));
+  if (ShouldHashInPartitions(ctx, value)) {
+    std::vector<HashPartition> partitions;
+    RETURN_NOT_OK(HashInPartitions(ctx, GetDictionaryEncodeKernel, *value.chunked_array(),
+                                   &partitions, &dictionary));
+    for (HashPartition& partition : partitions) {
+      for (Datum& indices : partition.outputs) {
+        TransposeIndices(*partition.transpose_map, indices.array().get());
+        indices_outputs.push_back(std::move(indices));
+      }
+    }
+  } else {
+    std::unique_ptr<HashKernel> func;
+    RETURN_NOT_OK(GetDictionaryEncodeKernel(ctx, value.type(), &func));
+    RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &indices_outputs, &dictionary));
+  }
 
   // Wrap indices in dictionary arrays for result
   std::vector<std::shared_ptr<Array>> dict_chunks;
@@ -593,16 +805,22 @@ const int32_t kCountsFieldIndex = 1;
 
 Status ValueCounts(FunctionContext* ctx, const Datum& value,
                    std::shared_ptr<Array>* counts) {
-  std::unique_ptr<HashKernel> func;
-  RETURN_NOT_OK(GetValueCountsKernel(ctx, value.type(), &func));
-
-  // Calls return nothing for counts.
-  std::vector<Datum> unused_output;
   std::shared_ptr<Array> uniques;
-  RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &unused_output, &uniques));
-
   Datum value_counts;
-  RETURN_NOT_OK(func->FlushFinal(&value_counts));
+  if (ShouldHashInPartitions(ctx, value)) {
+    std::vector<HashPartition> partitions;
+    RETURN_NOT_OK(HashInPartitions(ctx, GetValueCountsKernel, *value.chunked_array(),
+                                   &partitions, &uniques));
+    RETURN_NOT_OK(MergeValueCounts(ctx, uniques->length(), &partitions, &value_counts));
+  } else {
+    std::unique_ptr<HashKernel> func;
+    RETURN_NOT_OK(GetValueCountsKernel(ctx, value.type(), &func));
+
+    // Calls return nothing for counts.
+    std::vector<Datum> unused_output;
+    RETURN_NOT_OK(InvokeHash(ctx, func.get(), value, &unused_output, &uniques));
+    RETURN_NOT_OK(func->FlushFinal(&value_counts));
+  }
 
   auto data_type = std::make_shared<StructType>(std::vector<std::shared_ptr<Field>>{
       std::make_shared<Field>(kValuesFieldName, uniques->type()),
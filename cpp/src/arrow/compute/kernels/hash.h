@@ -38,6 +38,8 @@ class FunctionContext;
 ///
 /// Note if a null occurs in the input it will NOT be included in the output.
 ///
+/// If context->use_threads(), the chunks of a ChunkedArray are hashed in parallel.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] datum array-like input
 /// \param[out] out result as Array
@@ -60,6 +62,8 @@ ARROW_EXPORT extern const int32_t kCountsFieldIndex;
 /// For floating point arrays there is no attempt to normalize -0.0, 0.0 and NaN values
 /// which can lead to unexpected results if the input Array has these values.
 ///
+/// If context->use_threads(), the chunks of a ChunkedArray are hashed in parallel.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] value array-like input
 /// \param[out] counts An array of  <input type "Values", int64_t "Counts"> structs.
@@ -71,6 +75,10 @@ Status ValueCounts(FunctionContext* context, const Datum& value,
                    std::shared_ptr<Array>* counts);
 
 /// \brief Dictionary-encode values in an array-like object
+///
+/// If context->use_threads(), the chunks of a ChunkedArray are hashed in parallel.
+/// The result is the same as when hashing serially.
+///
 /// \param[in] context the FunctionContext
 /// \param[in] data array-like input
 /// \param[out] out result with same shape and type as input
@@ -34,10 +34,12 @@
 #include "arrow/status.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_common.h"
+#include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
 #include "arrow/util/decimal.h"
+#include "arrow/util/thread_pool.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -507,5 +509,87 @@ TEST_F(TestHashKernel, ChunkedArrayZeroChunk) {
                      *result_datum.chunked_array());
 }
 
+TEST_F(TestHashKernel, UniqueSlicedBinary) {
+  auto values = ArrayFromJSON(utf8(), R"(["aa", "b", "c", "aa", null, "b", "dd"])");
+  std::shared_ptr<Array> result;
+  ASSERT_OK(Unique(&this->ctx_, values->Slice(2), &result));
+  AssertArraysEqual(*ArrayFromJSON(utf8(), R"(["c", "aa", null, "b", "dd"])"), *result);
+}
+
+class TestHashKernelParallel : public ComputeFixture, public TestBase {
+ protected:
+  // Hash in several partitions even on machines with a single core
+  void SetUp() override {
+    capacity_ = GetCpuThreadPoolCapacity();
+    ASSERT_OK(SetCpuThreadPoolCapacity(4));
+  }
+
+  void TearDown() override { ASSERT_OK(SetCpuThreadPoolCapacity(capacity_)); }
+
+  // Results when hashing in parallel must be identical to serial ones
+  void CheckParallel(const std::shared_ptr<ChunkedArray>& values) {
+    std::shared_ptr<Array> serial_unique, parallel_unique;
+    std::shared_ptr<Array> serial_counts, parallel_counts;
+    Datum serial_encoded, parallel_encoded;
+
+    ctx_.set_use_threads(false);
+    ASSERT_OK(Unique(&ctx_, values, &serial_unique));
+    ASSERT_OK(ValueCounts(&ctx_, values, &serial_counts));
+    ASSERT_OK(DictionaryEncode(&ctx_, values, &serial_encoded));
+
+    ctx_.set_use_threads(true);
+    ASSERT_OK(Unique(&ctx_, values, &parallel_unique));
+    ASSERT_OK(parallel_unique->ValidateFull());
+    AssertArraysEqual(*serial_unique, *parallel_unique);
+
+    ASSERT_OK(ValueCounts(&ctx_, values, &parallel_counts));
+    ASSERT_OK(parallel_counts->ValidateFull());
+    AssertArraysEqual(*serial_counts, *parallel_counts);
+
+    ASSERT_OK(DictionaryEncode(&ctx_, values, &parallel_encoded));
+    ASSERT_EQ(Datum::CHUNKED_ARRAY, parallel_encoded.kind());
+    ASSERT_OK(parallel_encoded.chunked_array()->ValidateFull());
+    AssertChunkedEqual(*serial_encoded.chunked_array(),
+                       *parallel_encoded.chunked_array());
+  }
+
+  std::shared_ptr<ChunkedArray> Chunk(const std::shared_ptr<Array>& array,
+                                      const std::vector<int64_t>& lengths) {
+    ArrayVector chunks;
+    int64_t offset = 0;
+    for (auto length : lengths) {
+      chunks.push_back(array->Slice(offset, length));
+      offset += length;
+    }
+    return std::make_shared<ChunkedArray>(chunks);
+  }
+
+  int capacity_;
+  random::RandomArrayGenerator rand_{0x4a54};
+};
+
+TEST_F(TestHashKernelParallel, Integers) {
+  auto values = rand_.Int64(10000, 0, 500, 0.1);
+  CheckParallel(Chunk(values, {1000, 0, 3000, 10, 990, 5000}));
+  // Chunks with nulls only, and values appearing first in later chunks
+  CheckParallel(Chunk(ArrayFromJSON(int32(), "[null, null, 1, 2, 1, null, 3, 2, 4]"),
+                      {2, 2, 1, 1, 3}));
+}
+
+TEST_F(TestHashKernelParallel, Strings) {
+  auto values = rand_.StringWithRepeats(10000, 200, 0, 10, 0.1);
+  CheckParallel(Chunk(values, {100, 4900, 0, 2000, 3000}));
+}
+
+TEST_F(TestHashKernelParallel, Boolean) {
+  auto values = rand_.Boolean(1000, 0.5, 0.2);
+  CheckParallel(Chunk(values, {1, 499, 250, 250}));
+}
+
+TEST_F(TestHashKernelParallel, ManyChunks) {
+  auto values = rand_.Int32(10000, -100, 100, 0.01);
+  CheckParallel(Chunk(values, std::vector<int64_t>(100, 100)));
+}
+
 }  // namespace compute
 }  // namespace arrow
@@ -0,0 +1,492 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/compute/kernels/string_functions.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/buffer.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/util_internal.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/utf8.h"
+
+namespace arrow {
+namespace compute {
+
+namespace {
+
+inline bool IsContinuationByte(uint8_t byte) { return (byte & 0xc0) == 0x80; }
+
+// Advance past up to num_chars UTF8 characters starting at begin
+inline const uint8_t* SkipCharacters(const uint8_t* begin, const uint8_t* end,
+                                     int64_t num_chars) {
+  while (begin < end && num_chars-- > 0) {
+    ++begin;
+    while (begin < end && IsContinuationByte(*begin)) {
+      ++begin;
+    }
+  }
+  return begin;
+}
+
+// Find the first occurrence of pattern in [begin, end), or return NULLPTR.
+// Candidates are located with memchr, which is vectorized by the C library.
+inline const uint8_t* FindPattern(const uint8_t* begin, const uint8_t* end,
+                                  const std::string& pattern) {
+  const auto pattern_data = reinterpret_cast<const uint8_t*>(pattern.data());
+  const auto pattern_length = static_cast<int64_t>(pattern.size());
+  DCHECK_GT(pattern_length, 0);
+
+  while (end - begin >= pattern_length) {
+    auto candidate = static_cast<const uint8_t*>(
+        std::memchr(begin, pattern_data[0], end - begin - pattern_length + 1));
+    if (candidate == NULLPTR) {
+      return NULLPTR;
+    }
+    // Checking the last byte first rejects most false candidates cheaply
+    if (candidate[pattern_length - 1] == pattern_data[pattern_length - 1] &&
+        std::memcmp(candidate + 1, pattern_data + 1, pattern_length - 1) == 0) {
+      return candidate;
+    }
+    begin = candidate + 1;
+  }
+  return NULLPTR;
+}
+
+// The offsets and character data of a binary-like array
+template <typename Type>
+struct BinaryValues {
+  using offset_type = typename Type::offset_type;
+
+  explicit BinaryValues(const ArrayData& data)
+      : length(data.length),
+        offsets(data.buffers[1] == NULLPTR ? &kNoOffsets
+                                           : data.GetValues<offset_type>(1)),
+        data(data.buffers[2] == NULLPTR ? NULLPTR : data.buffers[2]->data()) {}
+
+  const uint8_t* value_begin(int64_t i) const { return data + offsets[i]; }
+
+  const uint8_t* value_end(int64_t i) const { return data + offsets[i + 1]; }
+
+  int64_t data_size() const { return offsets[length] - offsets[0]; }
+
+  bool IsAscii() const {
+    return data_size() == 0 || util::ValidateAscii(value_begin(0), data_size());
+  }
+
+  // Allocate offsets for an output with the same length
+  Status AllocateOffsets(FunctionContext* ctx, std::shared_ptr<Buffer>* out) const {
+    return ctx->Allocate((length + 1) * sizeof(offset_type), out);
+  }
+
+  static constexpr offset_type kNoOffsets = 0;
+
+  int64_t length;
+  const offset_type* offsets;
+  const uint8_t* data;
+};
+
+template <typename Type>
+constexpr typename Type::offset_type BinaryValues<Type>::kNoOffsets;
+
+// Length kernels
+
+template <typename Type>
+class BinaryLengthKernel : public UnaryKernel {
+  using offset_type = typename Type::offset_type;
+
+ public:
+  explicit BinaryLengthKernel(bool count_characters)
+      : count_characters_(count_characters) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+
+    BinaryValues<Type> values(in_data);
+    auto lengths = result->GetMutableValues<offset_type>(1);
+    if (!count_characters_ || values.IsAscii()) {
+      for (int64_t i = 0; i < values.length; ++i) {
+        lengths[i] = values.offsets[i + 1] - values.offsets[i];
+      }
+      return Status::OK();
+    }
+    for (int64_t i = 0; i < values.length; ++i) {
+      // Count the bytes which begin a character
+      offset_type num_chars = 0;
+      for (auto p = values.value_begin(i); p < values.value_end(i); ++p) {
+        num_chars += !IsContinuationByte(*p);
+      }
+      lengths[i] = num_chars;
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override {
+    return std::is_same<offset_type, int32_t>::value
+               ? std::static_pointer_cast<DataType>(int32())
+               : std::static_pointer_cast<DataType>(int64());
+  }
+
+ private:
+  bool count_characters_;
+};
+
+// Case conversion kernels
+
+struct AsciiUpperOp {
+  static uint8_t Call(uint8_t c) {
+    return static_cast<uint8_t>(c - ((c >= 'a' && c <= 'z') << 5));
+  }
+};
+
+struct AsciiLowerOp {
+  static uint8_t Call(uint8_t c) {
+    return static_cast<uint8_t>(c + ((c >= 'A' && c <= 'Z') << 5));
+  }
+};
+
+template <typename Type, typename Op>
+class AsciiCaseKernel : public UnaryKernel {
+  using offset_type = typename Type::offset_type;
+
+ public:
+  explicit AsciiCaseKernel(std::shared_ptr<DataType> type) : type_(std::move(type)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->buffers.resize(3);
+
+    // Every value keeps its length, so unless they must be rebased the offsets are
+    // shared with the input
+    BinaryValues<Type> values(in_data);
+    if (values.offsets[0] == 0 && in_data.buffers[1] != NULLPTR) {
+      result->buffers[1] =
+          SliceBuffer(in_data.buffers[1], in_data.offset * sizeof(offset_type),
+                      (in_data.length + 1) * sizeof(offset_type));
+    } else {
+      RETURN_NOT_OK(values.AllocateOffsets(ctx, &result->buffers[1]));
+      auto offsets = result->GetMutableValues<offset_type>(1);
+      for (int64_t i = 0; i <= values.length; ++i) {
+        offsets[i] = values.offsets[i] - values.offsets[0];
+      }
+    }
+
+    const int64_t data_size = values.data_size();
+    RETURN_NOT_OK(ctx->Allocate(data_size, &result->buffers[2]));
+    const uint8_t* in_chars = values.data + values.offsets[0];
+    uint8_t* out_chars = result->buffers[2]->mutable_data();
+    for (int64_t i = 0; i < data_size; ++i) {
+      out_chars[i] = Op::Call(in_chars[i]);
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+};
+
+template <typename Type>
+using AsciiUpperKernel = AsciiCaseKernel<Type, AsciiUpperOp>;
+
+template <typename Type>
+using AsciiLowerKernel = AsciiCaseKernel<Type, AsciiLowerOp>;
+
+// Matching kernels
+
+template <typename Type>
+class MatchSubstringKernel : public UnaryKernel {
+ public:
+  explicit MatchSubstringKernel(std::string pattern) : pattern_(std::move(pattern)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+
+    BinaryValues<Type> values(in_data);
+    uint8_t* bitmap = result->buffers[1]->mutable_data();
+    if (pattern_.empty()) {
+      BitUtil::SetBitsTo(bitmap, 0, values.length, true);
+      return Status::OK();
+    }
+    std::memset(bitmap, 0, BitUtil::BytesForBits(values.length));
+
+    // Rather than searching each value separately, search all the character data at
+    // once and map each occurrence back to the value it begins in. This is much
+    // faster for short values, and skips the remainder of a value once it matched.
+    const auto pattern_length = static_cast<int64_t>(pattern_.size());
+    const uint8_t* data_end = values.value_begin(values.length);
+    const uint8_t* position = values.value_begin(0);
+    int64_t i = 0;
+    while (i < values.length) {
+      const uint8_t* found = FindPattern(position, data_end, pattern_);
+      if (found == NULLPTR) {
+        break;
+      }
+      while (values.value_end(i) <= found) {
+        ++i;
+      }
+      if (found + pattern_length <= values.value_end(i)) {
+        BitUtil::SetBit(bitmap, i);
+        position = values.value_end(i);
+        ++i;
+      } else {
+        // The occurrence straddles two values
+        position = found + 1;
+      }
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+ private:
+  std::string pattern_;
+};
+
+template <typename Type, bool kPrefix>
+class MatchAffixKernel : public UnaryKernel {
+ public:
+  explicit MatchAffixKernel(std::string pattern) : pattern_(std::move(pattern)) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+
+    BinaryValues<Type> values(in_data);
+    const auto pattern_length = static_cast<int64_t>(pattern_.size());
+    int64_t i = 0;
+    internal::GenerateBitsUnrolled(
+        result->buffers[1]->mutable_data(), 0, values.length, [&]() -> bool {
+          const uint8_t* begin = values.value_begin(i);
+          const uint8_t* end = values.value_end(i);
+          ++i;
+          return end - begin >= pattern_length &&
+                 std::memcmp(kPrefix ? begin : end - pattern_length, pattern_.data(),
+                             pattern_length) == 0;
+        });
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return boolean(); }
+
+ private:
+  std::string pattern_;
+};
+
+template <typename Type>
+using StartsWithKernel = MatchAffixKernel<Type, true>;
+
+template <typename Type>
+using EndsWithKernel = MatchAffixKernel<Type, false>;
+
+// Substring kernel
+
+template <typename Type>
+class SubstringKernel : public UnaryKernel {
+  using offset_type = typename Type::offset_type;
+
+ public:
+  SubstringKernel(std::shared_ptr<DataType> type, SubstringOptions options)
+      : type_(std::move(type)), options_(options) {}
+
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(detail::PropagateNulls(ctx, in_data, result));
+    result->buffers.resize(3);
+
+    BinaryValues<Type> values(in_data);
+    RETURN_NOT_OK(values.AllocateOffsets(ctx, &result->buffers[1]));
+    auto offsets = result->GetMutableValues<offset_type>(1);
+
+    // Substrings are no larger than their values, so the input's size is enough
+    std::shared_ptr<ResizableBuffer> chars;
+    RETURN_NOT_OK(
+        AllocateResizableBuffer(ctx->memory_pool(), values.data_size(), &chars));
+    uint8_t* out_chars = chars->mutable_data();
+
+    // In ASCII data characters are bytes
+    const bool is_ascii = values.IsAscii();
+    offset_type out_size = 0;
+    offsets[0] = 0;
+    for (int64_t i = 0; i < values.length; ++i) {
+      const uint8_t* value_end = values.value_end(i);
+      const uint8_t* begin;
+      const uint8_t* end = value_end;
+      if (is_ascii) {
+        begin = values.value_begin(i) +
+                std::min<int64_t>(options_.start, value_end - values.value_begin(i));
+        if (options_.length >= 0) {
+          end = begin + std::min<int64_t>(options_.length, value_end - begin);
+        }
+      } else {
+        begin = SkipCharacters(values.value_begin(i), value_end, options_.start);
+        if (options_.length >= 0) {
+          end = SkipCharacters(begin, value_end, options_.length);
+        }
+      }
+      std::memcpy(out_chars + out_size, begin, end - begin);
+      out_size += static_cast<offset_type>(end - begin);
+      offsets[i + 1] = out_size;
+    }
+
+    RETURN_NOT_OK(chars->Resize(out_size));
+    result->buffers[2] = std::move(chars);
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return type_; }
+
+ private:
+  std::shared_ptr<DataType> type_;
+  SubstringOptions options_;
+};
+
+// Instantiate Kernel for value's type, passing it args. Binary inputs are only
+// accepted if the kernel doesn't treat its input as UTF8.
+template <template <typename> class Kernel, typename... Args>
+Status MakeKernel(const Datum& value, bool accept_binary,
+                  std::unique_ptr<UnaryKernel>* kernel, Args&&... args) {
+  if (!value.is_arraylike()) {
+    return Status::Invalid("String functions require an array-like argument");
+  }
+  auto type = value.type();
+  switch (type->id()) {
+    case Type::STRING:
+      kernel->reset(new Kernel<StringType>(std::forward<Args>(args)...));
+      return Status::OK();
+    case Type::LARGE_STRING:
+      kernel->reset(new Kernel<LargeStringType>(std::forward<Args>(args)...));
+      return Status::OK();
+    case Type::BINARY:
+      if (accept_binary) {
+        kernel->reset(new Kernel<BinaryType>(std::forward<Args>(args)...));
+        return Status::OK();
+      }
+      break;
+    case Type::LARGE_BINARY:
+      if (accept_binary) {
+        kernel->reset(new Kernel<LargeBinaryType>(std::forward<Args>(args)...));
+        return Status::OK();
+      }
+      break;
+    default:
+      break;
+  }
+  return Status::NotImplemented("String function not implemented for type ", *type);
+}
+
+// Invoke a kernel with fixed width output, in morsels if ctx allows
+Status InvokeFixedWidth(FunctionContext* ctx, UnaryKernel* kernel, const Datum& value,
+                        Datum* out) {
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernelInMorsels(ctx, kernel, value, &outputs));
+  *out = detail::WrapDatumsLike(value, outputs);
+  return Status::OK();
+}
+
+// Invoke a kernel which allocates its own output
+Status InvokeVariableWidth(FunctionContext* ctx, UnaryKernel* kernel, const Datum& value,
+                           Datum* out) {
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(detail::InvokeUnaryArrayKernel(ctx, kernel, value, &outputs));
+  *out = detail::WrapDatumsLike(value, outputs);
+  return Status::OK();
+}
+
+}  // namespace
+
+Status BinaryLength(FunctionContext* ctx, const Datum& value, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeKernel<BinaryLengthKernel>(value, true, &kernel,
+                                               /*count_characters=*/false));
+  return InvokeFixedWidth(ctx, kernel.get(), value, out);
+}
+
+Status Utf8Length(FunctionContext* ctx, const Datum& value, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeKernel<BinaryLengthKernel>(value, false, &kernel,
+                                               /*count_characters=*/true));
+  return InvokeFixedWidth(ctx, kernel.get(), value, out);
+}
+
+Status AsciiUpper(FunctionContext* ctx, const Datum& value, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeKernel<AsciiUpperKernel>(value, true, &kernel, value.type()));
+  return InvokeVariableWidth(ctx, kernel.get(), value, out);
+}
+
+Status AsciiLower(FunctionContext* ctx, const Datum& value, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeKernel<AsciiLowerKernel>(value, true, &kernel, value.type()));
+  return InvokeVariableWidth(ctx, kernel.get(), value, out);
+}
+
+Status MatchSubstring(FunctionContext* ctx, const Datum& value,
+                      const std::string& pattern, Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeKernel<MatchSubstringKernel>(value, true, &kernel, pattern));
+  return InvokeFixedWidth(ctx, kernel.get(), value, out);
+}
+
+Status StartsWith(FunctionContext* ctx, const Datum& value, const std::string& pattern,
+                  Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeKernel<StartsWithKernel>(value, true, &kernel, pattern));
+  return InvokeFixedWidth(ctx, kernel.get(), value, out);
+}
+
+Status EndsWith(FunctionContext* ctx, const Datum& value, const std::string& pattern,
+                Datum* out) {
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(MakeKernel<EndsWithKernel>(value, true, &kernel, pattern));
+  return InvokeFixedWidth(ctx, kernel.get(), value, out);
+}
+
+Status Utf8Substring(FunctionContext* ctx, const Datum& value, SubstringOptions options,
+                     Datum* out) {
+  if (options.start < 0 || options.length < -1) {
+    return Status::Invalid("Invalid substring start ", options.start, " or length ",
+                           options.length);
+  }
+  std::unique_ptr<UnaryKernel> kernel;
+  RETURN_NOT_OK(
+      MakeKernel<SubstringKernel>(value, false, &kernel, value.type(), options));
+  return InvokeVariableWidth(ctx, kernel.get(), value, out);
+}
+
+}  // namespace compute
+}  // namespace arrow
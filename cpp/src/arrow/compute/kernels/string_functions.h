@@ -0,0 +1,127 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+
+class Status;
+
+namespace compute {
+
+struct Datum;
+class FunctionContext;
+
+/// \brief Compute the length in bytes of each value of a binary-like Array or
+/// ChunkedArray.
+///
+/// The output is int32 for binary and string inputs, int64 for large_binary
+/// and large_string inputs. Null values have a null length.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status BinaryLength(FunctionContext* ctx, const Datum& value, Datum* out);
+
+/// \brief Compute the number of characters (UTF8 code points) of each value of a
+/// string or large_string Array or ChunkedArray.
+///
+/// The output type is that of BinaryLength.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Length(FunctionContext* ctx, const Datum& value, Datum* out);
+
+/// \brief Convert the ASCII letters of each value of a binary-like Array or
+/// ChunkedArray to upper case.
+///
+/// Other bytes, including all bytes of non-ASCII UTF8 characters, are copied
+/// unchanged, so valid UTF8 stays valid.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiUpper(FunctionContext* ctx, const Datum& value, Datum* out);
+
+/// \brief Convert the ASCII letters of each value of a binary-like Array or
+/// ChunkedArray to lower case; see AsciiUpper.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status AsciiLower(FunctionContext* ctx, const Datum& value, Datum* out);
+
+/// \brief Emit whether each value of a binary-like Array or ChunkedArray contains
+/// pattern.
+///
+/// The output is a boolean Array or ChunkedArray, null where the input is null.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status MatchSubstring(FunctionContext* ctx, const Datum& value,
+                      const std::string& pattern, Datum* out);
+
+/// \brief Emit whether each value of a binary-like Array or ChunkedArray starts
+/// with pattern; see MatchSubstring.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status StartsWith(FunctionContext* ctx, const Datum& value, const std::string& pattern,
+                  Datum* out);
+
+/// \brief Emit whether each value of a binary-like Array or ChunkedArray ends
+/// with pattern; see MatchSubstring.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status EndsWith(FunctionContext* ctx, const Datum& value, const std::string& pattern,
+                Datum* out);
+
+struct ARROW_EXPORT SubstringOptions {
+  explicit SubstringOptions(int64_t start, int64_t length = -1)
+      : start(start), length(length) {}
+
+  /// Index of the first character of the substring; must not be negative
+  int64_t start;
+  /// Maximum number of characters of the substring, or -1 to take all characters
+  /// after start
+  int64_t length;
+};
+
+/// \brief Extract a substring of each value of a string or large_string Array
+/// or ChunkedArray.
+///
+/// Substrings are delimited by characters (UTF8 code points), not bytes. Values
+/// shorter than options.start yield an empty string.
+///
+/// \since 1.0.0
+/// \note API not yet finalized
+ARROW_EXPORT
+Status Utf8Substring(FunctionContext* ctx, const Datum& value, SubstringOptions options,
+                     Datum* out);
+
+}  // namespace compute
+}  // namespace arrow
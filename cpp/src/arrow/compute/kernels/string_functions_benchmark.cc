@@ -0,0 +1,104 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <vector>
+
+#include "arrow/compute/benchmark_util.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/string_functions.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace compute {
+
+constexpr auto kSeed = 0x94378165;
+
+// Strings of 0 to 16 characters, 8 on average
+constexpr int32_t kMaxStringLength = 16;
+
+static std::shared_ptr<Array> MakeStrings(const RegressionArgs& args) {
+  const int64_t array_size = args.size / (kMaxStringLength / 2);
+  auto rand = random::RandomArrayGenerator(kSeed);
+  return rand.String(array_size, 0, kMaxStringLength, args.null_proportion);
+}
+
+template <Status (*Func)(FunctionContext*, const Datum&, Datum*)>
+static void UnaryStringBenchmark(benchmark::State& state) {
+  RegressionArgs args(state);
+  auto values = MakeStrings(args);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Func(&ctx, values, &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+template <Status (*Func)(FunctionContext*, const Datum&, const std::string&, Datum*)>
+static void MatchStringBenchmark(benchmark::State& state) {
+  RegressionArgs args(state);
+  auto values = MakeStrings(args);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Func(&ctx, values, "abc", &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+static void Utf8LengthArray(benchmark::State& state) {
+  UnaryStringBenchmark<Utf8Length>(state);
+}
+
+static void AsciiUpperArray(benchmark::State& state) {
+  UnaryStringBenchmark<AsciiUpper>(state);
+}
+
+static void MatchSubstringArray(benchmark::State& state) {
+  MatchStringBenchmark<MatchSubstring>(state);
+}
+
+static void StartsWithArray(benchmark::State& state) {
+  MatchStringBenchmark<StartsWith>(state);
+}
+
+static void Utf8SubstringArray(benchmark::State& state) {
+  RegressionArgs args(state);
+  auto values = MakeStrings(args);
+
+  FunctionContext ctx;
+  for (auto _ : state) {
+    Datum out;
+    ABORT_NOT_OK(Utf8Substring(&ctx, values, SubstringOptions(2, 4), &out));
+    benchmark::DoNotOptimize(out);
+  }
+}
+
+BENCHMARK(Utf8LengthArray)->Apply(RegressionSetArgs);
+BENCHMARK(AsciiUpperArray)->Apply(RegressionSetArgs);
+BENCHMARK(MatchSubstringArray)->Apply(RegressionSetArgs);
+BENCHMARK(StartsWithArray)->Apply(RegressionSetArgs);
+BENCHMARK(Utf8SubstringArray)->Apply(RegressionSetArgs);
+
+}  // namespace compute
+}  // namespace arrow
@@ -0,0 +1,235 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/array.h"
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernel.h"
+#include "arrow/compute/kernels/string_functions.h"
+#include "arrow/compute/test_util.h"
+#include "arrow/type.h"
+#include "arrow/type_traits.h"
+#include "arrow/util/checked_cast.h"
+
+#include "arrow/testing/gtest_common.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+
+using internal::checked_pointer_cast;
+
+namespace compute {
+
+using MatchFunction = Status (*)(FunctionContext*, const Datum&, const std::string&,
+                                 Datum*);
+
+template <typename ArrowType>
+class TestStringFunctions : public ComputeFixture, public TestBase {
+ protected:
+  static std::shared_ptr<DataType> type() {
+    return TypeTraits<ArrowType>::type_singleton();
+  }
+
+  static std::shared_ptr<DataType> length_type() {
+    return std::is_same<typename ArrowType::offset_type, int32_t>::value ? int32()
+                                                                         : int64();
+  }
+
+  void AssertUnary(Status (*func)(FunctionContext*, const Datum&, Datum*),
+                   const Datum& value, const std::shared_ptr<DataType>& out_type,
+                   const std::string& expected) {
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, value, &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(out_type, expected), *actual);
+  }
+
+  void AssertMatch(MatchFunction func, const Datum& value, const std::string& pattern,
+                   const std::string& expected) {
+    Datum out;
+    ASSERT_OK(func(&this->ctx_, value, pattern, &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(boolean(), expected), *actual);
+  }
+
+  void AssertSubstring(const Datum& value, SubstringOptions options,
+                       const std::string& expected) {
+    Datum out;
+    ASSERT_OK(Utf8Substring(&this->ctx_, value, options, &out));
+    auto actual = out.make_array();
+    ASSERT_OK(actual->ValidateFull());
+    AssertArraysEqual(*ArrayFromJSON(type(), expected), *actual);
+  }
+};
+
+using StringArrowTypes = ::testing::Types<StringType, LargeStringType>;
+
+TYPED_TEST_CASE(TestStringFunctions, StringArrowTypes);
+
+TYPED_TEST(TestStringFunctions, Length) {
+  auto values = ArrayFromJSON(this->type(), R"(["abc", "", null, "été", "x"])");
+  this->AssertUnary(BinaryLength, values, this->length_type(), "[3, 0, null, 5, 1]");
+  this->AssertUnary(Utf8Length, values, this->length_type(), "[3, 0, null, 3, 1]");
+  this->AssertUnary(Utf8Length, values->Slice(3), this->length_type(), "[3, 1]");
+  this->AssertUnary(Utf8Length, values->Slice(0, 2), this->length_type(), "[3, 0]");
+  this->AssertUnary(Utf8Length, ArrayFromJSON(this->type(), "[]"), this->length_type(),
+                    "[]");
+}
+
+TYPED_TEST(TestStringFunctions, Case) {
+  auto values =
+      ArrayFromJSON(this->type(), R"(["aBc", null, "", "z@[`{é", "Hello World"])");
+  this->AssertUnary(AsciiUpper, values, this->type(),
+                    R"(["ABC", null, "", "Z@[`{é", "HELLO WORLD"])");
+  this->AssertUnary(AsciiLower, values, this->type(),
+                    R"(["abc", null, "", "z@[`{é", "hello world"])");
+  // Offsets which don't begin at zero are rebased
+  this->AssertUnary(AsciiUpper, values->Slice(3), this->type(),
+                    R"(["Z@[`{é", "HELLO WORLD"])");
+}
+
+TYPED_TEST(TestStringFunctions, MatchSubstring) {
+  auto values = ArrayFromJSON(this->type(),
+                              R"(["abab", "ab", "xa", "bx", null, "", "aab", "b"])");
+  this->AssertMatch(MatchSubstring, values, "ab",
+                    "[true, true, false, false, null, false, true, false]");
+  // No match may span two values
+  this->AssertMatch(MatchSubstring, values, "ax",
+                    "[false, false, false, false, null, false, false, false]");
+  this->AssertMatch(MatchSubstring, values, "abx",
+                    "[false, false, false, false, null, false, false, false]");
+  this->AssertMatch(MatchSubstring, values, "",
+                    "[true, true, true, true, null, true, true, true]");
+  this->AssertMatch(MatchSubstring, values->Slice(2), "b",
+                    "[false, true, null, false, true, true]");
+  this->AssertMatch(MatchSubstring, ArrayFromJSON(this->type(), R"(["", ""])"), "a",
+                    "[false, false]");
+}
+
+TYPED_TEST(TestStringFunctions, MatchAffix) {
+  auto values =
+      ArrayFromJSON(this->type(), R"(["abc", "ab", "a", null, "", "cab", "xabc"])");
+  this->AssertMatch(StartsWith, values, "ab",
+                    "[true, true, false, null, false, false, false]");
+  this->AssertMatch(EndsWith, values, "ab",
+                    "[false, true, false, null, false, true, false]");
+  this->AssertMatch(StartsWith, values, "",
+                    "[true, true, true, null, true, true, true]");
+  this->AssertMatch(EndsWith, values->Slice(5), "bc", "[false, true]");
+}
+
+TYPED_TEST(TestStringFunctions, Substring) {
+  auto values = ArrayFromJSON(this->type(), R"(["hello", "", null, "ab", "world!"])");
+  this->AssertSubstring(values, SubstringOptions(1, 3),
+                        R"(["ell", "", null, "b", "orl"])");
+  this->AssertSubstring(values, SubstringOptions(2), R"(["llo", "", null, "", "rld!"])");
+  this->AssertSubstring(values, SubstringOptions(0, 0), R"(["", "", null, "", ""])");
+  this->AssertSubstring(values->Slice(3), SubstringOptions(5), R"(["", "!"])");
+
+  auto multibyte = ArrayFromJSON(this->type(), R"(["été", "a€b", null, "é"])");
+  this->AssertSubstring(multibyte, SubstringOptions(1, 1), R"(["t", "€", null, ""])");
+  this->AssertSubstring(multibyte, SubstringOptions(1), R"(["té", "€b", null, ""])");
+
+  Datum out;
+  ASSERT_RAISES(Invalid, Utf8Substring(&this->ctx_, values, SubstringOptions(-1), &out));
+  ASSERT_RAISES(Invalid,
+                Utf8Substring(&this->ctx_, values, SubstringOptions(0, -2), &out));
+}
+
+TYPED_TEST(TestStringFunctions, ChunkedArrays) {
+  auto chunked = std::make_shared<ChunkedArray>(
+      ArrayVector{ArrayFromJSON(this->type(), R"(["Abc", null])"),
+                  ArrayFromJSON(this->type(), "[]"),
+                  ArrayFromJSON(this->type(), R"(["bcd"])")});
+  Datum out;
+  ASSERT_OK(MatchSubstring(&this->ctx_, chunked, "bc", &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(
+      {ArrayFromJSON(boolean(), "[true, null]"), ArrayFromJSON(boolean(), "[]"),
+       ArrayFromJSON(boolean(), "[true]")})));
+
+  ASSERT_OK(AsciiUpper(&this->ctx_, chunked, &out));
+  ASSERT_EQ(out.kind(), Datum::CHUNKED_ARRAY);
+  ASSERT_TRUE(out.chunked_array()->Equals(ChunkedArray(
+      {ArrayFromJSON(this->type(), R"(["ABC", null])"), ArrayFromJSON(this->type(), "[]"),
+       ArrayFromJSON(this->type(), R"(["BCD"])")})));
+}
+
+TEST(TestStringFunctionsInvalid, Types) {
+  FunctionContext ctx;
+  Datum out;
+  auto binary_values = ArrayFromJSON(binary(), R"(["ab", "c"])");
+  ASSERT_OK(BinaryLength(&ctx, binary_values, &out));
+  ASSERT_OK(StartsWith(&ctx, binary_values, "a", &out));
+  ASSERT_RAISES(NotImplemented, Utf8Length(&ctx, binary_values, &out));
+  ASSERT_RAISES(NotImplemented,
+                Utf8Substring(&ctx, binary_values, SubstringOptions(1), &out));
+  ASSERT_RAISES(NotImplemented,
+                BinaryLength(&ctx, ArrayFromJSON(int32(), "[1, 2]"), &out));
+}
+
+class TestStringFunctionsRandom : public ComputeFixture, public TestBase {
+ protected:
+  random::RandomArrayGenerator rand_{0x5742};
+};
+
+TEST_F(TestStringFunctionsRandom, MatchInMorsels) {
+  const int64_t length = 1000;
+  auto values = checked_pointer_cast<StringArray>(rand_.String(length + 5, 0, 8, 0.1));
+  auto sliced = checked_pointer_cast<StringArray>(values->Slice(5));
+  const std::string pattern = "ab";
+
+  BooleanBuilder contains_builder, starts_with_builder;
+  for (int64_t i = 0; i < sliced->length(); ++i) {
+    if (sliced->IsNull(i)) {
+      ASSERT_OK(contains_builder.AppendNull());
+      ASSERT_OK(starts_with_builder.AppendNull());
+      continue;
+    }
+    auto value = sliced->GetString(i);
+    ASSERT_OK(contains_builder.Append(value.find(pattern) != std::string::npos));
+    ASSERT_OK(starts_with_builder.Append(value.compare(0, 2, pattern) == 0));
+  }
+  std::shared_ptr<Array> contains, starts_with;
+  ASSERT_OK(contains_builder.Finish(&contains));
+  ASSERT_OK(starts_with_builder.Finish(&starts_with));
+
+  for (bool use_threads : {false, true}) {
+    ctx_.set_use_threads(use_threads);
+    ctx_.set_morsel_length(64);
+
+    Datum out;
+    ASSERT_OK(MatchSubstring(&ctx_, sliced, pattern, &out));
+    ASSERT_OK(out.make_array()->ValidateFull());
+    AssertArraysEqual(*contains, *out.make_array());
+
+    ASSERT_OK(StartsWith(&ctx_, sliced, pattern, &out));
+    AssertArraysEqual(*starts_with, *out.make_array());
+  }
+}
+
+}  // namespace compute
+}  // namespace arrow
@@ -15,12 +15,12 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
-#include "arrow/array/concatenate.h"
 #include "arrow/compute/kernels/take.h"
 #include "arrow/compute/kernels/take_internal.h"
 #include "arrow/util/logging.h"
@@ -101,26 +101,157 @@ Status Take(FunctionContext* ctx, const Datum& values, const Datum& indices,
   return kernel->Call(ctx, values, indices, out);
 }
 
+// Resolves logical indices into a ChunkedArray to the chunks which contain them by
+// binary search over the chunks' offsets. The most recently resolved chunk is checked
+// first, so runs of indices which fall in the same chunk needn't search.
+class ChunkResolver {
+ public:
+  explicit ChunkResolver(const ArrayVector& chunks) : offsets_(chunks.size() + 1, 0) {
+    for (size_t i = 0; i < chunks.size(); ++i) {
+      offsets_[i + 1] = offsets_[i] + chunks[i]->length();
+    }
+  }
+
+  // index must lie within [0, length of the ChunkedArray)
+  int ResolveChunk(int64_t index) {
+    if (index >= offsets_[cached_chunk_] && index < offsets_[cached_chunk_ + 1]) {
+      return cached_chunk_;
+    }
+    // the last chunk whose offset is not greater than index; this skips empty chunks
+    auto upper = std::upper_bound(offsets_.begin(), offsets_.end(), index);
+    cached_chunk_ = static_cast<int>(upper - offsets_.begin()) - 1;
+    return cached_chunk_;
+  }
+
+  int64_t chunk_offset(int chunk) const { return offsets_[chunk]; }
+
+ private:
+  std::vector<int64_t> offsets_;
+  int cached_chunk_ = 0;
+};
+
+// an IndexSequence which yields indices already resolved within a single chunk,
+// with -1 representing a null index
+class ChunkIndexSequence {
+ public:
+  constexpr bool never_out_of_bounds() const { return true; }
+  void set_never_out_of_bounds() {}
+
+  constexpr ChunkIndexSequence() = default;
+
+  ChunkIndexSequence(const int64_t* indices, int64_t length, int64_t null_count)
+      : indices_(indices), length_(length), null_count_(null_count) {}
+
+  std::pair<int64_t, bool> Next() {
+    auto index = *indices_++;
+    return std::make_pair(index, index >= 0);
+  }
+
+  int64_t length() const { return length_; }
+
+  int64_t null_count() const { return null_count_; }
+
+ private:
+  const int64_t* indices_ = nullptr;
+  int64_t length_ = 0, null_count_ = 0;
+};
+
+// Gather values from the chunks of a ChunkedArray without concatenating them. Indices
+// are resolved to their chunks and consecutive indices which fall in the same chunk
+// are taken from it together, so sorted indices are gathered in few large runs.
+// values must not be empty.
+template <typename IndexType>
+Status TakeFromChunks(FunctionContext* ctx, const ChunkedArray& values,
+                      const Array& indices, std::shared_ptr<Array>* out) {
+  const auto& typed_indices = checked_cast<const NumericArray<IndexType>&>(indices);
+  const int64_t length = indices.length();
+
+  std::unique_ptr<Taker<ChunkIndexSequence>> taker;
+  RETURN_NOT_OK(Taker<ChunkIndexSequence>::Make(values.type(), &taker));
+  RETURN_NOT_OK(taker->SetContext(ctx));
+
+  std::shared_ptr<Buffer> chunk_indices_buffer;
+  RETURN_NOT_OK(AllocateBuffer(ctx->memory_pool(), length * sizeof(int64_t),
+                               &chunk_indices_buffer));
+  auto chunk_indices = reinterpret_cast<int64_t*>(chunk_indices_buffer->mutable_data());
+
+  ChunkResolver resolver(values.chunks());
+  int64_t run_start = 0, run_null_count = 0;
+  // null indices before the first valid one are taken along with the first non-empty
+  // chunk; taking them from an empty chunk could read its buffers out of bounds
+  int run_chunk = resolver.ResolveChunk(0);
+
+  auto take_run = [&](int64_t run_end) {
+    if (run_end > run_start) {
+      RETURN_NOT_OK(taker->Take(*values.chunk(run_chunk),
+                                ChunkIndexSequence(chunk_indices + run_start,
+                                                   run_end - run_start, run_null_count)));
+    }
+    run_start = run_end;
+    run_null_count = 0;
+    return Status::OK();
+  };
+
+  for (int64_t i = 0; i < length; ++i) {
+    if (typed_indices.IsNull(i)) {
+      // null indices can be taken along with any chunk
+      chunk_indices[i] = -1;
+      ++run_null_count;
+      continue;
+    }
+
+    auto index = static_cast<int64_t>(typed_indices.Value(i));
+    if (index < 0 || index >= values.length()) {
+      return Status::IndexError("take index out of bounds");
+    }
+
+    auto chunk = resolver.ResolveChunk(index);
+    if (chunk != run_chunk) {
+      RETURN_NOT_OK(take_run(i));
+      run_chunk = chunk;
+    }
+    chunk_indices[i] = index - resolver.chunk_offset(chunk);
+  }
+  RETURN_NOT_OK(take_run(length));
+
+  return taker->Finish(out);
+}
+
+struct TakeFromChunksVisitor {
+  template <typename IndexType>
+  enable_if_integer<IndexType, Status> Visit(const IndexType&) {
+    return TakeFromChunks<IndexType>(ctx_, values_, indices_, out_);
+  }
+
+  Status Visit(const DataType& other) {
+    return Status::TypeError("index type not supported: ", other);
+  }
+
+  FunctionContext* ctx_;
+  const ChunkedArray& values_;
+  const Array& indices_;
+  std::shared_ptr<Array>* out_;
+};
+
 Status Take(FunctionContext* ctx, const ChunkedArray& values, const Array& indices,
             const TakeOptions& options, std::shared_ptr<ChunkedArray>* out) {
-  auto num_chunks = values.num_chunks();
-  std::vector<std::shared_ptr<Array>> new_chunks(1);  // Hard-coded 1 for now
-  std::shared_ptr<Array> current_chunk;
+  std::vector<std::shared_ptr<Array>> new_chunks(1);
 
-  // Case 1: `values` has a single chunk, so just use it
-  if (num_chunks == 1) {
-    current_chunk = values.chunk(0);
+  if (values.num_chunks() == 1) {
+    // Call Array Take on our single chunk
+    RETURN_NOT_OK(Take(ctx, *values.chunk(0), indices, options, &new_chunks[0]));
+  } else if (values.length() == 0) {
+    // Only null indices can be taken from empty chunks, and they yield nulls
+    if (indices.null_count() != indices.length()) {
+      return Status::IndexError("take index out of bounds");
+    }
+    RETURN_NOT_OK(MakeArrayOfNull(ctx->memory_pool(), values.type(), indices.length(),
+                                  &new_chunks[0]));
   } else {
-    // TODO Case 2: See if all `indices` fall in the same chunk and call Array Take on it
-    // See
-    // https://github.com/apache/arrow/blob/6f2c9041137001f7a9212f244b51bc004efc29af/r/src/compute.cpp#L123-L151
-    // TODO Case 3: If indices are sorted, can slice them and call Array Take
-
-    // Case 4: Else, concatenate chunks and call Array Take
-    RETURN_NOT_OK(Concatenate(values.chunks(), default_memory_pool(), &current_chunk));
+    TakeFromChunksVisitor visitor{ctx, values, indices, &new_chunks[0]};
+    RETURN_NOT_OK(VisitTypeInline(*indices.type(), &visitor));
   }
-  // Call Array Take on our single chunk
-  RETURN_NOT_OK(Take(ctx, *current_chunk, indices, options, &new_chunks[0]));
+
   *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
   return Status::OK();
 }
@@ -132,13 +263,9 @@ Status Take(FunctionContext* ctx, const ChunkedArray& values, const ChunkedArray
   std::shared_ptr<ChunkedArray> current_chunk;
 
   for (int i = 0; i < num_chunks; i++) {
-    // Take with that indices chunk
-    // Note that as currently implemented, this is inefficient because `values`
-    // will get concatenated on every iteration of this loop
+    // Take with that indices chunk, which yields a single chunk
     RETURN_NOT_OK(Take(ctx, values, *indices.chunk(i), options, &current_chunk));
-    // Concatenate the result to make a single array for this chunk
-    RETURN_NOT_OK(
-        Concatenate(current_chunk->chunks(), default_memory_pool(), &new_chunks[i]));
+    new_chunks[i] = current_chunk->chunk(0);
   }
   *out = std::make_shared<ChunkedArray>(std::move(new_chunks));
   return Status::OK();
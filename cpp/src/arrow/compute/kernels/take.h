@@ -64,6 +64,9 @@ Status Take(FunctionContext* ctx, const Array& values, const Array& indices,
 /// = [values[2], values[1], null, values[3]]
 /// = ["c", "b", null, null]
 ///
+/// The output will have a single chunk. Values are gathered directly from the
+/// chunks of the input, which are not concatenated.
+///
 /// \param[in] ctx the FunctionContext
 /// \param[in] values chunked array from which to take
 /// \param[in] indices which values to take
@@ -118,6 +118,44 @@ static void TakeString(benchmark::State& state) {
   TakeBenchmark(state, values, indices);
 }
 
+// Take from a ChunkedArray of state.range(1) chunks, with indices in random or
+// ascending order (state.range(2))
+static void TakeChunkedInt64(benchmark::State& state) {
+  const int64_t array_size = state.range(0);
+  const int64_t num_chunks = state.range(1);
+  const bool sorted = state.range(2) != 0;
+
+  auto rand = random::RandomArrayGenerator(kSeed);
+  auto values = rand.Int64(array_size, -100, 100, /*null_probability=*/0);
+  ArrayVector chunks;
+  const int64_t chunk_size = array_size / num_chunks;
+  for (int64_t offset = 0; offset < array_size; offset += chunk_size) {
+    chunks.push_back(values->Slice(offset, chunk_size));
+  }
+  ChunkedArray chunked_values(chunks);
+
+  std::shared_ptr<Array> indices;
+  if (sorted) {
+    Int64Builder builder;
+    ABORT_NOT_OK(builder.Resize(array_size));
+    for (int64_t i = 0; i < array_size; ++i) {
+      builder.UnsafeAppend(i);
+    }
+    ABORT_NOT_OK(builder.Finish(&indices));
+  } else {
+    indices = rand.Int64(array_size, 0, array_size - 1, /*null_probability=*/0);
+  }
+
+  FunctionContext ctx;
+  TakeOptions options;
+  for (auto _ : state) {
+    std::shared_ptr<ChunkedArray> out;
+    ABORT_NOT_OK(Take(&ctx, chunked_values, *indices, options, &out));
+    benchmark::DoNotOptimize(out);
+  }
+  state.SetItemsProcessed(state.iterations() * array_size);
+}
+
 BENCHMARK(TakeInt64)
     ->Apply(RegressionSetArgs)
     ->Args({1 << 20, 1})
@@ -146,5 +184,17 @@ BENCHMARK(TakeString)
     ->MinTime(1.0)
     ->Unit(benchmark::TimeUnit::kNanosecond);
 
+// Array length, number of chunks, whether indices are sorted
+static void TakeChunkedSetArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t num_chunks : {1, 16, 256}) {
+    for (int64_t sorted : {0, 1}) {
+      bench->Args({1 << 20, num_chunks, sorted});
+    }
+  }
+  bench->Unit(benchmark::TimeUnit::kMicrosecond);
+}
+
+BENCHMARK(TakeChunkedInt64)->Apply(TakeChunkedSetArgs);
+
 }  // namespace compute
 }  // namespace arrow
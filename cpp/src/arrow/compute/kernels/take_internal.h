@@ -21,6 +21,7 @@
 #include <limits>
 #include <memory>
 #include <type_traits>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -686,18 +687,26 @@ class TakerImpl<IndexSequence, DictionaryType> : public Taker<IndexSequence> {
 
   Status SetContext(FunctionContext* ctx) override {
     dictionary_ = nullptr;
+    equal_dictionaries_.clear();
     return index_taker_->SetContext(ctx);
   }
 
   Status Take(const Array& values, IndexSequence indices) override {
     DCHECK(this->type_->Equals(values.type()));
     const auto& dict_array = checked_cast<const DictionaryArray&>(values);
-
-    if (dictionary_ != nullptr && dictionary_ != dict_array.dictionary()) {
-      return Status::NotImplemented(
-          "taking from DictionaryArrays with different dictionaries");
-    } else {
-      dictionary_ = dict_array.dictionary();
+    const auto& dictionary = dict_array.dictionary();
+
+    // chunks of a ChunkedArray often carry separate but equal dictionaries. Each
+    // is only compared the first time it is taken from, as scattered indices
+    // take from the same chunks many times.
+    if (dictionary_ == nullptr) {
+      dictionary_ = dictionary;
+    } else if (dictionary != dictionary_ && equal_dictionaries_.count(dictionary) == 0) {
+      if (!dictionary_->Equals(*dictionary)) {
+        return Status::NotImplemented(
+            "taking from DictionaryArrays with different dictionaries");
+      }
+      equal_dictionaries_.insert(dictionary);
     }
     return index_taker_->Take(*dict_array.indices(), indices);
   }
@@ -711,6 +720,9 @@ class TakerImpl<IndexSequence, DictionaryType> : public Taker<IndexSequence> {
 
  protected:
   std::shared_ptr<Array> dictionary_;
+  // dictionaries found equal to dictionary_, kept alive so that their addresses
+  // can't be reused by another dictionary
+  std::unordered_set<std::shared_ptr<Array>> equal_dictionaries_;
   std::unique_ptr<Taker<IndexSequence>> index_taker_;
 };
 
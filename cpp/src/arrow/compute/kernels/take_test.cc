@@ -640,6 +640,93 @@ TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedArray) {
                                                        {"[0, 1, 0]", "[5, 1]"}, &arr));
 }
 
+TEST_F(TestTakeKernelWithChunkedArray, TakeRandomChunkedArray) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  const int64_t length = 1 << 10;
+  for (auto values :
+       {rand.Int64(length, -100, 100, 0.1), rand.String(length, 0, 8, 0.1)}) {
+    // chunks of varying size, including empty ones
+    ArrayVector chunks;
+    int64_t offset = 0;
+    for (int64_t chunk_length : {0, 1, 100, 0, 300, 7, 616}) {
+      chunks.push_back(values->Slice(offset, chunk_length));
+      offset += chunk_length;
+    }
+    ASSERT_EQ(offset, length);
+    ChunkedArray chunked_values(chunks);
+
+    for (auto null_probability : {0.0, 0.1}) {
+      auto indices = rand.Int32(length, 0, length - 1, null_probability);
+
+      std::shared_ptr<Array> expected;
+      std::shared_ptr<ChunkedArray> actual;
+      ASSERT_OK(arrow::compute::Take(&this->ctx_, *values, *indices, {}, &expected));
+      ASSERT_OK(arrow::compute::Take(&this->ctx_, chunked_values, *indices, {}, &actual));
+      ASSERT_OK(actual->ValidateFull());
+      AssertChunkedEqual(ChunkedArray({expected}), *actual);
+    }
+
+    // sorted indices are taken in runs from each chunk
+    Int32Builder builder;
+    for (int32_t i = 0; i < length; ++i) {
+      ASSERT_OK(builder.Append(i));
+    }
+    std::shared_ptr<Array> ascending, out_of_bounds;
+    ASSERT_OK(builder.Finish(&ascending));
+    std::shared_ptr<ChunkedArray> actual;
+    ASSERT_OK(arrow::compute::Take(&this->ctx_, chunked_values, *ascending, {}, &actual));
+    ASSERT_OK(actual->ValidateFull());
+    AssertChunkedEqual(ChunkedArray({values}), *actual);
+
+    ASSERT_OK(builder.AppendValues({0, static_cast<int32_t>(length)}));
+    ASSERT_OK(builder.Finish(&out_of_bounds));
+    ASSERT_RAISES(IndexError, arrow::compute::Take(&this->ctx_, chunked_values,
+                                                   *out_of_bounds, {}, &actual));
+  }
+}
+
+TEST_F(TestTakeKernelWithChunkedArray, TakeChunkedDictionary) {
+  // each chunk has its own dictionary, but they are all equal
+  auto type = dictionary(int8(), utf8());
+  auto MakeChunk = [&](const std::string& indices, const std::string& dictionary) {
+    std::shared_ptr<Array> chunk;
+    ABORT_NOT_OK(DictionaryArray::FromArrays(type, ArrayFromJSON(int8(), indices),
+                                             ArrayFromJSON(utf8(), dictionary), &chunk));
+    return chunk;
+  };
+  ChunkedArray values({MakeChunk("[0, 1]", R"(["a", "b"])"),
+                       MakeChunk("[1, null, 0]", R"(["a", "b"])"),
+                       MakeChunk("[1]", R"(["a", "b"])")});
+
+  std::shared_ptr<ChunkedArray> actual;
+  ASSERT_OK(arrow::compute::Take(&this->ctx_, values,
+                                 *ArrayFromJSON(int8(), "[4, 1, 5, 3, 2, 5, 0, null]"),
+                                 {}, &actual));
+  ASSERT_OK(actual->ValidateFull());
+  AssertChunkedEqual(
+      ChunkedArray({MakeChunk("[0, 1, 1, null, 1, 1, 0, null]", R"(["a", "b"])")}),
+      *actual);
+
+  ChunkedArray unequal_values({MakeChunk("[0, 1]", R"(["a", "b"])"),
+                               MakeChunk("[0]", R"(["c"])")});
+  ASSERT_RAISES(NotImplemented,
+                arrow::compute::Take(&this->ctx_, unequal_values,
+                                     *ArrayFromJSON(int8(), "[0, 2]"), {}, &actual));
+}
+
+TEST_F(TestTakeKernelWithChunkedArray, NullIndicesWithEmptyChunks) {
+  // null indices must not be taken from an empty chunk, whose buffers may be empty
+  auto type = union_({field("a", int32()), field("b", utf8())}, {2, 5}, UnionMode::DENSE);
+  this->AssertTake(type, {"[]", "[[5, \"eh\"]]"}, "[null, null, 0]",
+                   {"[null, null, [5, \"eh\"]]"});
+  this->AssertTake(type, {"[]", "[null, [2, 1]]"}, "[null]", {"[null]"});
+  this->AssertChunkedTake(type, {"[]", "[]"}, {"[null, null]", "[]"},
+                          {"[null, null]", "[]"});
+
+  std::shared_ptr<ChunkedArray> arr;
+  ASSERT_RAISES(IndexError, this->TakeWithArray(type, {"[]", "[]"}, "[null, 0]", &arr));
+}
+
 class TestTakeKernelWithTable : public TestTakeKernel<Table> {
  public:
   void AssertTake(const std::shared_ptr<Schema>& schm,
@@ -19,6 +19,7 @@
 
 #include <algorithm>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -29,6 +30,7 @@
 #include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/parallel.h"
 
 #include "arrow/compute/context.h"
 #include "arrow/compute/kernel.h"
@@ -97,9 +99,13 @@ Status InvokeUnaryArrayKernel(FunctionContext* ctx, UnaryKernel* kernel,
   return Status::OK();
 }
 
-Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
-                               const Datum& left, const Datum& right,
-                               std::vector<Datum>* outputs) {
+namespace {
+
+using ArrayPair = std::pair<std::shared_ptr<Array>, std::shared_ptr<Array>>;
+
+// Slice left and right into pairs of equal length, each of which lies within a single
+// chunk of both inputs
+Status AlignChunks(const Datum& left, const Datum& right, std::vector<ArrayPair>* out) {
   int64_t left_length;
   std::vector<std::shared_ptr<Array>> left_arrays;
   if (left.kind() == Datum::ARRAY) {
@@ -139,13 +145,8 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
     const std::shared_ptr<Array> right_array = right_arrays[right_chunk_idx];
     int64_t common_length = std::min(left_array->length() - left_start_idx,
                                      right_array->length() - right_start_idx);
-    std::shared_ptr<Array> left_op = left_array->Slice(left_start_idx, common_length);
-    std::shared_ptr<Array> right_op = right_array->Slice(right_start_idx, common_length);
-
-    Datum output;
-    output.value = ArrayData::Make(kernel->out_type(), common_length);
-    RETURN_NOT_OK(kernel->Call(ctx, left_op, right_op, &output));
-    outputs->push_back(output);
+    out->emplace_back(left_array->Slice(left_start_idx, common_length),
+                      right_array->Slice(right_start_idx, common_length));
 
     elements_compared += common_length;
     // If we have exhausted the current chunk, proceed to the next one individually.
@@ -166,6 +167,115 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
   return Status::OK();
 }
 
+// Invokes a kernel on the morsel [offset, offset + length) of one piece of input
+using MorselCall = std::function<Status(FunctionContext* ctx, size_t piece,
+                                        int64_t offset, int64_t length, Datum* out)>;
+
+struct Morsel {
+  size_t piece;
+  int64_t offset, length;
+  std::shared_ptr<ArrayData> out;
+};
+
+// Execute a kernel with fixed width output on morsels of several pieces of input,
+// each of which yields one output array
+Status ExecuteMorsels(FunctionContext* ctx, const std::shared_ptr<DataType>& out_type,
+                      const std::vector<int64_t>& piece_lengths, const MorselCall& call,
+                      std::vector<Datum>* outputs) {
+  const int bit_width = checked_cast<const FixedWidthType&>(*out_type).bit_width();
+  const int64_t morsel_length = ctx->morsel_length();
+  DCHECK_EQ(morsel_length % 64, 0);
+
+  // Preallocate each piece's values; each morsel's values are a slice of those
+  std::vector<std::shared_ptr<ArrayData>> piece_outputs(piece_lengths.size());
+  std::vector<Morsel> morsels;
+  for (size_t piece = 0; piece < piece_lengths.size(); ++piece) {
+    const int64_t length = piece_lengths[piece];
+    auto out = ArrayData::Make(out_type, length, {NULLPTR, NULLPTR});
+    RETURN_NOT_OK(AllocateValueBuffer(ctx, *out_type, length, &out->buffers[1]));
+
+    for (int64_t offset = 0; offset < length; offset += morsel_length) {
+      const int64_t length_in_morsel = std::min(morsel_length, length - offset);
+      auto values =
+          SliceMutableBuffer(out->buffers[1], offset * bit_width / 8,
+                             BitUtil::BytesForBits(length_in_morsel * bit_width));
+      morsels.push_back({piece, offset, length_in_morsel,
+                         ArrayData::Make(out_type, length_in_morsel, {NULLPTR, values})});
+    }
+    piece_outputs[piece] = std::move(out);
+  }
+
+  auto execute = [&](int i) {
+    const Morsel& morsel = morsels[i];
+    // FunctionContext's status isn't synchronized, so each morsel gets its own
+    FunctionContext morsel_ctx(ctx->memory_pool());
+    Datum out(morsel.out);
+    RETURN_NOT_OK(call(&morsel_ctx, morsel.piece, morsel.offset, morsel.length, &out));
+    ARROW_RETURN_IF_ERROR((&morsel_ctx));
+    DCHECK_EQ(out.array(), morsel.out);
+    DCHECK_EQ(out.array()->buffers[1]->data(), morsel.out->buffers[1]->data());
+    return Status::OK();
+  };
+
+  const auto num_morsels = static_cast<int>(morsels.size());
+  if (ctx->use_threads() && num_morsels > 1) {
+    RETURN_NOT_OK(internal::ParallelFor(num_morsels, execute));
+  } else {
+    for (int i = 0; i < num_morsels; ++i) {
+      RETURN_NOT_OK(execute(i));
+    }
+  }
+
+  // Stitch the morsels' validity bitmaps together
+  auto morsel = morsels.begin();
+  for (size_t piece = 0; piece < piece_outputs.size(); ++piece) {
+    auto piece_end = std::find_if(morsel, morsels.end(),
+                                  [&](const Morsel& m) { return m.piece != piece; });
+
+    auto& out = piece_outputs[piece];
+    out->null_count = 0;
+    for (auto it = morsel; it != piece_end; ++it) {
+      out->null_count += it->out->GetNullCount();
+    }
+
+    if (out->null_count != 0) {
+      RETURN_NOT_OK(
+          AllocateEmptyBitmap(ctx->memory_pool(), out->length, &out->buffers[0]));
+      uint8_t* bitmap = out->buffers[0]->mutable_data();
+      for (auto it = morsel; it != piece_end; ++it) {
+        const ArrayData& morsel_out = *it->out;
+        if (morsel_out.null_count == 0) {
+          BitUtil::SetBitsTo(bitmap, it->offset, it->length, true);
+        } else {
+          internal::CopyBitmap(morsel_out.buffers[0]->data(), morsel_out.offset,
+                               it->length, bitmap, it->offset);
+        }
+      }
+    }
+
+    outputs->push_back(Datum(out));
+    morsel = piece_end;
+  }
+  return Status::OK();
+}
+
+}  // namespace
+
+Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
+                               const Datum& left, const Datum& right,
+                               std::vector<Datum>* outputs) {
+  std::vector<ArrayPair> pieces;
+  RETURN_NOT_OK(AlignChunks(left, right, &pieces));
+
+  for (const auto& piece : pieces) {
+    Datum output;
+    output.value = ArrayData::Make(kernel->out_type(), piece.first->length());
+    RETURN_NOT_OK(kernel->Call(ctx, piece.first, piece.second, &output));
+    outputs->push_back(output);
+  }
+  return Status::OK();
+}
+
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right, Datum* output) {
   std::vector<Datum> result;
@@ -174,6 +284,65 @@ Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
   return Status::OK();
 }
 
+Status InvokeUnaryArrayKernelInMorsels(FunctionContext* ctx, UnaryKernel* kernel,
+                                       const Datum& value, std::vector<Datum>* outputs) {
+  if (!ctx->use_threads()) {
+    PrimitiveAllocatingUnaryKernel allocating_kernel(kernel);
+    return InvokeUnaryArrayKernel(ctx, &allocating_kernel, value, outputs);
+  }
+
+  std::vector<std::shared_ptr<Array>> chunks;
+  if (value.kind() == Datum::ARRAY) {
+    chunks.push_back(value.make_array());
+  } else if (value.kind() == Datum::CHUNKED_ARRAY) {
+    chunks = value.chunked_array()->chunks();
+  } else {
+    return Status::Invalid("Input Datum was not array-like");
+  }
+
+  std::vector<int64_t> chunk_lengths;
+  for (const auto& chunk : chunks) {
+    chunk_lengths.push_back(chunk->length());
+  }
+
+  return ExecuteMorsels(
+      ctx, kernel->out_type(), chunk_lengths,
+      [&](FunctionContext* morsel_ctx, size_t chunk, int64_t offset, int64_t length,
+          Datum* out) {
+        return kernel->Call(morsel_ctx, chunks[chunk]->Slice(offset, length), out);
+      },
+      outputs);
+}
+
+Status InvokeBinaryArrayKernelInMorsels(FunctionContext* ctx, BinaryKernel* kernel,
+                                        const Datum& left, const Datum& right,
+                                        Datum* output) {
+  if (!ctx->use_threads()) {
+    PrimitiveAllocatingBinaryKernel allocating_kernel(kernel);
+    return InvokeBinaryArrayKernel(ctx, &allocating_kernel, left, right, output);
+  }
+
+  std::vector<ArrayPair> pieces;
+  RETURN_NOT_OK(AlignChunks(left, right, &pieces));
+
+  std::vector<int64_t> piece_lengths;
+  for (const auto& piece : pieces) {
+    piece_lengths.push_back(piece.first->length());
+  }
+
+  std::vector<Datum> outputs;
+  RETURN_NOT_OK(ExecuteMorsels(
+      ctx, kernel->out_type(), piece_lengths,
+      [&](FunctionContext* morsel_ctx, size_t piece, int64_t offset, int64_t length,
+          Datum* out) {
+        return kernel->Call(morsel_ctx, pieces[piece].first->Slice(offset, length),
+                            pieces[piece].second->Slice(offset, length), out);
+      },
+      &outputs));
+  *output = detail::WrapDatumsLike(left, outputs);
+  return Status::OK();
+}
+
 Datum WrapArraysLike(const Datum& value,
                      const std::vector<std::shared_ptr<Array>>& arrays) {
   // Create right kind of datum
@@ -62,6 +62,34 @@ ARROW_EXPORT
 Status InvokeBinaryArrayKernel(FunctionContext* ctx, BinaryKernel* kernel,
                                const Datum& left, const Datum& right, Datum* output);
 
+/// \brief Invoke a kernel with fixed width output on morsels of value.
+///
+/// If ctx->use_threads(), each chunk of value is split into morsels of
+/// ctx->morsel_length() elements which are executed on the CPU thread pool.
+/// Each morsel's output is handed to the kernel with its value buffer
+/// preallocated as a slice of the final output's value buffer; validity
+/// bitmaps are stitched together afterwards. Otherwise this is equivalent to
+/// InvokeUnaryArrayKernel with a PrimitiveAllocatingUnaryKernel.
+///
+/// The kernel must write its values only into the preallocated buffer and must
+/// be safe to call concurrently. Each morsel is given its own FunctionContext
+/// sharing ctx's memory pool, so errors set with SetStatus are raised.
+///
+/// \param[in,out] ctx The function context to use when invoking the kernel.
+/// \param[in,out] kernel The kernel to execute.
+/// \param[in] value The input value to execute the kernel with.
+/// \param[out] outputs One ArrayData datum for each ArrayData available in value.
+ARROW_EXPORT
+Status InvokeUnaryArrayKernelInMorsels(FunctionContext* ctx, UnaryKernel* kernel,
+                                       const Datum& value, std::vector<Datum>* outputs);
+
+/// \brief Invoke a binary kernel with fixed width output on morsels of left
+/// and right; see InvokeUnaryArrayKernelInMorsels.
+ARROW_EXPORT
+Status InvokeBinaryArrayKernelInMorsels(FunctionContext* ctx, BinaryKernel* kernel,
+                                        const Datum& left, const Datum& right,
+                                        Datum* output);
+
 /// \brief Assign validity bitmap to output, copying bitmap if necessary, but
 /// zero-copy otherwise, so that the same value slots are valid/not-null in the
 /// output (sliced arrays).
@@ -26,7 +26,9 @@
 #include "arrow/array.h"
 #include "arrow/buffer.h"
 #include "arrow/compute/kernels/util_internal.h"
+#include "arrow/compute/context.h"
 #include "arrow/compute/test_util.h"
+#include "arrow/testing/random.h"
 
 namespace arrow {
 namespace compute {
@@ -242,6 +244,142 @@ TEST(PrimitiveAllocatingBinaryKernel, NonBoolean) {
   EXPECT_THAT(value_buffer->capacity(), Ge(64));
 }
 
+// Writes the negation of an int32 input into its preallocated output
+class NegateInt32Kernel : public UnaryKernel {
+ public:
+  Status Call(FunctionContext* ctx, const Datum& input, Datum* out) override {
+    const ArrayData& in_data = *input.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(PropagateNulls(ctx, in_data, result));
+    const int32_t* in_values = in_data.GetValues<int32_t>(1);
+    int32_t* out_values = result->GetMutableValues<int32_t>(1);
+    for (int64_t i = 0; i < in_data.length; ++i) {
+      if (in_values[i] == fail_on_) {
+        ctx->SetStatus(Status::Invalid("negating ", fail_on_));
+      }
+      out_values[i] = -in_values[i];
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int32(); }
+
+  int32_t fail_on_ = 1000;
+};
+
+// Writes the sum of two int32 inputs into its preallocated output
+class AddInt32Kernel : public BinaryKernel {
+ public:
+  Status Call(FunctionContext* ctx, const Datum& left, const Datum& right,
+              Datum* out) override {
+    const ArrayData& left_data = *left.array();
+    const ArrayData& right_data = *right.array();
+    ArrayData* result = out->array().get();
+    RETURN_NOT_OK(AssignNullIntersection(ctx, left_data, right_data, result));
+    const int32_t* left_values = left_data.GetValues<int32_t>(1);
+    const int32_t* right_values = right_data.GetValues<int32_t>(1);
+    int32_t* out_values = result->GetMutableValues<int32_t>(1);
+    for (int64_t i = 0; i < left_data.length; ++i) {
+      out_values[i] = left_values[i] + right_values[i];
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<DataType> out_type() const override { return int32(); }
+};
+
+class TestInvokeInMorsels : public ::testing::Test {
+ public:
+  void SetUp() override {
+    threaded_ctx_.set_use_threads(true);
+    // several morsels per chunk, and chunks which begin mid-morsel
+    threaded_ctx_.set_morsel_length(64);
+  }
+
+  std::shared_ptr<ChunkedArray> MakeChunked(const std::shared_ptr<Array>& array,
+                                            const std::vector<int64_t>& chunk_lengths) {
+    ArrayVector chunks;
+    int64_t offset = 0;
+    for (auto length : chunk_lengths) {
+      chunks.push_back(array->Slice(offset, length));
+      offset += length;
+    }
+    return std::make_shared<ChunkedArray>(chunks);
+  }
+
+  void AssertDatumsEqual(const Datum& expected, const Datum& actual) {
+    ASSERT_EQ(expected.kind(), actual.kind());
+    if (expected.kind() == Datum::ARRAY) {
+      ASSERT_OK(actual.make_array()->ValidateFull());
+      AssertArraysEqual(*expected.make_array(), *actual.make_array());
+    } else {
+      ASSERT_OK(actual.chunked_array()->ValidateFull());
+      AssertChunkedEqual(*expected.chunked_array(), *actual.chunked_array());
+    }
+  }
+
+ protected:
+  random::RandomArrayGenerator rand_{0x5eed};
+  FunctionContext serial_ctx_, threaded_ctx_;
+};
+
+TEST_F(TestInvokeInMorsels, MorselLengthIsMultipleOf64) {
+  FunctionContext ctx;
+  EXPECT_EQ(ctx.morsel_length(), FunctionContext::kDefaultMorselLength);
+  ctx.set_morsel_length(100);
+  EXPECT_EQ(ctx.morsel_length(), 128);
+  ctx.set_morsel_length(0);
+  EXPECT_EQ(ctx.morsel_length(), 64);
+}
+
+TEST_F(TestInvokeInMorsels, Unary) {
+  NegateInt32Kernel kernel;
+  for (auto null_probability : {0.0, 0.1, 1.0}) {
+    auto array = rand_.Int32(1000, -100, 100, null_probability);
+    for (Datum input : {Datum(array), Datum(array->Slice(3, 900)),
+                        Datum(MakeChunked(array, {0, 7, 500, 64, 429}))}) {
+      std::vector<Datum> expected, actual;
+      ASSERT_OK(InvokeUnaryArrayKernelInMorsels(&serial_ctx_, &kernel, input, &expected));
+      ASSERT_OK(
+          InvokeUnaryArrayKernelInMorsels(&threaded_ctx_, &kernel, input, &actual));
+      AssertDatumsEqual(WrapDatumsLike(input, expected), WrapDatumsLike(input, actual));
+    }
+  }
+}
+
+TEST_F(TestInvokeInMorsels, UnaryRaisesStatusOfMorsel) {
+  NegateInt32Kernel kernel;
+  kernel.fail_on_ = 101;
+  auto array = rand_.Int32(1000, -100, 100, 0);
+  std::vector<Datum> outputs;
+  ASSERT_OK(InvokeUnaryArrayKernelInMorsels(&threaded_ctx_, &kernel, array, &outputs));
+
+  std::shared_ptr<Array> fail_on;
+  ASSERT_OK(MakeArrayFromScalar(Int32Scalar(101), 1000, &fail_on));
+  ASSERT_RAISES(Invalid, InvokeUnaryArrayKernelInMorsels(&threaded_ctx_, &kernel,
+                                                         fail_on, &outputs));
+}
+
+TEST_F(TestInvokeInMorsels, Binary) {
+  AddInt32Kernel kernel;
+  for (auto null_probability : {0.0, 0.1}) {
+    auto left = rand_.Int32(1000, -100, 100, null_probability);
+    auto right = rand_.Int32(1000, -100, 100, null_probability);
+    std::vector<std::pair<Datum, Datum>> inputs = {
+        {left, right},
+        {left->Slice(5, 900), right->Slice(63, 900)},
+        {MakeChunked(left, {100, 900}), MakeChunked(right, {0, 333, 667})}};
+    for (const auto& input : inputs) {
+      Datum expected, actual;
+      ASSERT_OK(InvokeBinaryArrayKernelInMorsels(&serial_ctx_, &kernel, input.first,
+                                                 input.second, &expected));
+      ASSERT_OK(InvokeBinaryArrayKernelInMorsels(&threaded_ctx_, &kernel, input.first,
+                                                 input.second, &actual));
+      AssertDatumsEqual(expected, actual);
+    }
+  }
+}
+
 }  // namespace detail
 }  // namespace compute
 }  // namespace arrow
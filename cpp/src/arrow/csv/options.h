@@ -35,6 +35,19 @@ namespace csv {
 // Silly workaround for https://github.com/michaeljones/breathe/issues/453
 constexpr char kDefaultEscapeChar = '\\';
 
+/// \brief Strategies for delimiting the rows and fields of a block
+///
+/// Both strategies give identical results.
+enum class ParserBackend : char {
+  /// Lex the data one character at a time
+  Serial,
+  /// First locate delimiters, quotes and line separators 64 bytes at a time,
+  /// then delimit fields from the resulting bitmasks.  Data with escaping
+  /// enabled, and lines which cannot be delimited that way (e.g. with stray
+  /// quotes or truncated at the end of the block), are lexed serially.
+  Indexed
+};
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -56,6 +69,9 @@ struct ARROW_EXPORT ParseOptions {
   /// a single empty value (assuming a one-column CSV file).
   bool ignore_empty_lines = true;
 
+  /// How blocks of CSV are delimited
+  ParserBackend backend = ParserBackend::Serial;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
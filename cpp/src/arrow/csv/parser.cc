@@ -19,12 +19,16 @@
 
 #include <algorithm>
 #include <cstdio>
+#include <cstring>
 #include <limits>
+#include <memory>
 #include <utility>
 
 #include "arrow/memory_pool.h"
 #include "arrow/status.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/sse_util.h"
 
 namespace arrow {
 namespace csv {
@@ -80,7 +84,9 @@ class BlockParser::PresizedParsedWriter {
  public:
   PresizedParsedWriter(MemoryPool* pool, uint32_t size)
       : parsed_size_(0), parsed_capacity_(size) {
-    ARROW_CHECK_OK(AllocateResizableBuffer(pool, parsed_capacity_, &parsed_buffer_));
+    // Padded for PushShortFieldChars()
+    ARROW_CHECK_OK(AllocateResizableBuffer(pool, parsed_capacity_ + kShortFieldSize,
+                                           &parsed_buffer_));
     parsed_ = parsed_buffer_->mutable_data();
   }
 
@@ -96,6 +102,23 @@ class BlockParser::PresizedParsedWriter {
     parsed_[parsed_size_++] = static_cast<uint8_t>(c);
   }
 
+  void PushFieldChars(const char* data, int64_t length) {
+    DCHECK_LE(parsed_size_ + length, parsed_capacity_);
+    std::memcpy(parsed_ + parsed_size_, data, static_cast<size_t>(length));
+    parsed_size_ += length;
+  }
+
+  // Like PushFieldChars(), for at most kShortFieldSize characters.  Exactly
+  // kShortFieldSize bytes are copied, so they must all be readable.
+  void PushShortFieldChars(const char* data, int64_t length) {
+    DCHECK_LE(length, kShortFieldSize);
+    DCHECK_LE(parsed_size_ + length, parsed_capacity_);
+    std::memcpy(parsed_ + parsed_size_, data, kShortFieldSize);
+    parsed_size_ += length;
+  }
+
+  static constexpr int64_t kShortFieldSize = 16;
+
   // Rollback the state that was saved in BeginLine()
   void RollbackLine() { parsed_size_ = saved_parsed_size_; }
 
@@ -110,6 +133,8 @@ class BlockParser::PresizedParsedWriter {
   int64_t saved_parsed_size_;
 };
 
+constexpr int64_t BlockParser::PresizedParsedWriter::kShortFieldSize;
+
 // A helper class handling a growable buffer for values offsets.  This class is
 // used when the number of columns is not yet known and we therefore cannot
 // efficiently presize the target area for a given number of rows.
@@ -213,6 +238,285 @@ class BlockParser::PresizedValuesWriter {
   int64_t saved_values_size_;
 };
 
+// ----------------------------------------------------------------------
+// Structural indexing
+//
+// The indexed backend first classifies the data 64 bytes at a time, producing
+// bitmasks of the delimiters, quotes and line separators.  The characters
+// inside quotes are found with a prefix-XOR of the quote bitmask (i.e. a
+// carry-less multiplication by all ones), so that the positions of the field
+// and line separators can be collected without lexing the data.  Fields are
+// then delimited from those positions by ParseLineIndexed().
+
+namespace {
+
+constexpr int64_t kIndexBlockSize = 64;
+
+// Bitmasks of some characters in a block of kIndexBlockSize bytes
+struct CharacterMasks {
+  uint64_t delimiters;
+  uint64_t quotes;
+  uint64_t newlines;
+};
+
+#if defined(ARROW_HAVE_SSE2)
+
+inline uint64_t MatchChars(__m128i chars, __m128i c) {
+  return static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(chars, c)));
+}
+
+void ClassifyBlock(const char* data, char delimiter, char quote_char,
+                   CharacterMasks* out) {
+  const __m128i delimiters = _mm_set1_epi8(delimiter);
+  const __m128i quotes = _mm_set1_epi8(quote_char);
+  const __m128i crs = _mm_set1_epi8('\r');
+  const __m128i lfs = _mm_set1_epi8('\n');
+  *out = {0, 0, 0};
+  for (int i = 0; i < 4; ++i) {
+    const __m128i chars =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i));
+    out->delimiters |= MatchChars(chars, delimiters) << (16 * i);
+    out->quotes |= MatchChars(chars, quotes) << (16 * i);
+    out->newlines |= (MatchChars(chars, crs) | MatchChars(chars, lfs)) << (16 * i);
+  }
+}
+
+#else
+
+// Set the high bit of each byte of word which equals the byte repeated in pattern
+inline uint64_t MatchBytes(uint64_t word, uint64_t pattern) {
+  constexpr uint64_t kLowBits = 0x7f7f7f7f7f7f7f7fULL;
+  const uint64_t x = word ^ pattern;
+  return ~(((x & kLowBits) + kLowBits) | x) & ~kLowBits;
+}
+
+// Gather the high bit of each byte into the 8 low bits
+inline uint64_t GatherHighBits(uint64_t bytes) {
+  return ((bytes >> 7) * 0x0102040810204080ULL) >> 56;
+}
+
+void ClassifyBlock(const char* data, char delimiter, char quote_char,
+                   CharacterMasks* out) {
+  constexpr uint64_t kOnes = 0x0101010101010101ULL;
+  const uint64_t delimiters = kOnes * static_cast<uint8_t>(delimiter);
+  const uint64_t quotes = kOnes * static_cast<uint8_t>(quote_char);
+  const uint64_t crs = kOnes * static_cast<uint8_t>('\r');
+  const uint64_t lfs = kOnes * static_cast<uint8_t>('\n');
+  *out = {0, 0, 0};
+  for (int i = 0; i < 8; ++i) {
+    uint64_t word;
+    std::memcpy(&word, data + 8 * i, sizeof(word));
+    word = BitUtil::FromLittleEndian(word);
+    out->delimiters |= GatherHighBits(MatchBytes(word, delimiters)) << (8 * i);
+    out->quotes |= GatherHighBits(MatchBytes(word, quotes)) << (8 * i);
+    out->newlines |= GatherHighBits(MatchBytes(word, crs) | MatchBytes(word, lfs))
+                     << (8 * i);
+  }
+}
+
+#endif
+
+// Set all bits from each set bit up to (excluding) the next one
+inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+// Write the positions of the set bits, returning the end of the written positions.
+// Up to 3 positions may be written past the end.
+inline uint32_t* WritePositions(uint64_t bits, uint32_t base, uint32_t* out) {
+  uint32_t* end = out + BitUtil::PopCount(bits);
+  while (bits != 0) {
+    for (int i = 0; i < 4; ++i) {
+      out[i] = base + BitUtil::CountTrailingZeros(bits);
+      bits &= bits - 1;
+    }
+    out += 4;
+  }
+  return end;
+}
+
+}  // namespace
+
+// The positions of the field and line separators outside of quotes, and of the
+// quotes, in a window of data starting at a line start.
+class BlockParser::StructuralIndex {
+ public:
+  explicit StructuralIndex(const ParseOptions& options) : options_(options) {}
+
+  // Make sure the window starting at a line start is indexed.  Returns false
+  // if the line should rather be lexed by ParseLine().
+  bool Prepare(const char* data, const char* data_end) {
+    if (ARROW_PREDICT_FALSE(dense_) && data >= begin_ && data < end_) {
+      return false;
+    }
+    if (ARROW_PREDICT_FALSE(num_fallbacks_ >= kMaxFallbacks)) {
+      return false;
+    }
+    if (data != line_start_ || data >= end_) {
+      Build(data, data_end);
+    }
+    return !dense_;
+  }
+
+  // Index a larger window, when a line doesn't fit in the current one
+  // (returns false if the window already extends to the end of the data)
+  bool Grow(const char* data, const char* data_end) {
+    if (end_ == data_end) {
+      return false;
+    }
+    if (begin_ == data) {
+      window_size_ *= 2;
+    }
+    Build(data, data_end);
+    return true;
+  }
+
+  // Forget the current position, e.g. when starting on another view
+  void Invalidate() {
+    line_start_ = nullptr;
+    dense_ = false;
+  }
+
+  // Let ParseLine() lex the rest of the window, after a line couldn't be parsed
+  // from the index.  Such lines (e.g. with stray quotes) tend to recur, so after
+  // a few fallbacks ParseLine() lexes the rest of the data as well.
+  void FallBack() {
+    line_start_ = nullptr;
+    dense_ = true;
+    ++num_fallbacks_;
+  }
+
+  // The positions not consumed yet.  Lines are parsed with a copy of the
+  // cursor, which the compiler can keep in registers.
+  struct Cursor {
+    const char* base;
+    const uint32_t* separator;
+    const uint32_t* separators_end;
+    // Followed by a sentinel
+    const uint32_t* quote;
+
+    bool NextSeparator(const char** out) {
+      if (ARROW_PREDICT_FALSE(separator == separators_end)) {
+        return false;
+      }
+      *out = base + *separator++;
+      return true;
+    }
+
+    // Skip the separator at p (the LF of a CRLF), if indexed
+    void SkipSeparator(const char* p) {
+      if (separator != separators_end && base + *separator == p) {
+        ++separator;
+      }
+    }
+
+    bool NextQuote(const char* before, const char** out) {
+      if (*quote >= static_cast<uint32_t>(before - base)) {
+        return false;
+      }
+      *out = base + *quote++;
+      return true;
+    }
+  };
+
+  const Cursor& cursor() const { return cursor_; }
+
+  void FinishLine(const Cursor& cursor, const char* line_end) {
+    cursor_ = cursor;
+    line_start_ = line_end;
+  }
+
+ protected:
+  void Build(const char* data, const char* data_end) {
+    const int64_t size = std::min<int64_t>(data_end - data, window_size_);
+    begin_ = data;
+    end_ = data + size;
+    line_start_ = data;
+
+    // Delimiting fields from their positions only pays off if they are not too
+    // short, so sample the density of special characters first
+    const int64_t sample_size = std::min(size, kDensitySampleSize);
+    int64_t num_special = 0;
+    for (int64_t offset = 0; offset + kIndexBlockSize <= sample_size;
+         offset += kIndexBlockSize) {
+      CharacterMasks masks;
+      ClassifyBlock(data + offset, options_.delimiter, options_.quote_char, &masks);
+      num_special += BitUtil::PopCount(masks.delimiters | masks.quotes | masks.newlines);
+    }
+    dense_ = num_special * kMinBytesPerSpecialChar > sample_size;
+    if (dense_) {
+      return;
+    }
+    // Room for a full last block, positions written past the end and a sentinel
+    const auto max_positions = static_cast<size_t>(size + kIndexBlockSize + 4);
+    if (positions_capacity_ < max_positions) {
+      positions_capacity_ = max_positions;
+      separators_.reset(new uint32_t[positions_capacity_]);
+      quotes_.reset(new uint32_t[positions_capacity_]);
+    }
+    uint32_t* separators_end = separators_.get();
+    uint32_t* quotes_end = quotes_.get();
+
+    // All ones while inside quotes at the end of the previous block
+    uint64_t quoted_carry = 0;
+    for (int64_t offset = 0; offset < size; offset += kIndexBlockSize) {
+      CharacterMasks masks;
+      if (ARROW_PREDICT_TRUE(size - offset >= kIndexBlockSize)) {
+        ClassifyBlock(data + offset, options_.delimiter, options_.quote_char, &masks);
+      } else {
+        char padded[kIndexBlockSize] = {};
+        const int64_t remaining = size - offset;
+        std::memcpy(padded, data + offset, static_cast<size_t>(remaining));
+        ClassifyBlock(padded, options_.delimiter, options_.quote_char, &masks);
+        const uint64_t valid = (uint64_t(1) << remaining) - 1;
+        masks.delimiters &= valid;
+        masks.quotes &= valid;
+        masks.newlines &= valid;
+      }
+      uint64_t separators = masks.delimiters | masks.newlines;
+      if (options_.quoting) {
+        const uint64_t quoted = PrefixXor(masks.quotes) ^ quoted_carry;
+        quoted_carry = static_cast<uint64_t>(static_cast<int64_t>(quoted) >> 63);
+        separators &= ~quoted;
+        quotes_end =
+            WritePositions(masks.quotes, static_cast<uint32_t>(offset), quotes_end);
+      }
+      separators_end =
+          WritePositions(separators, static_cast<uint32_t>(offset), separators_end);
+    }
+    *quotes_end = std::numeric_limits<uint32_t>::max();
+    cursor_ = {data, separators_.get(), separators_end, quotes_.get()};
+  }
+
+  static constexpr int64_t kDensitySampleSize = 8 * kIndexBlockSize;
+  static constexpr int64_t kMinBytesPerSpecialChar = 5;
+  static constexpr int32_t kMaxFallbacks = 4;
+
+  const ParseOptions& options_;
+  int64_t window_size_ = 1 << 13;
+  // Whether the window is lexed by ParseLine() instead
+  bool dense_ = false;
+  int32_t num_fallbacks_ = 0;
+  const char* begin_ = nullptr;
+  const char* end_ = nullptr;
+  // The line start where the positions below are next consumed from
+  const char* line_start_ = nullptr;
+  std::unique_ptr<uint32_t[]> separators_;
+  std::unique_ptr<uint32_t[]> quotes_;
+  size_t positions_capacity_ = 0;
+  Cursor cursor_;
+};
+
+constexpr int64_t BlockParser::StructuralIndex::kDensitySampleSize;
+constexpr int64_t BlockParser::StructuralIndex::kMinBytesPerSpecialChar;
+constexpr int32_t BlockParser::StructuralIndex::kMaxFallbacks;
+
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
 Status BlockParser::ParseLine(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
                               const char* data, const char* data_end, bool is_final,
@@ -377,16 +681,154 @@ EmptyLine:
 }
 
 template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-Status BlockParser::ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                               const char* data, const char* data_end, bool is_final,
+Status BlockParser::ParseLineIndexed(StructuralIndex* index, ValuesWriter* values_writer,
+                                     ParsedWriter* parsed_writer, const char* data,
+                                     const char* data_end, const char** out_data) {
+  DCHECK(!SpecializedOptions::escaping);
+  const char* line_start = data;
+  const char delimiter = options_.delimiter;
+  int32_t num_cols = 0;
+  const char* field_end;
+  const char* quote;
+
+  DCHECK_GT(data_end, data);
+
+  auto PushFieldChars = [&](const char* begin, const char* end) {
+    if (ARROW_PREDICT_TRUE(end - begin <= ParsedWriter::kShortFieldSize &&
+                           data_end - begin >= ParsedWriter::kShortFieldSize)) {
+      parsed_writer->PushShortFieldChars(begin, end - begin);
+    } else {
+      parsed_writer->PushFieldChars(begin, end - begin);
+    }
+  };
+
+  auto cursor = index->cursor();
+  values_writer->BeginLine();
+  parsed_writer->BeginLine();
+
+  // Special case empty lines
+  char c = *data;
+  if (ARROW_PREDICT_FALSE(c == '\r' || c == '\n')) {
+    if (!cursor.NextSeparator(&field_end)) {
+      goto Serial;
+    }
+    DCHECK_EQ(field_end, data);
+    ++data;
+    if (c == '\r' && data < data_end && *data == '\n') {
+      cursor.SkipSeparator(data);
+      ++data;
+    }
+    if (!options_.ignore_empty_lines) {
+      if (num_cols_ == -1) {
+        num_cols_ = 1;
+      }
+      while (num_cols++ < num_cols_) {
+        values_writer->StartField(false /* quoted */);
+        values_writer->FinishField(parsed_writer);
+      }
+      ++num_rows_;
+    }
+    index->FinishLine(cursor, data);
+    *out_data = data;
+    return Status::OK();
+  }
+
+  while (true) {
+    if (ARROW_PREDICT_FALSE(!cursor.NextSeparator(&field_end))) {
+      // The line continues past the indexed window
+      values_writer->RollbackLine();
+      parsed_writer->RollbackLine();
+      if (!index->Grow(line_start, data_end)) {
+        goto Serial;
+      }
+      if (!index->Prepare(line_start, data_end)) {
+        return Status::OK();
+      }
+      return ParseLineIndexed<SpecializedOptions>(index, values_writer, parsed_writer,
+                                                  line_start, data_end, out_data);
+    }
+    if (!SpecializedOptions::quoting || !cursor.NextQuote(field_end, &quote)) {
+      values_writer->StartField(false /* quoted */);
+      PushFieldChars(data, field_end);
+    } else if (ARROW_PREDICT_TRUE(quote == data)) {
+      // Quoted field: the closing quote must come right before the separator
+      // and any other quotes must be doubled
+      values_writer->StartField(true /* quoted */);
+      const char* segment = data + 1;
+      while (true) {
+        if (!cursor.NextQuote(field_end, &quote)) {
+          goto Serial;
+        }
+        if (quote + 1 == field_end) {
+          PushFieldChars(segment, quote);
+          break;
+        }
+        const char* doubled_quote;
+        if (!options_.double_quote || !cursor.NextQuote(field_end, &doubled_quote) ||
+            doubled_quote != quote + 1) {
+          goto Serial;
+        }
+        PushFieldChars(segment, doubled_quote);
+        segment = doubled_quote + 1;
+      }
+    } else {
+      // Quote inside a non-quoted field
+      goto Serial;
+    }
+    values_writer->FinishField(parsed_writer);
+    ++num_cols;
+
+    c = *field_end;
+    data = field_end + 1;
+    if (c == delimiter) {
+      continue;
+    }
+    // At the end of line
+    if (c == '\r' && data < data_end && *data == '\n') {
+      cursor.SkipSeparator(data);
+      ++data;
+    }
+    break;
+  }
+
+  if (ARROW_PREDICT_FALSE(num_cols != num_cols_)) {
+    if (num_cols_ == -1) {
+      num_cols_ = num_cols;
+    } else {
+      return MismatchingColumns(num_cols_, num_cols);
+    }
+  }
+  ++num_rows_;
+  index->FinishLine(cursor, data);
+  *out_data = data;
+  return Status::OK();
+
+Serial:
+  // Let ParseLine() lex this line
+  values_writer->RollbackLine();
+  parsed_writer->RollbackLine();
+  index->FallBack();
+  return Status::OK();
+}
+
+template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
+Status BlockParser::ParseChunk(StructuralIndex* index, ValuesWriter* values_writer,
+                               ParsedWriter* parsed_writer, const char* data,
+                               const char* data_end, bool is_final,
                                int32_t rows_in_chunk, const char** out_data,
                                bool* finished_parsing) {
   int32_t num_rows_deadline = num_rows_ + rows_in_chunk;
 
   while (data < data_end && num_rows_ < num_rows_deadline) {
     const char* line_end = data;
-    RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
-                                                data_end, is_final, &line_end));
+    if (index != nullptr && index->Prepare(data, data_end)) {
+      RETURN_NOT_OK(ParseLineIndexed<SpecializedOptions>(
+          index, values_writer, parsed_writer, data, data_end, &line_end));
+    }
+    if (line_end == data) {
+      RETURN_NOT_OK(ParseLine<SpecializedOptions>(values_writer, parsed_writer, data,
+                                                  data_end, is_final, &line_end));
+    }
     if (line_end == data) {
       // Cannot parse any further
       *finished_parsing = true;
@@ -426,10 +868,18 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
   PresizedParsedWriter parsed_writer(pool_, static_cast<uint32_t>(total_view_length));
   uint32_t total_parsed_length = 0;
 
+  // Escapes can't be located without lexing, so escaped data is always lexed
+  StructuralIndex structural_index(options_);
+  StructuralIndex* index = nullptr;
+  if (options_.backend == ParserBackend::Indexed && !SpecializedOptions::escaping) {
+    index = &structural_index;
+  }
+
   for (const auto& view : views) {
     const char* data = view.data();
     const char* data_end = view.data() + view.length();
     bool finished_parsing = false;
+    structural_index.Invalidate();
 
     if (num_cols_ == -1) {
       // Can't presize values when the number of columns is not known, first parse
@@ -438,9 +888,9 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       ResizableValuesWriter values_writer(pool_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+          index, &values_writer, &parsed_writer, data, data_end, is_final,
+          rows_in_chunk, &data, &finished_parsing));
       if (num_cols_ == -1) {
         return ParseError("Empty CSV file or block: cannot infer number of columns");
       }
@@ -463,9 +913,9 @@ Status BlockParser::DoParseSpecialized(const std::vector<util::string_view>& vie
       PresizedValuesWriter values_writer(pool_, rows_in_chunk, num_cols_);
       values_writer.Start(parsed_writer);
 
-      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(&values_writer, &parsed_writer, data,
-                                                   data_end, is_final, rows_in_chunk,
-                                                   &data, &finished_parsing));
+      RETURN_NOT_OK(ParseChunk<SpecializedOptions>(
+          index, &values_writer, &parsed_writer, data, data_end, is_final,
+          rows_in_chunk, &data, &finished_parsing));
     }
     DCHECK_GE(data, view.data());
     DCHECK_LE(data, data_end);
@@ -137,10 +137,13 @@ class ARROW_EXPORT BlockParser {
   Status DoParseSpecialized(const std::vector<util::string_view>& data, bool is_final,
                             uint32_t* out_size);
 
+  class StructuralIndex;
+
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
-  Status ParseChunk(ValuesWriter* values_writer, ParsedWriter* parsed_writer,
-                    const char* data, const char* data_end, bool is_final,
-                    int32_t rows_in_chunk, const char** out_data, bool* finished_parsing);
+  Status ParseChunk(StructuralIndex* index, ValuesWriter* values_writer,
+                    ParsedWriter* parsed_writer, const char* data, const char* data_end,
+                    bool is_final, int32_t rows_in_chunk, const char** out_data,
+                    bool* finished_parsing);
 
   // Parse a single line from the data pointer
   template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
@@ -148,6 +151,14 @@ class ARROW_EXPORT BlockParser {
                    const char* data, const char* data_end, bool is_final,
                    const char** out_data);
 
+  // Parse a single line from the data pointer using the structural index, which
+  // must have been prepared.  out_data is left untouched if the line must be
+  // lexed by ParseLine().
+  template <typename SpecializedOptions, typename ValuesWriter, typename ParsedWriter>
+  Status ParseLineIndexed(StructuralIndex* index, ValuesWriter* values_writer,
+                          ParsedWriter* parsed_writer, const char* data,
+                          const char* data_end, const char** out_data);
+
   MemoryPool* pool_;
   const ParseOptions options_;
   // The number of rows parsed from the block
@@ -34,6 +34,10 @@ namespace csv {
 // >> For a static/global string constant, use a C style string instead
 const char* one_row = "abc,\"d,f\",12.34,\n";
 const char* one_row_escaped = "abc,d\\,f,12.34,\n";
+const char* one_row_unquoted =
+    "abcdefghij,klmnopqrstuvwxyz,12345.6789,2020-01-01 00:00:00\n";
+// Quotes inside unquoted fields can't be parsed from the structural index
+const char* one_row_stray_quotes = "abcdefghij,5'10\",12345.6789,2020-01-01 00:00:00\n";
 
 const auto num_rows = static_cast<int32_t>((1024 * 64) / strlen(one_row));
 
@@ -130,6 +134,59 @@ static void ParseCSVQuotedBlock(benchmark::State& state) {  // NOLINT non-const
   BenchmarkCSVParsing(state, csv, num_rows, options);
 }
 
+static void ParseCSVQuotedBlockIndexed(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row, num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+  options.backend = ParserBackend::Indexed;
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
+static void ParseCSVUnquotedBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_unquoted, num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
+static void ParseCSVUnquotedBlockIndexed(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_unquoted, num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+  options.backend = ParserBackend::Indexed;
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
+static void ParseCSVStrayQuotesBlock(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_stray_quotes, num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
+static void ParseCSVStrayQuotesBlockIndexed(
+    benchmark::State& state) {  // NOLINT non-const reference
+  auto csv = BuildCSVData(one_row_stray_quotes, num_rows);
+  auto options = ParseOptions::Defaults();
+  options.quoting = true;
+  options.escaping = false;
+  options.backend = ParserBackend::Indexed;
+
+  BenchmarkCSVParsing(state, csv, num_rows, options);
+}
+
 static void ParseCSVEscapedBlock(benchmark::State& state) {  // NOLINT non-const reference
   auto csv = BuildCSVData(one_row_escaped, num_rows);
   auto options = ParseOptions::Defaults();
@@ -143,6 +200,11 @@ BENCHMARK(ChunkCSVQuotedBlock);
 BENCHMARK(ChunkCSVEscapedBlock);
 BENCHMARK(ChunkCSVNoNewlinesBlock);
 BENCHMARK(ParseCSVQuotedBlock);
+BENCHMARK(ParseCSVQuotedBlockIndexed);
+BENCHMARK(ParseCSVUnquotedBlock);
+BENCHMARK(ParseCSVUnquotedBlockIndexed);
+BENCHMARK(ParseCSVStrayQuotesBlock);
+BENCHMARK(ParseCSVStrayQuotesBlockIndexed);
 BENCHMARK(ParseCSVEscapedBlock);
 
 }  // namespace csv
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <cstdint>
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -623,5 +624,116 @@ TEST(BlockParser, QuotedEscape) {
   }
 }
 
+// Check that both parser backends give the same results on the given data
+void AssertBackendsAgree(const ParseOptions& options, const std::string& csv,
+                         bool is_final) {
+  auto serial_options = options, indexed_options = options;
+  serial_options.backend = ParserBackend::Serial;
+  indexed_options.backend = ParserBackend::Indexed;
+  BlockParser serial(serial_options);
+  BlockParser indexed(indexed_options);
+  uint32_t serial_size = 0, indexed_size = 0;
+  Status serial_st, indexed_st;
+  if (is_final) {
+    serial_st = ParseFinal(serial, csv, &serial_size);
+    indexed_st = ParseFinal(indexed, csv, &indexed_size);
+  } else {
+    serial_st = Parse(serial, csv, &serial_size);
+    indexed_st = Parse(indexed, csv, &indexed_size);
+  }
+  ASSERT_EQ(serial_st.ToString(), indexed_st.ToString()) << "for CSV: " << csv;
+  if (!serial_st.ok()) {
+    return;
+  }
+  ASSERT_EQ(serial_size, indexed_size) << "for CSV: " << csv;
+  ASSERT_EQ(serial.num_rows(), indexed.num_rows()) << "for CSV: " << csv;
+  ASSERT_EQ(serial.num_cols(), indexed.num_cols()) << "for CSV: " << csv;
+  ASSERT_EQ(serial.num_bytes(), indexed.num_bytes()) << "for CSV: " << csv;
+  for (int32_t col_index = 0; col_index < serial.num_cols(); ++col_index) {
+    std::vector<std::string> serial_values, indexed_values;
+    std::vector<bool> serial_quoted, indexed_quoted;
+    GetColumn(serial, col_index, &serial_values, &serial_quoted);
+    GetColumn(indexed, col_index, &indexed_values, &indexed_quoted);
+    ASSERT_EQ(serial_values, indexed_values) << "for CSV: " << csv;
+    ASSERT_EQ(serial_quoted, indexed_quoted) << "for CSV: " << csv;
+  }
+}
+
+void AssertBackendsAgree(const ParseOptions& options, const std::string& csv) {
+  AssertBackendsAgree(options, csv, false /* is_final */);
+  AssertBackendsAgree(options, csv, true /* is_final */);
+}
+
+TEST(BlockParser, BackendsAgree) {
+  for (bool quoting : {true, false}) {
+    for (bool double_quote : {true, false}) {
+      for (bool ignore_empty_lines : {true, false}) {
+        auto options = ParseOptions::Defaults();
+        options.quoting = quoting;
+        options.double_quote = double_quote;
+        options.ignore_empty_lines = ignore_empty_lines;
+        for (const std::string csv :
+             {"a,b\n", "a,b", "a,b\r\nc,d\r\n", "a,b\rc,d\r", "\n\na,b\n\r\n",
+              "a\"b,c\n", "\"a\"b,c\n", "\"a\"\"b\",\"\"\n", "\"a\nb\",\"c,d\"\r\n",
+              "\"a\"\"", "\"a,b\nc\n", "a,\n", "a,b\n\"", "a,b\nc\n", "\"\"\"\"\n"}) {
+          ASSERT_NO_FATAL_FAILURE(AssertBackendsAgree(options, csv));
+        }
+      }
+    }
+  }
+}
+
+TEST(BlockParser, BackendsAgreeRandom) {
+  // Random data dense in quotes, delimiters and newlines (more or less, as the
+  // indexed backend lexes very dense data serially)
+  const std::string specials = ",\"\r\n\n";
+  std::default_random_engine gen(42);
+  std::uniform_int_distribution<size_t> special_dist(0, specials.size() - 1);
+  std::uniform_int_distribution<size_t> length_dist(1, 1000);
+  std::uniform_real_distribution<double> real_dist;
+  for (double special_probability : {0.1, 0.2, 0.5}) {
+    for (bool double_quote : {true, false}) {
+      auto options = ParseOptions::Defaults();
+      options.double_quote = double_quote;
+      for (int i = 0; i < 500; ++i) {
+        std::string csv(length_dist(gen), 'a');
+        for (auto& c : csv) {
+          if (real_dist(gen) < special_probability) {
+            c = specials[special_dist(gen)];
+          }
+        }
+        ASSERT_NO_FATAL_FAILURE(AssertBackendsAgree(options, csv));
+      }
+    }
+  }
+}
+
+TEST(BlockParser, BackendsAgreeStrayQuotes) {
+  // Lines which can't be parsed from the index, both sparse and recurring
+  auto options = ParseOptions::Defaults();
+  for (int stray_every : {1, 7, 300}) {
+    std::string csv;
+    for (int i = 0; i < 2000; ++i) {
+      csv += (i % stray_every == 0) ? "abc,5'10\",\"d,e\"\n" : "abc,def,\"g,h\"\n";
+    }
+    ASSERT_NO_FATAL_FAILURE(AssertBackendsAgree(options, csv));
+  }
+}
+
+TEST(BlockParser, BackendsAgreeLongLines) {
+  // Lines larger than the indexing window
+  auto options = ParseOptions::Defaults();
+  std::string quoted(200000, 'x');
+  for (size_t i = 0; i < quoted.size(); i += 1000) {
+    quoted[i] = ',';
+    quoted[i + 1] = '\n';
+    quoted[i + 2] = '"';
+    quoted[i + 3] = '"';
+  }
+  const std::string csv = "a,\"" + quoted + "\"\n" + "b,c\n";
+  ASSERT_NO_FATAL_FAILURE(AssertBackendsAgree(options, csv));
+  ASSERT_NO_FATAL_FAILURE(AssertBackendsAgree(options, MakeLotsOfCsvColumns(100000)));
+}
+
 }  // namespace csv
 }  // namespace arrow
@@ -17,6 +17,7 @@
 
 #include "arrow/csv/reader.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <limits>
@@ -485,6 +486,204 @@ class ThreadedTableReader : public BaseTableReader {
   ThreadPool* thread_pool_;
 };
 
+/////////////////////////////////////////////////////////////////////////
+// TableReader implementation parsing byte ranges of a file in parallel
+
+class RangedTableReader : public BaseTableReader {
+ public:
+  RangedTableReader(MemoryPool* pool, std::shared_ptr<io::RandomAccessFile> file,
+                    const ReadOptions& read_options, const ParseOptions& parse_options,
+                    const ConvertOptions& convert_options, ThreadPool* thread_pool)
+      : BaseTableReader(pool, file, read_options, parse_options, convert_options),
+        file_(std::move(file)),
+        thread_pool_(thread_pool) {}
+
+  ~RangedTableReader() override {
+    if (task_group_) {
+      // In case of error, make sure all pending tasks are finished before
+      // we start destroying BaseTableReader members
+      ARROW_UNUSED(task_group_->Finish());
+    }
+  }
+
+  Status Init() override { return Status::OK(); }
+
+  Result<std::shared_ptr<Table>> Read() override {
+    task_group_ = MakeTaskGroup();
+    ARROW_ASSIGN_OR_RAISE(file_size_, file_->GetSize());
+
+    // Read first block and process header serially
+    ARROW_ASSIGN_OR_RAISE(
+        auto block,
+        file_->ReadAt(0, std::min<int64_t>(file_size_, read_options_.block_size)));
+    ARROW_ASSIGN_OR_RAISE(auto data, util::SkipUTF8BOM(block->data(), block->size()));
+    if (data == block->data() + block->size()) {
+      return Status::Invalid("Empty CSV file");
+    }
+    std::shared_ptr<Buffer> rest;
+    RETURN_NOT_OK(ProcessHeader(SliceBuffer(block, data - block->data()), &rest));
+    int64_t data_start = rest->data() - block->data();
+    if (data_start > 0 && data_start < file_size_ &&
+        block->data()[data_start - 1] == '\r') {
+      // Skip '\r\n' line separator that straddles the end of the first block
+      ARROW_ASSIGN_OR_RAISE(auto next, file_->ReadAt(data_start, 1));
+      if (next->size() == 1 && next->data()[0] == '\n') {
+        ++data_start;
+      }
+    }
+
+    // Split the data into ranges of block_size bytes, and find the first row
+    // start in each range: chunks of rows are delimited by these boundaries
+    const int64_t range_size = read_options_.block_size;
+    const int64_t num_ranges =
+        std::max<int64_t>(1, (file_size_ - data_start + range_size - 1) / range_size);
+    std::vector<int64_t> row_starts(num_ranges, -1);
+    row_starts[0] = data_start;
+    auto probe_group = MakeTaskGroup();
+    for (int64_t i = 1; i < num_ranges; ++i) {
+      probe_group->Append([this, i, data_start, range_size, &row_starts] {
+        const int64_t range_start = data_start + i * range_size;
+        const int64_t range_end = std::min(range_start + range_size, file_size_);
+        return FindRowStart(range_start, range_end).Value(&row_starts[i]);
+      });
+    }
+    RETURN_NOT_OK(probe_group->Finish());
+
+    std::vector<int64_t> boundaries;
+    for (const auto row_start : row_starts) {
+      if (row_start >= 0) {
+        boundaries.push_back(row_start);
+      }
+    }
+    boundaries.push_back(file_size_);
+
+    // Parse windows of chunks in parallel, then check serially that each chunk
+    // starts where the previous one actually ended
+    const size_t num_chunks = boundaries.size() - 1;
+    const size_t window_size =
+        read_options_.use_threads ? std::max(thread_pool_->GetCapacity(), 1) : 1;
+    int64_t row_start = data_start;
+    int64_t block_index = 0;
+
+    for (size_t first = 0; first < num_chunks; first += window_size) {
+      std::vector<Chunk> chunks(std::min(window_size, num_chunks - first));
+      auto parse_group = MakeTaskGroup();
+      for (size_t i = 0; i < chunks.size(); ++i) {
+        Chunk* chunk = &chunks[i];
+        chunk->start = boundaries[first + i];
+        chunk->end = boundaries[first + i + 1];
+        chunk->is_final = (first + i + 1 == num_chunks);
+        parse_group->Append([this, chunk] {
+          // Errors are only relevant if the chunk starts at an actual row start
+          chunk->status = ParseChunk(chunk);
+          return Status::OK();
+        });
+      }
+      RETURN_NOT_OK(parse_group->Finish());
+
+      for (auto& chunk : chunks) {
+        DCHECK_LE(row_start, chunk.start);
+        if (chunk.start != row_start) {
+          // The previous chunk ended inside a row (a quoted value spanning
+          // several lines): the boundary was misplaced, parse again from the
+          // actual start of the row
+          chunk.start = row_start;
+          chunk.status = ParseChunk(&chunk);
+        }
+        RETURN_NOT_OK(chunk.status);
+        row_start = chunk.start + chunk.parsed_size;
+        RETURN_NOT_OK(ProcessData(chunk.parser, block_index++));
+      }
+    }
+
+    // Finish conversion, create schema and table
+    RETURN_NOT_OK(task_group_->Finish());
+    return MakeTable();
+  }
+
+ protected:
+  // A range of the file holding whole rows, unless its start was misplaced
+  struct Chunk {
+    int64_t start;
+    int64_t end;
+    bool is_final;
+    std::shared_ptr<BlockParser> parser;
+    uint32_t parsed_size = 0;
+    Status status;
+  };
+
+  std::shared_ptr<internal::TaskGroup> MakeTaskGroup() {
+    if (read_options_.use_threads) {
+      return internal::TaskGroup::MakeThreaded(thread_pool_);
+    } else {
+      return internal::TaskGroup::MakeSerial();
+    }
+  }
+
+  // Return the offset following the first line separator found in [start - 1, end),
+  // or -1 if no row starts in [start, end).
+  //
+  // If values can contain newlines, the separator may actually be inside a
+  // quoted value; this is detected when parsing the previous chunk.
+  Result<int64_t> FindRowStart(int64_t start, int64_t end) {
+    DCHECK_GT(start, 0);
+    // Look one byte past the end, to see whether a '\r' is followed by '\n'
+    const int64_t probe_limit = std::min(end + 1, file_size_);
+    int64_t probe_start = start - 1;
+    int64_t probe_size = 4096;
+
+    while (probe_start < probe_limit) {
+      const int64_t probe_end = std::min(probe_start + probe_size, probe_limit);
+      ARROW_ASSIGN_OR_RAISE(auto probe,
+                            file_->ReadAt(probe_start, probe_end - probe_start));
+      const auto data = reinterpret_cast<const char*>(probe->data());
+      const auto size = probe->size();
+      int64_t i = 0;
+      while (i < size && data[i] != '\n' && data[i] != '\r') {
+        ++i;
+      }
+      if (i < size) {
+        if (data[i] == '\r' && i + 1 == size && probe_end < probe_limit) {
+          // Read on to see whether '\r' is followed by '\n'
+          probe_start += i;
+          continue;
+        }
+        int64_t row_start = probe_start + i + 1;
+        if (data[i] == '\r' && i + 1 < size && data[i + 1] == '\n') {
+          ++row_start;
+        }
+        return row_start < end ? row_start : -1;
+      }
+      if (size < probe_end - probe_start) {
+        return Status::IOError("Unexpected end of CSV file");
+      }
+      probe_start = probe_end;
+      probe_size *= 2;
+    }
+    return -1;
+  }
+
+  Status ParseChunk(Chunk* chunk) {
+    static constexpr int32_t max_num_rows = std::numeric_limits<int32_t>::max();
+    ARROW_ASSIGN_OR_RAISE(auto data,
+                          file_->ReadAt(chunk->start, chunk->end - chunk->start));
+    if (data->size() != chunk->end - chunk->start) {
+      return Status::IOError("Unexpected end of CSV file");
+    }
+    chunk->parser =
+        std::make_shared<BlockParser>(pool_, parse_options_, num_csv_cols_, max_num_rows);
+    if (chunk->is_final) {
+      return chunk->parser->ParseFinal(util::string_view(*data), &chunk->parsed_size);
+    } else {
+      return chunk->parser->Parse(util::string_view(*data), &chunk->parsed_size);
+    }
+  }
+
+  std::shared_ptr<io::RandomAccessFile> file_;
+  ThreadPool* thread_pool_;
+  int64_t file_size_ = -1;
+};
+
 /////////////////////////////////////////////////////////////////////////
 // TableReader factory function
 
@@ -504,6 +703,16 @@ Result<std::shared_ptr<TableReader>> TableReader::Make(
   return reader;
 }
 
+Result<std::shared_ptr<TableReader>> TableReader::MakeFromFile(
+    MemoryPool* pool, std::shared_ptr<io::RandomAccessFile> input,
+    const ReadOptions& read_options, const ParseOptions& parse_options,
+    const ConvertOptions& convert_options) {
+  auto reader = std::make_shared<RangedTableReader>(
+      pool, input, read_options, parse_options, convert_options, GetCpuThreadPool());
+  RETURN_NOT_OK(reader->Init());
+  return reader;
+}
+
 /////////////////////////////////////////////////////////////////////////
 // Deprecated API(s)
 
@@ -27,6 +27,7 @@
 namespace arrow {
 namespace io {
 class InputStream;
+class RandomAccessFile;
 }  // namespace io
 
 namespace csv {
@@ -49,6 +50,18 @@ class ARROW_EXPORT TableReader {
                                                    const ParseOptions&,
                                                    const ConvertOptions&);
 
+  /// Create a TableReader instance reading a file by byte ranges
+  ///
+  /// Rather than being read and chunked serially, the file is split into ranges
+  /// of ReadOptions::block_size bytes which are read and parsed independently
+  /// (in parallel if ReadOptions::use_threads is true), each starting at the
+  /// first line separator in the range.  If ParseOptions::newlines_in_values is
+  /// true, that separator may be inside a quoted value; a chunk is then parsed
+  /// again from the end of the last row of the previous chunk.
+  static Result<std::shared_ptr<TableReader>> MakeFromFile(
+      MemoryPool* pool, std::shared_ptr<io::RandomAccessFile> input, const ReadOptions&,
+      const ParseOptions&, const ConvertOptions&);
+
   ARROW_DEPRECATED("Use Result-returning overload")
   static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                      const ReadOptions&, const ParseOptions&, const ConvertOptions&,
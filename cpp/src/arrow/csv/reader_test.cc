@@ -0,0 +1,177 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/options.h"
+#include "arrow/csv/reader.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/testing/gtest_util.h"
+
+namespace arrow {
+namespace csv {
+
+class FileReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUp() override { read_options_.use_threads = GetParam(); }
+
+  Status ReadStream(const std::string& csv, std::shared_ptr<Table>* out) {
+    auto options = read_options_;
+    options.use_threads = false;
+    options.block_size = 1 << 20;
+    auto input = std::make_shared<io::BufferReader>(std::make_shared<Buffer>(csv));
+    ARROW_ASSIGN_OR_RAISE(auto reader,
+                          TableReader::Make(default_memory_pool(), input, options,
+                                            parse_options_, convert_options_));
+    return reader->Read().Value(out);
+  }
+
+  Status ReadFile(const std::string& csv, std::shared_ptr<Table>* out) {
+    auto input = std::make_shared<io::BufferReader>(std::make_shared<Buffer>(csv));
+    ARROW_ASSIGN_OR_RAISE(auto reader, TableReader::MakeFromFile(
+                                           default_memory_pool(), input, read_options_,
+                                           parse_options_, convert_options_));
+    return reader->Read().Value(out);
+  }
+
+  // Check that reading by byte ranges gives the same results as reading
+  // the whole file as a stream, whatever the block size (the first block must
+  // hold the header, though)
+  void AssertReadsSame(const std::string& csv, int32_t min_block_size = 8) {
+    std::shared_ptr<Table> expected, actual;
+    ASSERT_OK(ReadStream(csv, &expected));
+    for (int32_t block_size : {min_block_size, min_block_size + 1, min_block_size + 2,
+                               min_block_size + 5, 64, 1 << 20}) {
+      SCOPED_TRACE("block_size = " + std::to_string(block_size));
+      read_options_.block_size = block_size;
+      ASSERT_OK(ReadFile(csv, &actual));
+      ASSERT_OK(actual->ValidateFull());
+      AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+    }
+  }
+
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ConvertOptions convert_options_ = ConvertOptions::Defaults();
+};
+
+INSTANTIATE_TEST_CASE_P(FileReaderTest, FileReaderTest, ::testing::Values(false, true));
+
+TEST_P(FileReaderTest, Basics) {
+  AssertReadsSame("a,b,c\n1,2,3\n4,5,6\n");
+  AssertReadsSame("a,b,c\n1,,x\n\n4,5,yy\n7,8,zzz");
+  AssertReadsSame("a,b\r\n1,2\r\n3,4\r\n\r\n5,6\r7,8\r\n");
+  AssertReadsSame("\xef\xbb\xbf" "a,b\n1,2\n3,4\n");
+  AssertReadsSame("a,b\n");
+
+  parse_options_.ignore_empty_lines = false;
+  AssertReadsSame("a\r\n1\r\n\r\n2\r\n\n3\r\r\n");
+}
+
+TEST_P(FileReaderTest, HeaderOptions) {
+  read_options_.skip_rows = 2;
+  AssertReadsSame("garbage\nmore,garbage\na,b\n1,2\n3,4\n", 25);
+  read_options_.skip_rows = 0;
+  read_options_.autogenerate_column_names = true;
+  AssertReadsSame("1,2\n3,4\n");
+  read_options_.autogenerate_column_names = false;
+  read_options_.column_names = {"x", "y"};
+  AssertReadsSame("1,2\n3,4\n");
+}
+
+TEST_P(FileReaderTest, Empty) {
+  std::shared_ptr<Table> table;
+  ASSERT_RAISES(Invalid, ReadFile("", &table));
+  ASSERT_RAISES(Invalid, ReadFile("\xef\xbb\xbf", &table));
+}
+
+TEST_P(FileReaderTest, Errors) {
+  std::shared_ptr<Table> table;
+  // Block sizes which hold the header but split the data
+  for (int32_t block_size : {5, 6, 8, 1 << 20}) {
+    SCOPED_TRACE("block_size = " + std::to_string(block_size));
+    read_options_.block_size = block_size;
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid,
+                                    ::testing::HasSubstr("Expected 2 columns, got 1"),
+                                    ReadFile("a,b\n1,2\n3\n4,5\n", &table));
+  }
+}
+
+TEST_P(FileReaderTest, IndexedBackend) {
+  // The stray quote is lexed serially by the indexed backend
+  const std::string csv = "a,b,c\n1,\"x,y\",3\n4,5'6\",6\n7,8,9\n";
+  std::shared_ptr<Table> serial, indexed;
+  ASSERT_OK(ReadFile(csv, &serial));
+  parse_options_.backend = ParserBackend::Indexed;
+  ASSERT_OK(ReadFile(csv, &indexed));
+  AssertTablesEqual(*serial, *indexed);
+  AssertReadsSame(csv);
+}
+
+TEST_P(FileReaderTest, NewlinesInValues) {
+  // Line separators inside quoted values are mistaken for row starts,
+  // and the following chunks must be parsed again
+  parse_options_.newlines_in_values = true;
+  AssertReadsSame("a,b\n\"x\ny\",1\n\"\n\n\n\",2\n\"a,\n\"\"b\r\nc\",3\n");
+  AssertReadsSame("a,b\n\"x\ny\n1,2\nz\",3\n4,\"\n5,6\n\"\n");
+
+  parse_options_.escaping = true;
+  AssertReadsSame("a,b\n\"x\\\"\ny\",1\nx\\\ny,2\n");
+}
+
+TEST_P(FileReaderTest, Random) {
+  std::default_random_engine engine(42);
+  const std::string pieces[] = {"x", "12", ",", "\"", "\n", "\r\n", "\"\"", " "};
+  std::uniform_int_distribution<int> num_rows_dist(1, 50);
+  std::uniform_int_distribution<int> value_dist(0, 1000);
+  std::bernoulli_distribution quoted_dist(0.3);
+  std::uniform_int_distribution<size_t> piece_dist(0, 7);
+
+  parse_options_.newlines_in_values = true;
+  for (int i = 0; i < 20; ++i) {
+    std::string csv = "a,b,c\n";
+    const int num_rows = num_rows_dist(engine);
+    for (int row = 0; row < num_rows; ++row) {
+      csv += std::to_string(value_dist(engine)) + ",";
+      if (quoted_dist(engine)) {
+        // A quoted value, possibly spanning several lines
+        csv += "\"";
+        for (int j = 0; j < 8; ++j) {
+          const auto& piece = pieces[piece_dist(engine)];
+          csv += piece == "\"" ? "\"\"" : piece;
+        }
+        csv += "\"";
+      } else {
+        csv += "x";
+      }
+      csv += "," + std::to_string(value_dist(engine)) + (row % 2 ? "\n" : "\r\n");
+    }
+    AssertReadsSame(csv);
+  }
+}
+
+}  // namespace csv
+}  // namespace arrow
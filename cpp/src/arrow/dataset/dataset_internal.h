@@ -17,12 +17,15 @@
 
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/record_batch.h"
 #include "arrow/scalar.h"
@@ -61,5 +64,17 @@ inline std::shared_ptr<Schema> SchemaFromColumnNames(
   return std::make_shared<Schema>(columns);
 }
 
+/// \brief Return the names of the columns a scan must read from its files: those
+/// of the projected schema followed by those only referenced by the filter.
+inline std::vector<std::string> MaterializedColumnNames(const ScanOptions& options) {
+  std::vector<std::string> names = options.schema()->field_names();
+  for (auto&& name : FieldsInExpression(options.filter)) {
+    if (std::find(names.begin(), names.end(), name) == names.end()) {
+      names.push_back(std::move(name));
+    }
+  }
+  return names;
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -141,6 +141,27 @@ TEST(TestProjector, MismatchedType) {
   ASSERT_RAISES(TypeError, result.status());
 }
 
+TEST(TestProjector, WidenIntegers) {
+  auto from_schema = schema({field("i", int8(), false), field("u", uint16())});
+  auto batch = RecordBatchFromJSON(from_schema, R"([[1, 2], [-3, null], [5, 65535]])");
+
+  auto to_schema = schema({field("i", int64()), field("u", int32())});
+  RecordBatchProjector projector(to_schema);
+
+  auto expected_batch =
+      RecordBatchFromJSON(to_schema, R"([[1, 2], [-3, null], [5, 65535]])");
+  ASSERT_OK_AND_ASSIGN(auto reconciled_batch, projector.Project(*batch));
+  AssertBatchesEqual(*expected_batch, *reconciled_batch);
+
+  // Narrowing is not supported
+  RecordBatchProjector narrowing(schema({field("u", int16())}));
+  ASSERT_RAISES(TypeError, narrowing.Project(*batch));
+
+  // Nor is projecting a nullable field to a non-nullable one
+  RecordBatchProjector non_nullable(schema({field("u", uint16(), false)}));
+  ASSERT_RAISES(TypeError, non_nullable.Project(*batch));
+}
+
 TEST(TestProjector, AugmentWithNull) {
   constexpr int64_t kBatchSize = 1024;
 
@@ -30,6 +30,7 @@
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/filesystem/path_util.h"
 #include "arrow/status.h"
+#include "arrow/util/parallel.h"
 
 namespace arrow {
 namespace dataset {
@@ -41,11 +42,12 @@ DataSourceDiscovery::DataSourceDiscovery()
 
 FileSystemDataSourceDiscovery::FileSystemDataSourceDiscovery(
     fs::FileSystemPtr filesystem, fs::FileStatsVector files, FileFormatPtr format,
-    FileSystemDiscoveryOptions options)
+    FileSystemDiscoveryOptions options, util::optional<fs::FileStats> summary_file)
     : fs_(std::move(filesystem)),
       files_(std::move(files)),
       format_(std::move(format)),
-      options_(std::move(options)) {}
+      options_(std::move(options)),
+      summary_file_(std::move(summary_file)) {}
 
 bool StartsWithAnyOf(const std::vector<std::string>& prefixes, const std::string& path) {
   auto dir_base = fs::internal::GetAbstractPathParent(path);
@@ -63,30 +65,64 @@ Result<DataSourceDiscoveryPtr> FileSystemDataSourceDiscovery::Make(
     FileSystemDiscoveryOptions options) {
   DCHECK_NE(format, nullptr);
 
+  util::optional<fs::FileStats> summary_file;
+  const std::string summary_file_name =
+      options.use_summary_file ? format->summary_file_name() : "";
+
   bool has_prefixes = !options.ignore_prefixes.empty();
-  std::vector<fs::FileStats> filtered;
+  std::vector<fs::FileStats> candidates;
   for (const auto& stat : files) {
     if (stat.IsFile()) {
       const std::string& path = stat.path();
 
-      if (has_prefixes && StartsWithAnyOf(options.ignore_prefixes, path)) {
+      if (!summary_file_name.empty() &&
+          fs::internal::GetAbstractPathParent(path).second == summary_file_name) {
+        // Summaries are never data files. The outermost one describes the
+        // whole dataset.
+        if (!summary_file.has_value() ||
+            fs::internal::SplitAbstractPath(path).size() <
+                fs::internal::SplitAbstractPath(summary_file->path()).size()) {
+          summary_file = stat;
+        }
         continue;
       }
 
-      if (options.exclude_invalid_files) {
-        ARROW_ASSIGN_OR_RAISE(auto supported,
-                              format->IsSupported(FileSource(path, fs.get())));
-        if (!supported) {
-          continue;
-        }
+      if (has_prefixes && StartsWithAnyOf(options.ignore_prefixes, path)) {
+        continue;
       }
     }
 
-    filtered.push_back(stat);
+    candidates.push_back(stat);
+  }
+
+  if (!options.exclude_invalid_files || summary_file.has_value()) {
+    return DataSourceDiscoveryPtr(new FileSystemDataSourceDiscovery(
+        fs, std::move(candidates), std::move(format), std::move(options),
+        std::move(summary_file)));
+  }
+
+  // Opening each file dominates for large datasets, so check them in parallel
+  std::vector<char> supported(candidates.size(), true);
+  RETURN_NOT_OK(internal::ParallelFor(
+      static_cast<int>(candidates.size()), [&](int i) -> Status {
+        if (!candidates[i].IsFile()) {
+          return Status::OK();
+        }
+        FileSource source(candidates[i].path(), fs.get());
+        ARROW_ASSIGN_OR_RAISE(supported[i], format->IsSupported(source));
+        return Status::OK();
+      }));
+
+  std::vector<fs::FileStats> filtered;
+  for (size_t i = 0; i < candidates.size(); ++i) {
+    if (supported[i]) {
+      filtered.push_back(std::move(candidates[i]));
+    }
   }
 
-  return DataSourceDiscoveryPtr(new FileSystemDataSourceDiscovery(
-      fs, std::move(filtered), std::move(format), std::move(options)));
+  return DataSourceDiscoveryPtr(
+      new FileSystemDataSourceDiscovery(fs, std::move(filtered), std::move(format),
+                                        std::move(options), std::move(summary_file)));
 }
 
 Result<DataSourceDiscoveryPtr> FileSystemDataSourceDiscovery::Make(
@@ -108,11 +144,37 @@ Result<DataSourceDiscoveryPtr> FileSystemDataSourceDiscovery::Make(
 Result<std::shared_ptr<Schema>> FileSystemDataSourceDiscovery::Inspect() {
   std::vector<std::shared_ptr<Schema>> schemas;
 
-  for (const auto& f : files_) {
-    if (!f.IsFile()) continue;
-
-    ARROW_ASSIGN_OR_RAISE(auto schema, format_->Inspect(FileSource(f.path(), fs_.get())));
+  if (summary_file_.has_value()) {
+    ARROW_ASSIGN_OR_RAISE(auto schema,
+                          format_->InspectSummary(
+                              FileSource(summary_file_->path(), fs_.get()), files_));
     schemas.push_back(schema);
+  } else {
+    std::vector<const fs::FileStats*> sample;
+    for (const auto& f : files_) {
+      if (f.IsFile()) {
+        sample.push_back(&f);
+      }
+    }
+
+    const auto num_files = static_cast<int>(sample.size());
+    if (options_.inspected_files >= 0 && options_.inspected_files < num_files) {
+      for (int i = 0; i < options_.inspected_files; ++i) {
+        const auto index = static_cast<int64_t>(i) * num_files / options_.inspected_files;
+        sample[i] = sample[index];
+      }
+      sample.resize(options_.inspected_files);
+    }
+
+    // Reading each file's metadata dominates for large datasets, so inspect
+    // them in parallel
+    std::vector<std::shared_ptr<Schema>> file_schemas(sample.size());
+    RETURN_NOT_OK(internal::ParallelFor(
+        static_cast<int>(sample.size()), [&](int i) -> Status {
+          return format_->Inspect(FileSource(sample[i]->path(), fs_.get()))
+              .Value(&file_schemas[i]);
+        }));
+    schemas = std::move(file_schemas);
   }
 
   if (schemas.empty()) {
@@ -120,8 +182,9 @@ Result<std::shared_ptr<Schema>> FileSystemDataSourceDiscovery::Inspect() {
     return partition_scheme_->schema();
   }
 
-  // TODO merge schemas.
-  auto out_schema = arrow::schema(schemas[0]->fields(), schemas[0]->metadata());
+  Field::MergeOptions merge_options;
+  merge_options.promote_integer_widths = options_.promote_integer_widths;
+  ARROW_ASSIGN_OR_RAISE(auto out_schema, UnifySchemas(schemas, merge_options));
 
   // add fields from partition_scheme_
   for (auto partition_field : partition_scheme_->schema()->fields()) {
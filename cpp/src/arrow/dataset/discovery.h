@@ -30,6 +30,7 @@
 #include "arrow/filesystem/filesystem.h"
 #include "arrow/filesystem/path_forest.h"
 #include "arrow/util/macros.h"
+#include "arrow/util/optional.h"
 
 namespace arrow {
 namespace dataset {
@@ -106,12 +107,30 @@ struct FileSystemDiscoveryOptions {
   std::string partition_base_dir;
 
   // Invalid files (via selector or explicitly) will be excluded by checking
-  // with the FileFormat::IsSupported method.  This will incur IO for each files
-  // in a serial and single threaded fashion. Disabling this feature will skip the
-  // IO, but unsupported files may will be present in the DataSource
+  // with the FileFormat::IsSupported method.  This will incur IO for each files,
+  // which is performed in parallel on the CPU thread pool. Disabling this feature
+  // will skip the IO, but unsupported files may will be present in the DataSource
   // (resulting in an error at scan time).
   bool exclude_invalid_files = true;
 
+  // If one of the files is the format's summary file (see
+  // FileFormat::summary_file_name, e.g. "_metadata" for Parquet), the schema is
+  // inspected from the summary alone instead of from every file, and the other
+  // files are trusted to be valid rather than checked with
+  // FileFormat::IsSupported. The summary file itself is never part of the
+  // DataSource.
+  bool use_summary_file = true;
+
+  // The schemas of this many files are unified by Inspect, sampled evenly
+  // across the dataset. Fields missing from some files are nullable in the
+  // unified schema. A negative value inspects every file, which incurs IO for
+  // each of them (performed in parallel on the CPU thread pool).
+  int inspected_files = -1;
+
+  // If true, integer fields whose type differs between files are unified to a
+  // type wide enough for all of them instead of raising an error.
+  bool promote_integer_widths = true;
+
   // Files matching one of the following prefix will be ignored by the
   // discovery process. This is matched to the basename of a path.
   //
@@ -134,6 +153,9 @@ class ARROW_DS_EXPORT FileSystemDataSourceDiscovery : public DataSourceDiscovery
   /// \brief Build a FileSystemDataSourceDiscovery from an explicit list of
   /// fs::FileStats.
   ///
+  /// Files are checked with FileFormat::IsSupported in parallel unless
+  /// options.exclude_invalid_files is false or a summary file is found.
+  ///
   /// \param[in] filesystem passed to FileSystemDataSource
   /// \param[in] paths passed to FileSystemDataSource
   /// \param[in] format passed to FileSystemDataSource
@@ -167,12 +189,14 @@ class ARROW_DS_EXPORT FileSystemDataSourceDiscovery : public DataSourceDiscovery
  protected:
   FileSystemDataSourceDiscovery(fs::FileSystemPtr filesystem,
                                 std::vector<fs::FileStats> files, FileFormatPtr format,
-                                FileSystemDiscoveryOptions options);
+                                FileSystemDiscoveryOptions options,
+                                util::optional<fs::FileStats> summary_file);
 
   fs::FileSystemPtr fs_;
   std::vector<fs::FileStats> files_;
   FileFormatPtr format_;
   FileSystemDiscoveryOptions options_;
+  util::optional<fs::FileStats> summary_file_;
 };
 
 }  // namespace dataset
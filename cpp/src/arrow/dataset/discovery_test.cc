@@ -17,6 +17,12 @@
 
 #include "arrow/dataset/discovery.h"
 
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
@@ -125,5 +131,100 @@ TEST_F(FileSystemDataSourceDiscoveryTest, Inspect) {
   EXPECT_EQ(*actual, *s);
 }
 
+class SchemaByPathFileFormat : public DummyFileFormat {
+ public:
+  explicit SchemaByPathFileFormat(
+      std::unordered_map<std::string, std::shared_ptr<Schema>> schemas)
+      : schemas_(std::move(schemas)) {}
+
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override {
+    std::lock_guard<std::mutex> lock(mutex_);
+    inspected_paths.push_back(source.path());
+    return schemas_.at(source.path());
+  }
+
+  mutable std::vector<std::string> inspected_paths;
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<Schema>> schemas_;
+};
+
+TEST_F(FileSystemDataSourceDiscoveryTest, InspectUnifiesSchemas) {
+  format_ = std::make_shared<SchemaByPathFileFormat>(
+      std::unordered_map<std::string, std::shared_ptr<Schema>>{
+          {"a", schema({field("i", int32(), false), field("s", utf8(), false)})},
+          {"b", schema({field("i", int64(), false)})},
+          {"c", schema({field("i", int8()), field("f", float64(), false)})},
+      });
+
+  // "s" is missing from "b" and "f" from "a" and "b": both become nullable
+  MakeDiscovery({fs::File("a"), fs::File("b"), fs::File("c")});
+  AssertInspect({field("i", int64()), field("s", utf8()), field("f", float64())});
+
+  discovery_options_.promote_integer_widths = false;
+  MakeDiscovery({fs::File("a"), fs::File("b"), fs::File("c")});
+  ASSERT_RAISES(Invalid, discovery_->Inspect());
+
+  // A non-nullable field present in every file stays non-nullable
+  format_ = std::make_shared<SchemaByPathFileFormat>(
+      std::unordered_map<std::string, std::shared_ptr<Schema>>{
+          {"a", schema({field("i", int32(), false), field("s", utf8(), false)})},
+          {"b", schema({field("i", int32(), false)})},
+      });
+  MakeDiscovery({fs::File("a"), fs::File("b")});
+  AssertInspect({field("i", int32(), false), field("s", utf8())});
+}
+
+TEST_F(FileSystemDataSourceDiscoveryTest, InspectSampledFiles) {
+  auto s = schema({field("f64", float64())});
+  auto format = std::make_shared<SchemaByPathFileFormat>(
+      std::unordered_map<std::string, std::shared_ptr<Schema>>{
+          {"a", s}, {"b", s}, {"c", s}, {"d", s}});
+  format_ = format;
+
+  discovery_options_.inspected_files = 2;
+  MakeDiscovery({fs::File("a"), fs::File("b"), fs::File("c"), fs::File("d")});
+  AssertInspect(s->fields());
+  EXPECT_THAT(format->inspected_paths, testing::UnorderedElementsAre("a", "c"));
+}
+
+class SummaryFileFormat : public DummyFileFormat {
+ public:
+  using DummyFileFormat::DummyFileFormat;
+
+  std::string summary_file_name() const override { return "_metadata"; }
+
+  Result<std::shared_ptr<Schema>> InspectSummary(
+      const FileSource& summary, const fs::FileStatsVector& files) const override {
+    summary_path = summary.path();
+    return schema_;
+  }
+
+  mutable std::string summary_path;
+};
+
+TEST_F(FileSystemDataSourceDiscoveryTest, SummaryFile) {
+  auto s = schema({field("f64", float64())});
+  auto format = std::make_shared<SummaryFileFormat>(s);
+  format_ = format;
+
+  selector_.recursive = true;
+  MakeDiscovery({fs::File("A/_metadata"), fs::File("A/B/_metadata"), fs::File("A/a"),
+                 fs::File("A/B/b")});
+  AssertInspect(s->fields());
+  // The outermost summary is used and none is treated as a data file
+  EXPECT_EQ(format->summary_path, "A/_metadata");
+  AssertFinishWithPaths({"A/a", "A/B/b"});
+
+  format->summary_path.clear();
+  discovery_options_.use_summary_file = false;
+  MakeDiscovery({fs::File("A/_metadata"), fs::File("A/a")});
+  AssertInspect(s->fields());
+  EXPECT_EQ(format->summary_path, "");
+  // Without summaries, "_metadata" is ignored as any other "_" prefixed file
+  AssertFinishWithPaths({"A/a"});
+}
+
 }  // namespace dataset
 }  // namespace arrow
@@ -140,6 +140,21 @@ class ARROW_DS_EXPORT FileFormat {
   /// \brief Return the schema of the file if possible.
   virtual Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const = 0;
 
+  /// \brief The basename of a summary file describing all the files of a
+  /// dataset in this format (e.g. "_metadata" for Parquet), or an empty string
+  /// if the format has no such file.
+  virtual std::string summary_file_name() const { return ""; }
+
+  /// \brief Return the schema of a dataset from its summary file.
+  ///
+  /// Formats may also retain the summarized metadata of `files` so that later
+  /// reads of these files need not parse it again. The default implementation
+  /// inspects the summary file like any other file.
+  virtual Result<std::shared_ptr<Schema>> InspectSummary(
+      const FileSource& summary, const fs::FileStatsVector& files) const {
+    return Inspect(summary);
+  }
+
   /// \brief Open a file for scanning
   virtual Result<ScanTaskIterator> ScanFile(const FileSource& source,
                                             ScanOptionsPtr options,
@@ -0,0 +1,335 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/buffer.h"
+#include "arrow/csv/reader.h"
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/filesystem.h"
+#include "arrow/io/memory.h"
+#include "arrow/table.h"
+#include "arrow/util/iterator.h"
+#include "arrow/util/optional.h"
+
+namespace arrow {
+namespace dataset {
+
+// The number of bytes read at once when looking for a row boundary
+static constexpr int64_t kRowBoundarySearchSize = 1 << 16;
+
+// The number of bytes from which the column types of a file are inferred
+static constexpr int64_t kInspectSize = 1 << 20;
+
+/// \brief Return the offset of the first row beginning at or after position,
+/// or the size of the file if there is none.
+static Result<int64_t> FindRowStart(io::RandomAccessFile* input, int64_t position,
+                                    int64_t size) {
+  if (position == 0) {
+    return 0;
+  }
+
+  // position is a row start iff it follows a row end
+  for (int64_t offset = position - 1; offset < size; offset += kRowBoundarySearchSize) {
+    ARROW_ASSIGN_OR_RAISE(auto buffer, input->ReadAt(offset, kRowBoundarySearchSize));
+    auto data = reinterpret_cast<const char*>(buffer->data());
+    auto newline = static_cast<const char*>(std::memchr(data, '\n', buffer->size()));
+    if (newline != nullptr) {
+      return offset + (newline - data) + 1;
+    }
+  }
+  return size;
+}
+
+namespace {
+
+struct CsvFileLayout {
+  // The columns of the file, with types inferred from its beginning
+  std::shared_ptr<Schema> schema;
+  // The size of the row of column names
+  int64_t header_size;
+  int64_t file_size;
+};
+
+}  // namespace
+
+/// \brief The layouts of the files inspected by a CsvFileFormat, by filesystem
+/// and path.
+///
+/// Entries are only returned while the size and modification time of the file
+/// match those it was cached with. The least recently used entries are
+/// evicted once the capacity is exceeded.
+class CsvLayoutCache {
+ public:
+  static constexpr size_t kCapacity = 4096;
+
+  /// \brief Return the layout of a file, unless it wasn't cached or was
+  /// modified since.
+  bool Get(const fs::FileSystem* filesystem, const fs::FileStats& stats,
+           CsvFileLayout* out) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(Key{filesystem, stats.path()});
+    if (it == entries_.end()) {
+      return false;
+    }
+    if (it->second.size != stats.size() || it->second.mtime != stats.mtime()) {
+      // The file was modified since it was cached
+      lru_.erase(it->second.lru_position);
+      entries_.erase(it);
+      return false;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    *out = it->second.layout;
+    return true;
+  }
+
+  /// \brief Cache the layout of a file
+  ///
+  /// Files of unknown size or modification time are not cached.
+  void Put(const fs::FileSystem* filesystem, const fs::FileStats& stats,
+           const CsvFileLayout& layout) {
+    // Without a size and a modification time, a rewritten file could not be
+    // told apart
+    if (stats.size() == fs::kNoSize || stats.mtime() == fs::kNoTime) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    Key key{filesystem, stats.path()};
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    } else {
+      lru_.push_front(key);
+      it = entries_.emplace(std::move(key), Entry{}).first;
+      it->second.lru_position = lru_.begin();
+    }
+    it->second.size = stats.size();
+    it->second.mtime = stats.mtime();
+    it->second.layout = layout;
+
+    while (entries_.size() > kCapacity) {
+      entries_.erase(lru_.back());
+      lru_.pop_back();
+    }
+  }
+
+ private:
+  // Paths are only unique within a filesystem
+  using Key = std::pair<const fs::FileSystem*, std::string>;
+
+  struct Entry {
+    int64_t size;
+    fs::TimePoint mtime;
+    CsvFileLayout layout;
+    // Position of the key in lru_
+    std::list<Key>::iterator lru_position;
+  };
+
+  std::mutex mutex_;
+  std::map<Key, Entry> entries_;
+  std::list<Key> lru_;
+};
+
+constexpr size_t CsvLayoutCache::kCapacity;
+
+static Result<CsvFileLayout> InspectLayout(const CsvFileFormat& format,
+                                           CsvLayoutCache* cache,
+                                           const FileSource& source,
+                                           io::RandomAccessFile* input,
+                                           MemoryPool* pool) {
+  CsvFileLayout layout;
+  // Only files have stats identifying their contents. If they can't be
+  // stat'ed, the file is simply inspected without the cache.
+  util::optional<fs::FileStats> stats;
+  if (source.type() == FileSource::PATH) {
+    auto maybe_stats = source.filesystem()->GetTargetStats(source.path());
+    if (maybe_stats.ok()) {
+      stats = std::move(maybe_stats).ValueOrDie();
+      if (cache->Get(source.filesystem(), *stats, &layout)) {
+        return layout;
+      }
+    }
+  }
+  ARROW_ASSIGN_OR_RAISE(layout.file_size, input->GetSize());
+  ARROW_ASSIGN_OR_RAISE(layout.header_size, FindRowStart(input, 1, layout.file_size));
+
+  // Infer types from the complete rows at the beginning of the file
+  ARROW_ASSIGN_OR_RAISE(auto sample, input->ReadAt(0, kInspectSize));
+  if (sample->size() < layout.file_size) {
+    int64_t sample_size = sample->size();
+    while (sample_size > 0 && sample->data()[sample_size - 1] != '\n') {
+      --sample_size;
+    }
+    if (sample_size > 0) {
+      sample = SliceBuffer(sample, 0, sample_size);
+    }
+  }
+
+  auto read_options = csv::ReadOptions::Defaults();
+  read_options.use_threads = false;
+  ARROW_ASSIGN_OR_RAISE(
+      auto reader,
+      csv::TableReader::Make(pool, std::make_shared<io::BufferReader>(sample),
+                             read_options, format.parse_options,
+                             format.convert_options));
+  ARROW_ASSIGN_OR_RAISE(auto table, reader->Read());
+  layout.schema = table->schema();
+  if (stats.has_value() && stats->size() == layout.file_size) {
+    cache->Put(source.filesystem(), *stats, layout);
+  }
+  return layout;
+}
+
+/// \brief Return options converting only the columns read by a scan, those
+/// in the scanned schema directly to their type there.
+static csv::ConvertOptions MakeConvertOptions(const csv::ConvertOptions& base,
+                                              const Schema& file_schema,
+                                              const ScanOptions& options) {
+  auto convert_options = base;
+  convert_options.include_columns.clear();
+  convert_options.include_missing_columns = false;
+
+  for (const auto& name : MaterializedColumnNames(options)) {
+    auto file_field = file_schema.GetFieldByName(name);
+    if (file_field == nullptr) {
+      // Materialized by the projector
+      continue;
+    }
+    auto field = options.schema()->GetFieldByName(name);
+    convert_options.include_columns.push_back(name);
+    convert_options.column_types[name] =
+        field != nullptr ? field->type() : file_field->type();
+  }
+
+  if (convert_options.include_columns.empty() && file_schema.num_fields() > 0) {
+    // Rows must still be counted, and all columns are read if none is included
+    const auto& file_field = file_schema.field(0);
+    convert_options.include_columns.push_back(file_field->name());
+    convert_options.column_types[file_field->name()] = file_field->type();
+  }
+  return convert_options;
+}
+
+/// \brief A ScanTask parsing the rows of a CSV file which begin within a byte
+/// range.
+class CsvScanTask : public ScanTask {
+ public:
+  CsvScanTask(std::shared_ptr<io::RandomAccessFile> input, int64_t begin, int64_t end,
+              int64_t file_size, csv::ReadOptions read_options,
+              csv::ParseOptions parse_options, csv::ConvertOptions convert_options,
+              ScanOptionsPtr options, ScanContextPtr context)
+      : ScanTask(std::move(options), std::move(context)),
+        input_(std::move(input)),
+        begin_(begin),
+        end_(end),
+        file_size_(file_size),
+        read_options_(std::move(read_options)),
+        parse_options_(std::move(parse_options)),
+        convert_options_(std::move(convert_options)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    ARROW_ASSIGN_OR_RAISE(auto begin, FindRowStart(input_.get(), begin_, file_size_));
+    ARROW_ASSIGN_OR_RAISE(auto end, FindRowStart(input_.get(), end_, file_size_));
+    if (begin >= end) {
+      return MakeEmptyIterator<std::shared_ptr<RecordBatch>>();
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto rows, input_->ReadAt(begin, end - begin));
+    ARROW_ASSIGN_OR_RAISE(
+        auto reader,
+        csv::TableReader::Make(context_->pool, std::make_shared<io::BufferReader>(rows),
+                               read_options_, parse_options_, convert_options_));
+    ARROW_ASSIGN_OR_RAISE(std::shared_ptr<Table> table, reader->Read());
+
+    auto batches = std::make_shared<TableBatchReader>(*table);
+    return MakeFunctionIterator([table, batches] { return batches->Next(); });
+  }
+
+ private:
+  std::shared_ptr<io::RandomAccessFile> input_;
+  int64_t begin_, end_, file_size_;
+  csv::ReadOptions read_options_;
+  csv::ParseOptions parse_options_;
+  csv::ConvertOptions convert_options_;
+};
+
+CsvFileFormat::CsvFileFormat() : layout_cache_(std::make_shared<CsvLayoutCache>()) {}
+
+Result<bool> CsvFileFormat::IsSupported(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  return InspectLayout(*this, layout_cache_.get(), source, input.get(),
+                       default_memory_pool())
+      .ok();
+}
+
+Result<std::shared_ptr<Schema>> CsvFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  ARROW_ASSIGN_OR_RAISE(auto layout, InspectLayout(*this, layout_cache_.get(), source,
+                                                   input.get(), default_memory_pool()));
+  return layout.schema;
+}
+
+Result<ScanTaskIterator> CsvFileFormat::ScanFile(const FileSource& source,
+                                                 ScanOptionsPtr options,
+                                                 ScanContextPtr context) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+  ARROW_ASSIGN_OR_RAISE(auto layout, InspectLayout(*this, layout_cache_.get(), source,
+                                                   input.get(), context->pool));
+
+  // Every range is parsed with the same column names and types
+  auto read_options = csv::ReadOptions::Defaults();
+  read_options.use_threads = false;
+  read_options.column_names = layout.schema->field_names();
+
+  auto convert_options =
+      MakeConvertOptions(this->convert_options, *layout.schema, *options);
+
+  const int64_t range_size = parse_options.newlines_in_values
+                                 ? layout.file_size
+                                 : std::max<int64_t>(scan_range_size, 1);
+
+  ScanTaskVector tasks;
+  for (int64_t begin = layout.header_size; begin < layout.file_size;
+       begin += range_size) {
+    auto end = std::min(begin + range_size, layout.file_size);
+    tasks.push_back(std::make_shared<CsvScanTask>(input, begin, end, layout.file_size,
+                                                  read_options, parse_options,
+                                                  convert_options, options, context));
+  }
+  return MakeVectorIterator(std::move(tasks));
+}
+
+Result<DataFragmentPtr> CsvFileFormat::MakeFragment(const FileSource& source,
+                                                    ScanOptionsPtr options) {
+  return std::make_shared<CsvFragment>(source, std::make_shared<CsvFileFormat>(*this),
+                                       options);
+}
+
+}  // namespace dataset
+}  // namespace arrow
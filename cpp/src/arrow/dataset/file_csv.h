@@ -0,0 +1,102 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/csv/options.h"
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+
+namespace arrow {
+namespace dataset {
+
+class ARROW_DS_EXPORT CsvScanOptions : public FileScanOptions {
+ public:
+  std::string file_type() const override { return "csv"; }
+};
+
+class ARROW_DS_EXPORT CsvWriteOptions : public FileWriteOptions {
+ public:
+  std::string file_type() const override { return "csv"; }
+};
+
+class CsvLayoutCache;
+
+/// \brief A FileFormat implementation that reads from CSV files
+///
+/// The first row of each file holds the column names. Column types are
+/// inferred from the beginning of the file, unless the scanned schema
+/// provides them. The column names and types found when a file is inspected
+/// are reused when it is scanned, as long as its size and modification time
+/// are unchanged; copies of the format (e.g. those of its fragments) share
+/// them, so the options should not be modified once files were inspected.
+/// Files whose modification time is unknown are inspected every time.
+///
+/// Files are split into byte ranges of about scan_range_size bytes which are
+/// read and parsed by independent ScanTasks. Each range is extended to row
+/// boundaries, which requires rows to be terminated by LF or CRLF and values
+/// not to contain newlines; if parse_options.newlines_in_values is set, each
+/// file is scanned by a single ScanTask.
+class ARROW_DS_EXPORT CsvFileFormat : public FileFormat {
+ public:
+  CsvFileFormat();
+
+  /// Options affecting how CSV files are parsed
+  csv::ParseOptions parse_options = csv::ParseOptions::Defaults();
+
+  /// Options affecting how CSV values are converted, e.g. null spellings.
+  /// Its column_types, include_columns and include_missing_columns are
+  /// derived from the scan.
+  csv::ConvertOptions convert_options = csv::ConvertOptions::Defaults();
+
+  /// The size of the byte ranges scanned by each ScanTask
+  int64_t scan_range_size = 1 << 24;  // 16 MB
+
+  std::string type_name() const override { return "csv"; }
+
+  Result<bool> IsSupported(const FileSource& source) const override;
+
+  /// \brief Return the schema of the file if possible.
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
+
+  /// \brief Open a file for scanning
+  Result<ScanTaskIterator> ScanFile(const FileSource& source, ScanOptionsPtr options,
+                                    ScanContextPtr context) const override;
+
+  Result<DataFragmentPtr> MakeFragment(const FileSource& source,
+                                       ScanOptionsPtr options) override;
+
+ private:
+  std::shared_ptr<CsvLayoutCache> layout_cache_;
+};
+
+class ARROW_DS_EXPORT CsvFragment : public FileDataFragment {
+ public:
+  CsvFragment(const FileSource& source, std::shared_ptr<CsvFileFormat> format,
+              ScanOptionsPtr options)
+      : FileDataFragment(source, std::move(format), options) {}
+
+  bool splittable() const override { return true; }
+};
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,248 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_csv.h"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/io/memory.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace dataset {
+
+using internal::checked_cast;
+
+class TestCsvFileFormat : public testing::Test {
+ public:
+  std::unique_ptr<FileSource> GetFileSource(std::string csv) {
+    return internal::make_unique<FileSource>(Buffer::FromString(std::move(csv)));
+  }
+
+  // Scan a fragment, returning the values of its int64 column "i64"
+  std::vector<int64_t> ScanInt64Column(DataFragment& fragment,
+                                       int64_t* task_count = NULLPTR) {
+    std::vector<int64_t> values;
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment.Scan(ctx_));
+    if (task_count != NULLPTR) {
+      *task_count = 0;
+    }
+
+    for (auto maybe_task : scan_task_it) {
+      EXPECT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+      EXPECT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+      for (auto maybe_batch : rb_it) {
+        EXPECT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+        auto column = batch->GetColumnByName("i64");
+        EXPECT_NE(column, nullptr);
+        const auto& array = checked_cast<const Int64Array&>(*column);
+        for (int64_t i = 0; i < array.length(); ++i) {
+          values.push_back(array.Value(i));
+        }
+      }
+      if (task_count != NULLPTR) {
+        ++*task_count;
+      }
+    }
+    return values;
+  }
+
+ protected:
+  ScanOptionsPtr opts_;
+  ScanContextPtr ctx_ = std::make_shared<ScanContext>();
+};
+
+TEST_F(TestCsvFileFormat, ScanRecordBatchReader) {
+  auto source = GetFileSource(R"(i64,str
+1,a
+2,b
+3,c
+)");
+  auto format = std::make_shared<CsvFileFormat>();
+  opts_ = ScanOptions::Make(schema({field("i64", int64()), field("str", utf8())}));
+  auto fragment = std::make_shared<CsvFragment>(*source, format, opts_);
+
+  EXPECT_EQ(ScanInt64Column(*fragment), std::vector<int64_t>({1, 2, 3}));
+}
+
+TEST_F(TestCsvFileFormat, ScanRanges) {
+  std::string csv = "i64,str\n";
+  std::vector<int64_t> expected;
+  for (int64_t i = 0; i < 1000; ++i) {
+    csv += std::to_string(i) + "," + std::string(i % 7, 'x') + "\n";
+    expected.push_back(i);
+  }
+  auto source = GetFileSource(csv);
+  opts_ = ScanOptions::Make(schema({field("i64", int64()), field("str", utf8())}));
+
+  // Ranges which begin or end in the middle of a row must neither drop nor
+  // duplicate it
+  for (int64_t range_size : {1, 7, 64, 1000, 1 << 20}) {
+    auto format = std::make_shared<CsvFileFormat>();
+    format->scan_range_size = range_size;
+    auto fragment = std::make_shared<CsvFragment>(*source, format, opts_);
+
+    int64_t task_count = 0;
+    EXPECT_EQ(ScanInt64Column(*fragment, &task_count), expected);
+    EXPECT_EQ(task_count, (static_cast<int64_t>(csv.size()) - 8 + range_size - 1) /
+                              range_size);
+  }
+
+  // Quoted values may contain newlines, so such files can't be split
+  auto format = std::make_shared<CsvFileFormat>();
+  format->scan_range_size = 64;
+  format->parse_options.newlines_in_values = true;
+  auto fragment = std::make_shared<CsvFragment>(*source, format, opts_);
+
+  int64_t task_count = 0;
+  EXPECT_EQ(ScanInt64Column(*fragment, &task_count), expected);
+  EXPECT_EQ(task_count, 1);
+}
+
+TEST_F(TestCsvFileFormat, ScanRecordBatchReaderProjected) {
+  auto source = GetFileSource(R"(f64,i64,str,i32
+1.5,1,a,4
+2.5,2,b,5
+)");
+  auto scan_schema = schema({field("f64", float64()), field("i64", int64()),
+                             field("str", utf8()), field("i32", int32())});
+  opts_ = ScanOptions::Make(scan_schema);
+  opts_->projector = RecordBatchProjector(SchemaFromColumnNames(scan_schema, {"i64"}));
+  opts_->filter = equal(field_ref("i32"), scalar(0));
+
+  // NB: projector is applied by the scanner; CsvFragment only converts the
+  // columns which are projected or referenced by the filter. The latter aren't
+  // in the projected schema so they keep their inferred type.
+  auto expected_schema = schema({field("i64", int64()), field("i32", int64())});
+
+  auto format = std::make_shared<CsvFileFormat>();
+  auto fragment = std::make_shared<CsvFragment>(*source, format, opts_);
+
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+  int64_t row_count = 0;
+
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    ASSERT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+    for (auto maybe_batch : rb_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+      ASSERT_EQ(*batch->schema(), *expected_schema);
+    }
+  }
+
+  ASSERT_EQ(row_count, 2);
+}
+
+TEST_F(TestCsvFileFormat, Inspect) {
+  auto source = GetFileSource(R"(f64,i64,str
+1.5,1,a
+2.5,2,b
+)");
+  auto format = CsvFileFormat();
+
+  ASSERT_OK_AND_ASSIGN(auto actual, format.Inspect(*source.get()));
+  EXPECT_EQ(*actual, *schema({field("f64", float64()), field("i64", int64()),
+                              field("str", utf8())}));
+}
+
+// A MockFileSystem whose files have a modification time set by the test
+class MtimeFileSystem : public fs::internal::MockFileSystem {
+ public:
+  MtimeFileSystem() : MockFileSystem(fs::kNoTime) {}
+
+  using MockFileSystem::GetTargetStats;
+  Result<fs::FileStats> GetTargetStats(const std::string& path) override {
+    ARROW_ASSIGN_OR_RAISE(auto stats, MockFileSystem::GetTargetStats(path));
+    stats.set_mtime(mtime);
+    return stats;
+  }
+
+  fs::TimePoint mtime = fs::TimePoint(fs::TimePoint::duration(1));
+};
+
+TEST_F(TestCsvFileFormat, InspectedLayoutIsValidated) {
+  auto fs = std::make_shared<MtimeFileSystem>();
+  ASSERT_OK(fs->CreateFile("a.csv", "x\n1.\n2\n"));
+  FileSource source("a.csv", fs.get());
+  auto format = std::make_shared<CsvFileFormat>();
+  ASSERT_OK_AND_ASSIGN(auto inspected, format->Inspect(source));
+  AssertSchemaEqual(*inspected, *schema({field("x", float64())}));
+
+  // The type of "x" isn't in the scanned schema, so it is the inferred one
+  opts_ = ScanOptions::Make(schema({}));
+  auto ScannedType = [&](const FileSource& file) -> std::shared_ptr<DataType> {
+    EXPECT_OK_AND_ASSIGN(auto fragment, format->MakeFragment(file, opts_));
+    EXPECT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+    EXPECT_OK_AND_ASSIGN(auto task, scan_task_it.Next());
+    EXPECT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+    EXPECT_OK_AND_ASSIGN(auto batch, rb_it.Next());
+    return batch->schema()->field(0)->type();
+  };
+  EXPECT_TRUE(ScannedType(source)->Equals(float64()));
+
+  // A file rewritten at the same size is inspected again
+  ASSERT_OK(fs->CreateFile("a.csv", "x\n10\n2\n"));
+  fs->mtime += std::chrono::seconds(1);
+  EXPECT_TRUE(ScannedType(source)->Equals(int64()));
+
+  // As are files of unknown modification time, every time
+  fs->mtime = fs::kNoTime;
+  ASSERT_OK(fs->CreateFile("a.csv", "x\n1.\n2\n"));
+  EXPECT_TRUE(ScannedType(source)->Equals(float64()));
+  ASSERT_OK(fs->CreateFile("a.csv", "x\n10\n2\n"));
+  EXPECT_TRUE(ScannedType(source)->Equals(int64()));
+
+  // Layouts are not shared between filesystems
+  fs->mtime = fs::TimePoint(fs::TimePoint::duration(1));
+  auto other_fs = std::make_shared<MtimeFileSystem>();
+  ASSERT_OK(other_fs->CreateFile("a.csv", "x\n1.\n2\n"));
+  EXPECT_TRUE(ScannedType(source)->Equals(int64()));
+  EXPECT_TRUE(ScannedType(FileSource("a.csv", other_fs.get()))->Equals(float64()));
+}
+
+TEST_F(TestCsvFileFormat, IsSupported) {
+  auto format = CsvFileFormat();
+  bool supported = false;
+
+  std::shared_ptr<Buffer> buf = std::make_shared<Buffer>(util::string_view(""));
+  ASSERT_OK_AND_ASSIGN(supported, format.IsSupported(FileSource(buf)));
+  ASSERT_EQ(supported, false);
+
+  buf = std::make_shared<Buffer>(util::string_view("a,b\n1,2,3\n"));
+  ASSERT_OK_AND_ASSIGN(supported, format.IsSupported(FileSource(buf)));
+  ASSERT_EQ(supported, false);
+
+  auto source = GetFileSource("a,b\n1,2\n");
+  ASSERT_OK_AND_ASSIGN(supported, format.IsSupported(*source));
+  EXPECT_EQ(supported, true);
+}
+
+}  // namespace dataset
+}  // namespace arrow
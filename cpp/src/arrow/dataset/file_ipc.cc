@@ -0,0 +1,162 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/file_ipc.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "arrow/dataset/dataset_internal.h"
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/scanner.h"
+#include "arrow/ipc/reader.h"
+#include "arrow/record_batch.h"
+#include "arrow/util/iterator.h"
+
+namespace arrow {
+namespace dataset {
+
+static Result<std::shared_ptr<ipc::RecordBatchFileReader>> OpenReader(
+    const FileSource& source) {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  auto status = ipc::RecordBatchFileReader::Open(std::move(input), &reader);
+  if (!status.ok()) {
+    return status.WithMessage("Could not open IPC input source '" + source.path() +
+                              "': " + status.message());
+  }
+  return reader;
+}
+
+/// \brief A ScanTask backed by a single record batch of an IPC file.
+class IpcScanTask : public ScanTask {
+ public:
+  IpcScanTask(int batch_index, std::vector<int> column_projection,
+              std::shared_ptr<ipc::RecordBatchFileReader> reader, ScanOptionsPtr options,
+              ScanContextPtr context)
+      : ScanTask(std::move(options), std::move(context)),
+        batch_index_(batch_index),
+        column_projection_(std::move(column_projection)),
+        reader_(std::move(reader)) {}
+
+  Result<RecordBatchIterator> Execute() override {
+    // Record batches are read lazily, so that materializing all ScanTasks
+    // doesn't read the whole file.
+    std::shared_ptr<RecordBatch> batch;
+    RETURN_NOT_OK(reader_->ReadRecordBatch(batch_index_, &batch));
+
+    // Columns are selected without copying; unselected ones are never touched
+    // when the file is memory-mapped.
+    std::vector<std::shared_ptr<Field>> fields;
+    std::vector<std::shared_ptr<Array>> columns;
+    for (int i : column_projection_) {
+      fields.push_back(batch->schema()->field(i));
+      columns.push_back(batch->column(i));
+    }
+    batch = RecordBatch::Make(schema(std::move(fields), batch->schema()->metadata()),
+                              batch->num_rows(), std::move(columns));
+
+    return MakeVectorIterator<std::shared_ptr<RecordBatch>>({std::move(batch)});
+  }
+
+ private:
+  int batch_index_;
+  std::vector<int> column_projection_;
+  // Shared by all ScanTasks of a file, the reader (and the file it keeps open)
+  // must outlive the producing iterator.
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+};
+
+class IpcScanTaskIterator {
+ public:
+  static Result<ScanTaskIterator> Make(
+      ScanOptionsPtr options, ScanContextPtr context,
+      std::shared_ptr<ipc::RecordBatchFileReader> reader) {
+    auto column_projection = InferColumnProjection(*reader->schema(), *options);
+    return ScanTaskIterator(IpcScanTaskIterator(std::move(options), std::move(context),
+                                                std::move(column_projection),
+                                                std::move(reader)));
+  }
+
+  Result<ScanTaskPtr> Next() {
+    if (batch_index_ == reader_->num_record_batches()) {
+      return nullptr;
+    }
+
+    return ScanTaskPtr(new IpcScanTask(batch_index_++, column_projection_, reader_,
+                                       options_, context_));
+  }
+
+ private:
+  // Select the file's columns which are projected or referenced by the filter
+  static std::vector<int> InferColumnProjection(const Schema& file_schema,
+                                                const ScanOptions& options) {
+    std::vector<int> column_projection;
+    for (const auto& name : MaterializedColumnNames(options)) {
+      int index = file_schema.GetFieldIndex(name);
+      if (index != -1) {
+        column_projection.push_back(index);
+      }
+    }
+    return column_projection;
+  }
+
+  IpcScanTaskIterator(ScanOptionsPtr options, ScanContextPtr context,
+                      std::vector<int> column_projection,
+                      std::shared_ptr<ipc::RecordBatchFileReader> reader)
+      : options_(std::move(options)),
+        context_(std::move(context)),
+        column_projection_(std::move(column_projection)),
+        reader_(std::move(reader)) {}
+
+  ScanOptionsPtr options_;
+  ScanContextPtr context_;
+  std::vector<int> column_projection_;
+  std::shared_ptr<ipc::RecordBatchFileReader> reader_;
+  int batch_index_ = 0;
+};
+
+Result<bool> IpcFileFormat::IsSupported(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
+
+  std::shared_ptr<ipc::RecordBatchFileReader> reader;
+  return ipc::RecordBatchFileReader::Open(std::move(input), &reader).ok();
+}
+
+Result<std::shared_ptr<Schema>> IpcFileFormat::Inspect(const FileSource& source) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  return reader->schema();
+}
+
+Result<ScanTaskIterator> IpcFileFormat::ScanFile(const FileSource& source,
+                                                 ScanOptionsPtr options,
+                                                 ScanContextPtr context) const {
+  ARROW_ASSIGN_OR_RAISE(auto reader, OpenReader(source));
+  return IpcScanTaskIterator::Make(std::move(options), std::move(context),
+                                   std::move(reader));
+}
+
+Result<DataFragmentPtr> IpcFileFormat::MakeFragment(const FileSource& source,
+                                                    ScanOptionsPtr options) {
+  return std::make_shared<IpcFragment>(source, options);
+}
+
+}  // namespace dataset
+}  // namespace arrow
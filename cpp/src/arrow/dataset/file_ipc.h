@@ -0,0 +1,73 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "arrow/dataset/file_base.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+
+namespace arrow {
+namespace dataset {
+
+class ARROW_DS_EXPORT IpcScanOptions : public FileScanOptions {
+ public:
+  std::string file_type() const override { return "ipc"; }
+};
+
+class ARROW_DS_EXPORT IpcWriteOptions : public FileWriteOptions {
+ public:
+  std::string file_type() const override { return "ipc"; }
+};
+
+/// \brief A FileFormat implementation that reads from Arrow IPC files (also
+/// known as Feather V2 files).
+///
+/// Each record batch of a file is scanned by its own ScanTask. Reading is
+/// zero-copy when the file is memory resident, i.e. when the FileSource is a
+/// buffer or when the filesystem opens memory-mapped files (as LocalFileSystem
+/// does with LocalFileSystemOptions::use_mmap).
+class ARROW_DS_EXPORT IpcFileFormat : public FileFormat {
+ public:
+  std::string type_name() const override { return "ipc"; }
+
+  Result<bool> IsSupported(const FileSource& source) const override;
+
+  /// \brief Return the schema of the file if possible.
+  Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
+
+  /// \brief Open a file for scanning
+  Result<ScanTaskIterator> ScanFile(const FileSource& source, ScanOptionsPtr options,
+                                    ScanContextPtr context) const override;
+
+  Result<DataFragmentPtr> MakeFragment(const FileSource& source,
+                                       ScanOptionsPtr options) override;
+};
+
+class ARROW_DS_EXPORT IpcFragment : public FileDataFragment {
+ public:
+  IpcFragment(const FileSource& source, ScanOptionsPtr options)
+      : FileDataFragment(source, std::make_shared<IpcFileFormat>(), options) {}
+
+  bool splittable() const override { return true; }
+};
+
+}  // namespace dataset
+}  // namespace arrow
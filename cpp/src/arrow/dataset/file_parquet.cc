@@ -17,19 +17,25 @@
 
 #include "arrow/dataset/file_parquet.h"
 
+#include <list>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner.h"
+#include "arrow/filesystem/path_util.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/range.h"
 #include "parquet/arrow/reader.h"
 #include "parquet/arrow/schema.h"
 #include "parquet/file_reader.h"
+#include "parquet/metadata.h"
 #include "parquet/statistics.h"
 
 namespace arrow {
@@ -215,6 +221,109 @@ class ParquetScanTaskIterator {
   std::shared_ptr<parquet::arrow::FileReader> reader_;
 };
 
+// ----------------------------------------------------------------------
+// ParquetMetadataCache
+
+class ParquetMetadataCache::Impl {
+ public:
+  struct Entry {
+    int64_t size;
+    fs::TimePoint mtime;
+    std::shared_ptr<parquet::FileMetaData> metadata;
+    // Position of the path in lru_
+    std::list<std::string>::iterator lru_position;
+  };
+
+  std::shared_ptr<parquet::FileMetaData> Get(const fs::FileStats& stats) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(stats.path());
+    if (it == entries_.end()) {
+      return nullptr;
+    }
+    if (it->second.size != stats.size() || it->second.mtime != stats.mtime()) {
+      // The file was modified since it was cached
+      lru_.erase(it->second.lru_position);
+      entries_.erase(it);
+      return nullptr;
+    }
+    lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    return it->second.metadata;
+  }
+
+  void Put(const fs::FileStats& stats, std::shared_ptr<parquet::FileMetaData> metadata,
+           size_t capacity) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(stats.path());
+    if (it != entries_.end()) {
+      lru_.splice(lru_.begin(), lru_, it->second.lru_position);
+    } else {
+      lru_.push_front(stats.path());
+      it = entries_.emplace(stats.path(), Entry{}).first;
+      it->second.lru_position = lru_.begin();
+    }
+    it->second.size = stats.size();
+    it->second.mtime = stats.mtime();
+    it->second.metadata = std::move(metadata);
+
+    while (entries_.size() > capacity) {
+      entries_.erase(lru_.back());
+      lru_.pop_back();
+    }
+  }
+
+  void Clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.clear();
+    lru_.clear();
+  }
+
+  size_t size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return entries_.size();
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  // Most recently used paths first
+  std::list<std::string> lru_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+constexpr size_t ParquetMetadataCache::kDefaultCapacity;
+
+ParquetMetadataCache::ParquetMetadataCache(size_t capacity)
+    : capacity_(capacity), impl_(new Impl) {}
+
+ParquetMetadataCache::~ParquetMetadataCache() {}
+
+std::shared_ptr<ParquetMetadataCache> ParquetMetadataCache::Default() {
+  static std::shared_ptr<ParquetMetadataCache> cache =
+      std::make_shared<ParquetMetadataCache>();
+  return cache;
+}
+
+std::shared_ptr<parquet::FileMetaData> ParquetMetadataCache::Get(
+    const fs::FileStats& stats) {
+  return impl_->Get(stats);
+}
+
+void ParquetMetadataCache::Put(const fs::FileStats& stats,
+                               std::shared_ptr<parquet::FileMetaData> metadata) {
+  // Without a size and a modification time, a rewritten file could not be
+  // told apart
+  if (stats.size() == fs::kNoSize || stats.mtime() == fs::kNoTime || capacity_ == 0) {
+    return;
+  }
+  impl_->Put(stats, std::move(metadata), capacity_);
+}
+
+void ParquetMetadataCache::Clear() { impl_->Clear(); }
+
+size_t ParquetMetadataCache::size() const { return impl_->size(); }
+
+// ----------------------------------------------------------------------
+// ParquetFileFormat
+
 Result<bool> ParquetFileFormat::IsSupported(const FileSource& source) const {
   try {
     ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
@@ -243,6 +352,52 @@ Result<std::shared_ptr<Schema>> ParquetFileFormat::Inspect(
   return schema;
 }
 
+Result<std::shared_ptr<Schema>> ParquetFileFormat::InspectSummary(
+    const FileSource& summary, const fs::FileStatsVector& files) const {
+  auto pool = default_memory_pool();
+  ARROW_ASSIGN_OR_RAISE(auto input, summary.Open());
+
+  std::unique_ptr<parquet::ParquetFileReader> reader;
+  try {
+    reader = parquet::ParquetFileReader::Open(input);
+
+    if (metadata_cache_ != nullptr && summary.type() == FileSource::PATH) {
+      // The row groups of a summary refer to their file by a path relative to
+      // the summary's directory
+      auto metadata = reader->metadata();
+      std::unordered_map<std::string, std::vector<int>> row_groups_by_path;
+      for (int i = 0; i < metadata->num_row_groups(); ++i) {
+        auto row_group = metadata->RowGroup(i);
+        if (row_group->num_columns() > 0) {
+          row_groups_by_path[row_group->ColumnChunk(0)->file_path()].push_back(i);
+        }
+      }
+
+      const auto base_dir = fs::internal::GetAbstractPathParent(summary.path()).first;
+      for (const auto& stats : files) {
+        auto relative = fs::internal::RemoveAncestor(base_dir, stats.path());
+        if (!stats.IsFile() || !relative.has_value()) {
+          continue;
+        }
+        auto it = row_groups_by_path.find(relative->to_string());
+        if (it != row_groups_by_path.end()) {
+          metadata_cache_->Put(stats, metadata->Subset(it->second));
+        }
+      }
+    }
+  } catch (const ::parquet::ParquetException& e) {
+    return Status::IOError("Could not read parquet summary file '", summary.path(),
+                           "': ", e.what());
+  }
+
+  std::unique_ptr<parquet::arrow::FileReader> arrow_reader;
+  RETURN_NOT_OK(parquet::arrow::FileReader::Make(pool, std::move(reader), &arrow_reader));
+
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(arrow_reader->GetSchema(&schema));
+  return schema;
+}
+
 Result<ScanTaskIterator> ParquetFileFormat::ScanFile(const FileSource& source,
                                                      ScanOptionsPtr options,
                                                      ScanContextPtr context) const {
@@ -257,9 +412,25 @@ Result<DataFragmentPtr> ParquetFileFormat::MakeFragment(const FileSource& source
 
 Result<std::unique_ptr<parquet::ParquetFileReader>> ParquetFileFormat::OpenReader(
     const FileSource& source, MemoryPool* pool) const {
+  util::optional<fs::FileStats> stats;
+  std::shared_ptr<parquet::FileMetaData> metadata;
+  if (metadata_cache_ != nullptr && source.type() == FileSource::PATH) {
+    // If the file can't be stat'ed, it is simply opened without the cache
+    auto maybe_stats = source.filesystem()->GetTargetStats(source.path());
+    if (maybe_stats.ok()) {
+      stats = std::move(maybe_stats).ValueOrDie();
+      metadata = metadata_cache_->Get(*stats);
+    }
+  }
+
   ARROW_ASSIGN_OR_RAISE(auto input, source.Open());
   try {
-    return parquet::ParquetFileReader::Open(input);
+    auto reader = parquet::ParquetFileReader::Open(
+        input, parquet::default_reader_properties(), metadata);
+    if (stats.has_value() && metadata == nullptr) {
+      metadata_cache_->Put(*stats, reader->metadata());
+    }
+    return std::move(reader);
   } catch (const ::parquet::ParquetException& e) {
     return Status::IOError("Could not open parquet input source '", source.path(),
                            "': ", e.what());
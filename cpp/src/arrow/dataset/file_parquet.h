@@ -43,9 +43,55 @@ class ARROW_DS_EXPORT ParquetWriteOptions : public FileWriteOptions {
   std::string file_type() const override { return "parquet"; }
 };
 
+/// \brief A cache of parsed Parquet footers, shared by dataset discovery and
+/// scanning so that each file's metadata is read and decoded once.
+///
+/// Entries are keyed by path and are only returned while the size and
+/// modification time of the file match those it was cached with. The least
+/// recently used entries are evicted once the capacity is exceeded.
+class ARROW_DS_EXPORT ParquetMetadataCache {
+ public:
+  static constexpr size_t kDefaultCapacity = 16384;
+
+  explicit ParquetMetadataCache(size_t capacity = kDefaultCapacity);
+  ~ParquetMetadataCache();
+
+  /// \brief The process-wide cache used by default by ParquetFileFormat
+  static std::shared_ptr<ParquetMetadataCache> Default();
+
+  /// \brief Return the cached metadata of a file, or null if there is no
+  /// entry matching its path, size and modification time.
+  std::shared_ptr<parquet::FileMetaData> Get(const fs::FileStats& stats);
+
+  /// \brief Cache the metadata of a file
+  ///
+  /// Files of unknown size or modification time are not cached.
+  void Put(const fs::FileStats& stats, std::shared_ptr<parquet::FileMetaData> metadata);
+
+  /// \brief Remove all entries
+  void Clear();
+
+  /// \brief The number of cached entries
+  size_t size() const;
+
+  size_t capacity() const { return capacity_; }
+
+ private:
+  class Impl;
+
+  size_t capacity_;
+  std::unique_ptr<Impl> impl_;
+};
+
 /// \brief A FileFormat implementation that reads from Parquet files
 class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
  public:
+  /// \param[in] metadata_cache cache of parsed footers; if null, the footer
+  /// is read again every time a file is opened
+  explicit ParquetFileFormat(std::shared_ptr<ParquetMetadataCache> metadata_cache =
+                                 ParquetMetadataCache::Default())
+      : metadata_cache_(std::move(metadata_cache)) {}
+
   std::string type_name() const override { return "parquet"; }
 
   Result<bool> IsSupported(const FileSource& source) const override;
@@ -53,6 +99,15 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   /// \brief Return the schema of the file if possible.
   Result<std::shared_ptr<Schema>> Inspect(const FileSource& source) const override;
 
+  std::string summary_file_name() const override { return "_metadata"; }
+
+  /// \brief Return the schema of the dataset from its "_metadata" file.
+  ///
+  /// The row groups of each file in `files` are also placed in the metadata
+  /// cache, so scanning these files does not read their footers.
+  Result<std::shared_ptr<Schema>> InspectSummary(
+      const FileSource& summary, const fs::FileStatsVector& files) const override;
+
   /// \brief Open a file for scanning
   Result<ScanTaskIterator> ScanFile(const FileSource& source, ScanOptionsPtr options,
                                     ScanContextPtr context) const override;
@@ -60,9 +115,15 @@ class ARROW_DS_EXPORT ParquetFileFormat : public FileFormat {
   Result<DataFragmentPtr> MakeFragment(const FileSource& source,
                                        ScanOptionsPtr options) override;
 
+  const std::shared_ptr<ParquetMetadataCache>& metadata_cache() const {
+    return metadata_cache_;
+  }
+
  private:
   Result<std::unique_ptr<::parquet::ParquetFileReader>> OpenReader(
       const FileSource& source, MemoryPool* pool) const;
+
+  std::shared_ptr<ParquetMetadataCache> metadata_cache_;
 };
 
 class ARROW_DS_EXPORT ParquetFragment : public FileDataFragment {
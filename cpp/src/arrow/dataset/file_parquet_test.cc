@@ -24,6 +24,9 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/test_util.h"
+#include "arrow/filesystem/mockfs.h"
+#include "arrow/filesystem/test_util.h"
+#include "arrow/io/memory.h"
 #include "arrow/record_batch.h"
 #include "arrow/testing/generator.h"
 #include "arrow/testing/gtest_util.h"
@@ -31,6 +34,8 @@
 #include "arrow/type.h"
 #include "arrow/type_fwd.h"
 #include "parquet/arrow/writer.h"
+#include "parquet/file_reader.h"
+#include "parquet/metadata.h"
 
 namespace arrow {
 namespace dataset {
@@ -300,6 +305,161 @@ TEST_F(TestParquetFileFormat, IsSupported) {
   EXPECT_EQ(supported, true);
 }
 
+TEST_F(TestParquetFileFormat, MetadataCacheEntries) {
+  ParquetMetadataCache cache(/*capacity=*/2);
+  auto reader = GetRecordBatchReader();
+  auto metadata =
+      parquet::ReadMetaData(std::make_shared<io::BufferReader>(Write(reader.get())));
+
+  auto a = fs::File("a");
+  a.set_size(10);
+  a.set_mtime(fs::TimePoint(fs::TimePoint::duration(1)));
+  ASSERT_EQ(cache.Get(a), nullptr);
+
+  cache.Put(a, metadata);
+  ASSERT_EQ(cache.Get(a), metadata);
+
+  // A file whose size or modification time changed is not a hit
+  fs::FileStats modified = a;
+  modified.set_mtime(fs::TimePoint(fs::TimePoint::duration(2)));
+  ASSERT_EQ(cache.Get(modified), nullptr);
+  ASSERT_EQ(cache.size(), 0);
+
+  cache.Put(a, metadata);
+  modified = a;
+  modified.set_size(11);
+  ASSERT_EQ(cache.Get(modified), nullptr);
+
+  // Files of unknown size or modification time are not cached
+  fs::FileStats unknown_size = a;
+  unknown_size.set_path("b");
+  unknown_size.set_size(fs::kNoSize);
+  cache.Put(unknown_size, metadata);
+  ASSERT_EQ(cache.size(), 0);
+  fs::FileStats unknown_mtime = a;
+  unknown_mtime.set_path("b");
+  unknown_mtime.set_mtime(fs::kNoTime);
+  cache.Put(unknown_mtime, metadata);
+  ASSERT_EQ(cache.size(), 0);
+
+  // The least recently used entry is evicted
+  fs::FileStats b = a, c = a;
+  b.set_path("b");
+  c.set_path("c");
+  cache.Put(a, metadata);
+  cache.Put(b, metadata);
+  ASSERT_EQ(cache.Get(a), metadata);
+  cache.Put(c, metadata);
+  ASSERT_EQ(cache.size(), 2);
+  ASSERT_EQ(cache.Get(b), nullptr);
+  ASSERT_EQ(cache.Get(a), metadata);
+  ASSERT_EQ(cache.Get(c), metadata);
+
+  cache.Clear();
+  ASSERT_EQ(cache.size(), 0);
+}
+
+TEST_F(TestParquetFileFormat, MetadataCache) {
+  auto reader = GetRecordBatchReader();
+  auto buffer = Write(reader.get());
+
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(1)));
+  ASSERT_OK(fs->CreateFile("a.parquet", buffer->ToString()));
+  FileSource source("a.parquet", fs.get());
+
+  auto cache = std::make_shared<ParquetMetadataCache>();
+  auto format = ParquetFileFormat(cache);
+  ASSERT_OK_AND_ASSIGN(auto actual, format.Inspect(source));
+  EXPECT_EQ(*actual, *schema_);
+
+  ASSERT_OK_AND_ASSIGN(auto stats, fs->GetTargetStats("a.parquet"));
+  auto cached = cache->Get(stats);
+  ASSERT_NE(cached, nullptr);
+  ASSERT_EQ(cached->num_rows(), kNumRows);
+
+  // Scanning reuses the cached footer
+  opts_ = ScanOptions::Make(schema_);
+  ASSERT_OK_AND_ASSIGN(auto fragment, format.MakeFragment(source, opts_));
+  ASSERT_OK_AND_ASSIGN(auto scan_task_it, fragment->Scan(ctx_));
+  int64_t row_count = 0;
+  for (auto maybe_task : scan_task_it) {
+    ASSERT_OK_AND_ASSIGN(auto task, std::move(maybe_task));
+    ASSERT_OK_AND_ASSIGN(auto rb_it, task->Execute());
+    for (auto maybe_batch : rb_it) {
+      ASSERT_OK_AND_ASSIGN(auto batch, std::move(maybe_batch));
+      row_count += batch->num_rows();
+    }
+  }
+  ASSERT_EQ(row_count, kNumRows);
+  ASSERT_EQ(cache->Get(stats), cached);
+  ASSERT_EQ(cache->size(), 1);
+
+  // Rewriting the file at the same size invalidates its entry through the
+  // modification time
+  auto rewritten_fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(2)));
+  ASSERT_OK(rewritten_fs->CreateFile("a.parquet", buffer->ToString()));
+  ASSERT_OK_AND_ASSIGN(auto rewritten_stats, rewritten_fs->GetTargetStats("a.parquet"));
+  ASSERT_EQ(rewritten_stats.size(), stats.size());
+  ASSERT_EQ(cache->Get(rewritten_stats), nullptr);
+  ASSERT_OK_AND_ASSIGN(actual,
+                       format.Inspect(FileSource("a.parquet", rewritten_fs.get())));
+  auto recached = cache->Get(rewritten_stats);
+  ASSERT_NE(recached, nullptr);
+  ASSERT_NE(recached, cached);
+
+  // Files without a modification time are not cached
+  auto no_time_fs = std::make_shared<fs::internal::MockFileSystem>(fs::kNoTime);
+  ASSERT_OK(no_time_fs->CreateFile("b.parquet", buffer->ToString()));
+  ASSERT_OK_AND_ASSIGN(actual, format.Inspect(FileSource("b.parquet", no_time_fs.get())));
+  ASSERT_EQ(cache->size(), 1);
+}
+
+TEST_F(TestParquetFileFormat, InspectSummary) {
+  auto fs = std::make_shared<fs::internal::MockFileSystem>(
+      fs::TimePoint(fs::TimePoint::duration(1)));
+  auto reader = GetRecordBatchReader();
+  auto buffer = Write(reader.get());
+  ASSERT_OK(fs->CreateFile("dir/a.parquet", buffer->ToString()));
+  ASSERT_OK(fs->CreateFile("dir/b.parquet", buffer->ToString()));
+  ASSERT_OK(fs->CreateFile("dir/c.parquet", buffer->ToString()));
+
+  // The summary holds the row groups of a.parquet and b.parquet
+  auto a_metadata = parquet::ReadMetaData(std::make_shared<io::BufferReader>(buffer));
+  auto b_metadata = parquet::ReadMetaData(std::make_shared<io::BufferReader>(buffer));
+  const int num_row_groups = a_metadata->num_row_groups();
+  a_metadata->set_file_path("a.parquet");
+  b_metadata->set_file_path("b.parquet");
+  a_metadata->AppendRowGroups(*b_metadata);
+  auto sink = CreateOutputStream();
+  ASSERT_OK(parquet::arrow::WriteMetaDataFile(*a_metadata, sink.get()));
+  ASSERT_OK_AND_ASSIGN(auto summary, sink->Finish());
+  ASSERT_OK(fs->CreateFile("dir/_metadata", summary->ToString()));
+
+  fs::FileStatsVector files;
+  for (const auto& path : {"dir/a.parquet", "dir/b.parquet", "dir/c.parquet"}) {
+    ASSERT_OK_AND_ASSIGN(auto stats, fs->GetTargetStats(path));
+    files.push_back(stats);
+  }
+
+  auto cache = std::make_shared<ParquetMetadataCache>();
+  auto format = ParquetFileFormat(cache);
+  FileSource source("dir/_metadata", fs.get());
+  ASSERT_OK_AND_ASSIGN(auto actual, format.InspectSummary(source, files));
+  EXPECT_EQ(*actual, *schema_);
+
+  // Each file listed in the summary has its own row groups cached
+  ASSERT_EQ(cache->size(), 2);
+  for (int i = 0; i < 2; ++i) {
+    auto cached = cache->Get(files[i]);
+    ASSERT_NE(cached, nullptr);
+    ASSERT_EQ(cached->num_row_groups(), num_row_groups);
+    ASSERT_EQ(cached->num_rows(), kNumRows);
+  }
+  ASSERT_EQ(cache->Get(files[2]), nullptr);
+}
+
 void CountRowsInScan(ScanTaskIterator& it, int64_t expected_rows,
                      int64_t expected_batches) {
   int64_t actual_rows = 0;
@@ -1018,13 +1018,18 @@ std::vector<std::string> FieldsInExpression(const ExpressionPtr& expr) {
   return FieldsInExpression(*expr);
 }
 
+Result<std::shared_ptr<RecordBatch>> ExpressionEvaluator::FilterBatch(
+    const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  ARROW_ASSIGN_OR_RAISE(auto selection, Evaluate(filter, *batch, pool));
+  return Filter(selection, batch, pool);
+}
+
 RecordBatchIterator ExpressionEvaluator::FilterBatches(RecordBatchIterator unfiltered,
                                                        ExpressionPtr filter,
                                                        MemoryPool* pool) {
   auto filter_batches = [filter, pool, this](std::shared_ptr<RecordBatch> unfiltered) {
-    auto filtered = Evaluate(*filter, *unfiltered, pool).Map([&](Datum selection) {
-      return Filter(selection, unfiltered, pool);
-    });
+    auto filtered = FilterBatch(*filter, unfiltered, pool);
 
     if (filtered.ok() && (*filtered)->num_rows() == 0) {
       // drop empty batches
@@ -572,6 +572,15 @@ class ARROW_DS_EXPORT ExpressionEvaluator {
     return Filter(selection, batch, default_memory_pool());
   }
 
+  /// \brief Return the rows of a RecordBatch which satisfy a filter expression.
+  ///
+  /// The default implementation Evaluates the filter then Filters the batch with
+  /// the resulting selection. Implementations which can select rows without
+  /// materializing a boolean selection should override this.
+  virtual Result<std::shared_ptr<RecordBatch>> FilterBatch(
+      const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+      MemoryPool* pool) const;
+
   /// \brief Wrap an iterator of record batches with a filter expression. The resulting
   /// iterator will yield record batches filtered by the given expression.
   ///
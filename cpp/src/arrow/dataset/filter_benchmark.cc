@@ -0,0 +1,98 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "benchmark/benchmark.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/filter_gandiva.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/testing/random.h"
+
+namespace arrow {
+namespace dataset {
+
+constexpr auto kSeed = 0x0ff1ce;
+constexpr int kMaxPredicates = 8;
+
+// A batch of kMaxPredicates float64 columns with values uniform in [0, 1)
+static std::shared_ptr<RecordBatch> MakeBatch(int64_t num_rows,
+                                              double null_proportion) {
+  auto rand = random::RandomArrayGenerator(kSeed);
+  std::vector<std::shared_ptr<Field>> fields;
+  std::vector<std::shared_ptr<Array>> columns;
+  for (int i = 0; i < kMaxPredicates; ++i) {
+    fields.push_back(field("f" + std::to_string(i), float64()));
+    columns.push_back(rand.Float64(num_rows, 0, 1, null_proportion));
+  }
+  return RecordBatch::Make(schema(std::move(fields)), num_rows, std::move(columns));
+}
+
+// A conjunction of num_predicates comparisons, each selecting about 90% of rows
+static ExpressionPtr MakeFilter(int num_predicates) {
+  ExpressionPtr filter = greater(field_ref("f0"), scalar(0.1));
+  for (int i = 1; i < num_predicates; ++i) {
+    filter = and_(filter, greater(field_ref("f" + std::to_string(i)), scalar(0.1)));
+  }
+  return filter;
+}
+
+template <typename Evaluator>
+static void FilterBatch(benchmark::State& state) {
+  const int64_t num_rows = state.range(0);
+  const int num_predicates = static_cast<int>(state.range(1));
+
+  auto batch = MakeBatch(num_rows, /*null_proportion=*/0.01);
+  auto filter = MakeFilter(num_predicates);
+  Evaluator evaluator;
+
+  for (auto _ : state) {
+    auto filtered = evaluator.FilterBatch(*filter, batch, default_memory_pool());
+    ABORT_NOT_OK(filtered.status());
+    benchmark::DoNotOptimize(filtered);
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_rows);
+}
+
+static void TreeEvaluatorFilterBatch(benchmark::State& state) {
+  FilterBatch<TreeEvaluator>(state);
+}
+
+static void GandivaEvaluatorFilterBatch(benchmark::State& state) {
+  FilterBatch<GandivaEvaluator>(state);
+}
+
+// Number of rows per batch, number of predicates in the filter
+static void SetArgs(benchmark::internal::Benchmark* bench) {
+  for (int64_t num_rows : {1 << 10, 1 << 16, 1 << 20}) {
+    for (int num_predicates = 1; num_predicates <= kMaxPredicates; num_predicates *= 2) {
+      bench->Args({num_rows, num_predicates});
+    }
+  }
+  bench->Unit(benchmark::kMicrosecond);
+}
+
+BENCHMARK(TreeEvaluatorFilterBatch)->Apply(SetArgs);
+BENCHMARK(GandivaEvaluatorFilterBatch)->Apply(SetArgs);
+
+}  // namespace dataset
+}  // namespace arrow
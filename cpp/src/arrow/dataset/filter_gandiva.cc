@@ -0,0 +1,312 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/filter_gandiva.h"
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/record_batch.h"
+#include "arrow/scalar.h"
+#include "arrow/util/checked_cast.h"
+#include "gandiva/configuration.h"
+#include "gandiva/filter.h"
+#include "gandiva/projector.h"
+#include "gandiva/selection_vector.h"
+#include "gandiva/tree_expr_builder.h"
+
+namespace arrow {
+
+using compute::Datum;
+using gandiva::NodePtr;
+using gandiva::TreeExprBuilder;
+using internal::checked_cast;
+
+namespace dataset {
+
+template <typename ScalarType>
+static NodePtr MakeLiteral(const Scalar& scalar) {
+  return TreeExprBuilder::MakeLiteral(checked_cast<const ScalarType&>(scalar).value);
+}
+
+template <typename ArrayType, typename T>
+static std::unordered_set<T> MakeSet(const Array& set) {
+  std::unordered_set<T> out;
+  const auto& values = checked_cast<const ArrayType&>(set);
+  for (int64_t i = 0; i < values.length(); ++i) {
+    out.emplace(values.GetView(i));
+  }
+  return out;
+}
+
+static Result<std::string> CastFunctionName(const DataType& to_type) {
+  switch (to_type.id()) {
+    case Type::INT32:
+      return "castINT";
+    case Type::INT64:
+      return "castBIGINT";
+    case Type::FLOAT:
+      return "castFLOAT4";
+    case Type::DOUBLE:
+      return "castFLOAT8";
+    default:
+      return Status::NotImplemented("Gandiva cast to ", to_type);
+  }
+}
+
+static const char* ComparisonFunctionName(compute::CompareOperator op) {
+  switch (op) {
+    case compute::CompareOperator::EQUAL:
+      return "equal";
+    case compute::CompareOperator::NOT_EQUAL:
+      return "not_equal";
+    case compute::CompareOperator::GREATER:
+      return "greater_than";
+    case compute::CompareOperator::GREATER_EQUAL:
+      return "greater_than_or_equal_to";
+    case compute::CompareOperator::LESS:
+      return "less_than";
+    case compute::CompareOperator::LESS_EQUAL:
+      return "less_than_or_equal_to";
+  }
+  return "";
+}
+
+/// \brief Translate a dataset Expression into a Gandiva expression tree.
+///
+/// Returns NotImplemented for expressions which have no Gandiva equivalent.
+struct GandivaTranslator {
+  Result<NodePtr> operator()(const ScalarExpression& expr) const {
+    const auto& scalar = *expr.value();
+    if (!scalar.is_valid) {
+      return TreeExprBuilder::MakeNull(scalar.type);
+    }
+
+    switch (scalar.type->id()) {
+      case Type::BOOL:
+        return MakeLiteral<BooleanScalar>(scalar);
+      case Type::UINT8:
+        return MakeLiteral<UInt8Scalar>(scalar);
+      case Type::INT8:
+        return MakeLiteral<Int8Scalar>(scalar);
+      case Type::UINT16:
+        return MakeLiteral<UInt16Scalar>(scalar);
+      case Type::INT16:
+        return MakeLiteral<Int16Scalar>(scalar);
+      case Type::UINT32:
+        return MakeLiteral<UInt32Scalar>(scalar);
+      case Type::INT32:
+        return MakeLiteral<Int32Scalar>(scalar);
+      case Type::UINT64:
+        return MakeLiteral<UInt64Scalar>(scalar);
+      case Type::INT64:
+        return MakeLiteral<Int64Scalar>(scalar);
+      case Type::FLOAT:
+        return MakeLiteral<FloatScalar>(scalar);
+      case Type::DOUBLE:
+        return MakeLiteral<DoubleScalar>(scalar);
+      case Type::STRING:
+        return TreeExprBuilder::MakeStringLiteral(
+            checked_cast<const StringScalar&>(scalar).value->ToString());
+      case Type::BINARY:
+        return TreeExprBuilder::MakeBinaryLiteral(
+            checked_cast<const BinaryScalar&>(scalar).value->ToString());
+      default:
+        return Status::NotImplemented("Gandiva literal of type ", *scalar.type);
+    }
+  }
+
+  Result<NodePtr> operator()(const FieldExpression& expr) const {
+    auto field = schema_.GetFieldByName(expr.name());
+    if (field == nullptr) {
+      // TreeEvaluator evaluates absent fields to null, whose type is unknown here
+      return Status::NotImplemented("Gandiva reference to absent field ", expr.name());
+    }
+    return TreeExprBuilder::MakeField(std::move(field));
+  }
+
+  Result<NodePtr> operator()(const NotExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    return TreeExprBuilder::MakeFunction("not", {std::move(operand)}, boolean());
+  }
+
+  Result<NodePtr> operator()(const AndExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+    return TreeExprBuilder::MakeAnd({std::move(lhs), std::move(rhs)});
+  }
+
+  Result<NodePtr> operator()(const OrExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+    return TreeExprBuilder::MakeOr({std::move(lhs), std::move(rhs)});
+  }
+
+  Result<NodePtr> operator()(const ComparisonExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto lhs, Translate(*expr.left_operand()));
+    ARROW_ASSIGN_OR_RAISE(auto rhs, Translate(*expr.right_operand()));
+    return TreeExprBuilder::MakeFunction(ComparisonFunctionName(expr.op()),
+                                         {std::move(lhs), std::move(rhs)}, boolean());
+  }
+
+  Result<NodePtr> operator()(const IsValidExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    return TreeExprBuilder::MakeFunction("isnotnull", {std::move(operand)}, boolean());
+  }
+
+  Result<NodePtr> operator()(const InExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto type, expr.operand()->Validate(schema_));
+    const auto& set = *expr.set();
+    if (set.null_count() != 0 || !set.type()->Equals(*type)) {
+      return Status::NotImplemented("Gandiva membership test in ", *set.type());
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto operand, Translate(*expr.operand()));
+    switch (type->id()) {
+      case Type::INT32:
+        return TreeExprBuilder::MakeInExpressionInt32(
+            std::move(operand), MakeSet<Int32Array, int32_t>(set));
+      case Type::INT64:
+        return TreeExprBuilder::MakeInExpressionInt64(
+            std::move(operand), MakeSet<Int64Array, int64_t>(set));
+      case Type::STRING:
+        return TreeExprBuilder::MakeInExpressionString(
+            std::move(operand), MakeSet<StringArray, std::string>(set));
+      case Type::BINARY:
+        return TreeExprBuilder::MakeInExpressionBinary(
+            std::move(operand), MakeSet<BinaryArray, std::string>(set));
+      default:
+        return Status::NotImplemented("Gandiva membership test in ", *type);
+    }
+  }
+
+  Result<NodePtr> operator()(const CastExpression& expr) const {
+    ARROW_ASSIGN_OR_RAISE(auto to_type, expr.Validate(schema_));
+
+    const auto& operand = *expr.operand();
+    if (operand.type() == ExpressionType::SCALAR) {
+      // Casts of literals (as inserted by InsertImplicitCasts) are folded
+      const auto& value = checked_cast<const ScalarExpression&>(operand).value();
+      ARROW_ASSIGN_OR_RAISE(auto cast_value, value->CastTo(to_type));
+      return (*this)(ScalarExpression(std::move(cast_value)));
+    }
+
+    ARROW_ASSIGN_OR_RAISE(auto from_type, operand.Validate(schema_));
+    ARROW_ASSIGN_OR_RAISE(auto cast_operand, Translate(operand));
+    if (from_type->Equals(*to_type)) {
+      return cast_operand;
+    }
+    ARROW_ASSIGN_OR_RAISE(auto name, CastFunctionName(*to_type));
+    return TreeExprBuilder::MakeFunction(name, {std::move(cast_operand)},
+                                         std::move(to_type));
+  }
+
+  Result<NodePtr> operator()(const Expression& expr) const {
+    return Status::NotImplemented("Gandiva translation of ", expr.ToString());
+  }
+
+  Result<NodePtr> Translate(const Expression& expr) const {
+    return VisitExpression(expr, *this);
+  }
+
+  const Schema& schema_;
+};
+
+GandivaEvaluator::GandivaEvaluator()
+    : GandivaEvaluator(gandiva::ConfigurationBuilder::DefaultConfiguration()) {}
+
+GandivaEvaluator::GandivaEvaluator(std::shared_ptr<gandiva::Configuration> configuration)
+    : configuration_(std::move(configuration)) {}
+
+Result<Datum> GandivaEvaluator::Evaluate(const Expression& expr, const RecordBatch& batch,
+                                         MemoryPool* pool) const {
+  if (expr.type() == ExpressionType::FIELD || expr.type() == ExpressionType::SCALAR) {
+    // Nothing to compile
+    return TreeEvaluator::Evaluate(expr, batch, pool);
+  }
+
+  ARROW_ASSIGN_OR_RAISE(auto type, expr.Validate(*batch.schema()));
+
+  // Gandiva caches compiled modules by schema, expressions and configuration,
+  // so only the first evaluation against a given schema compiles expr.
+  std::shared_ptr<gandiva::Projector> projector;
+  auto root = GandivaTranslator{*batch.schema()}.Translate(expr);
+  if (!root.ok() ||
+      !gandiva::Projector::Make(
+           batch.schema(),
+           {TreeExprBuilder::MakeExpression(root.ValueOrDie(), field("out", type))},
+           configuration_, &projector)
+           .ok()) {
+    // The children of expr are still evaluated with Gandiva where possible.
+    return TreeEvaluator::Evaluate(expr, batch, pool);
+  }
+
+  ArrayVector out;
+  RETURN_NOT_OK(projector->Evaluate(batch, pool, &out));
+  return Datum(std::move(out[0]));
+}
+
+Result<std::shared_ptr<RecordBatch>> GandivaEvaluator::FilterBatch(
+    const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+    MemoryPool* pool) const {
+  if (filter.type() == ExpressionType::SCALAR || batch->num_rows() == 0) {
+    return TreeEvaluator::FilterBatch(filter, batch, pool);
+  }
+
+  std::shared_ptr<gandiva::Filter> gandiva_filter;
+  auto condition = GandivaTranslator{*batch->schema()}.Translate(filter);
+  if (!condition.ok() ||
+      !gandiva::Filter::Make(batch->schema(),
+                             TreeExprBuilder::MakeCondition(condition.ValueOrDie()),
+                             configuration_, &gandiva_filter)
+           .ok()) {
+    return TreeEvaluator::FilterBatch(filter, batch, pool);
+  }
+
+  // Gandiva writes the indices of selected rows, using the narrowest index
+  // type which can address every row.
+  std::shared_ptr<gandiva::SelectionVector> selection;
+  if (batch->num_rows() <= std::numeric_limits<uint16_t>::max() + 1) {
+    RETURN_NOT_OK(
+        gandiva::SelectionVector::MakeInt16(batch->num_rows(), pool, &selection));
+  } else {
+    RETURN_NOT_OK(
+        gandiva::SelectionVector::MakeInt32(batch->num_rows(), pool, &selection));
+  }
+  RETURN_NOT_OK(gandiva_filter->Evaluate(*batch, selection));
+
+  if (selection->GetNumSlots() == batch->num_rows()) {
+    return batch;
+  }
+
+  std::shared_ptr<RecordBatch> filtered;
+  compute::FunctionContext ctx{pool};
+  RETURN_NOT_OK(compute::Take(&ctx, *batch, *selection->ToArray(),
+                              compute::TakeOptions(), &filtered));
+  return std::move(filtered);
+}
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,66 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <memory>
+
+#include "arrow/dataset/filter.h"
+#include "arrow/dataset/type_fwd.h"
+#include "arrow/dataset/visibility.h"
+
+namespace gandiva {
+
+class Configuration;
+
+}  // namespace gandiva
+
+namespace arrow {
+namespace dataset {
+
+/// \brief An ExpressionEvaluator which compiles expressions with Gandiva.
+///
+/// Each expression is translated to a Gandiva expression tree, compiled, then
+/// evaluated in a single pass over a RecordBatch instead of one kernel call per
+/// node. Compiled modules are reused through Gandiva's cache for batches of an
+/// equal schema.
+/// FilterBatch does not materialize a boolean selection: Gandiva emits the
+/// indices of matching rows, which are then gathered with Take. Rows for which
+/// the filter is null are dropped.
+///
+/// Expressions Gandiva can't express (for example references to fields absent
+/// from a batch, or operations on unsupported types) are evaluated by a
+/// TreeEvaluator instead.
+class ARROW_DS_EXPORT GandivaEvaluator : public TreeEvaluator {
+ public:
+  GandivaEvaluator();
+
+  explicit GandivaEvaluator(std::shared_ptr<gandiva::Configuration> configuration);
+
+  Result<compute::Datum> Evaluate(const Expression& expr, const RecordBatch& batch,
+                                  MemoryPool* pool) const override;
+
+  Result<std::shared_ptr<RecordBatch>> FilterBatch(
+      const Expression& filter, const std::shared_ptr<RecordBatch>& batch,
+      MemoryPool* pool) const override;
+
+ private:
+  std::shared_ptr<gandiva::Configuration> configuration_;
+};
+
+}  // namespace dataset
+}  // namespace arrow
@@ -0,0 +1,184 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/dataset/filter_gandiva.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/builder.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/take.h"
+#include "arrow/dataset/test_util.h"
+#include "arrow/record_batch.h"
+#include "arrow/testing/gtest_util.h"
+#include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
+
+namespace arrow {
+namespace dataset {
+
+// clang-format off
+using string_literals::operator"" _;
+// clang-format on
+
+using internal::checked_cast;
+
+class GandivaFilterTest : public ::testing::Test {
+ public:
+  // Evaluating expr must yield the same mask as a TreeEvaluator, and filtering
+  // with it must select exactly the rows where that mask is true.
+  void AssertFilter(const Expression& expr, std::vector<std::shared_ptr<Field>> fields,
+                    const std::string& batch_json) {
+    auto batch = RecordBatchFromJSON(schema(std::move(fields)), batch_json);
+
+    ASSERT_OK_AND_ASSIGN(auto expected_mask,
+                         tree_evaluator_.Evaluate(expr, *batch, default_memory_pool()));
+    ASSERT_OK_AND_ASSIGN(auto mask,
+                         evaluator_.Evaluate(expr, *batch, default_memory_pool()));
+    ASSERT_TRUE(mask.is_array());
+    ASSERT_ARRAYS_EQUAL(*expected_mask.make_array(), *mask.make_array());
+
+    const auto& mask_array = checked_cast<const BooleanArray&>(*mask.make_array());
+    Int32Builder indices_builder;
+    for (int32_t i = 0; i < mask_array.length(); ++i) {
+      if (mask_array.IsValid(i) && mask_array.Value(i)) {
+        ASSERT_OK(indices_builder.Append(i));
+      }
+    }
+    std::shared_ptr<Array> indices;
+    ASSERT_OK(indices_builder.Finish(&indices));
+
+    std::shared_ptr<RecordBatch> expected;
+    compute::FunctionContext ctx;
+    ASSERT_OK(compute::Take(&ctx, *batch, *indices, compute::TakeOptions(), &expected));
+
+    ASSERT_OK_AND_ASSIGN(auto filtered,
+                         evaluator_.FilterBatch(expr, batch, default_memory_pool()));
+    AssertBatchesEqual(*expected, *filtered);
+  }
+
+ protected:
+  GandivaEvaluator evaluator_;
+  TreeEvaluator tree_evaluator_;
+};
+
+TEST_F(GandivaFilterTest, Basics) {
+  AssertFilter("a"_ == 0 and "b"_ > 0.0 and "b"_ < 1.0,
+               {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b": -0.1},
+      {"a": 0, "b":  0.3},
+      {"a": 1, "b":  0.2},
+      {"a": 2, "b": -0.1},
+      {"a": 0, "b":  0.1},
+      {"a": 0, "b": null},
+      {"a": 0, "b":  1.0}
+  ])");
+
+  AssertFilter("a"_ != 0 or not("b"_ <= 0.1),
+               {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b": -0.1},
+      {"a": 0, "b":  0.3},
+      {"a": 1, "b":  0.2},
+      {"a": 2, "b": -0.1},
+      {"a": 0, "b":  0.1},
+      {"a": 0, "b": null},
+      {"a": 0, "b":  1.0}
+  ])");
+}
+
+TEST_F(GandivaFilterTest, InExpression) {
+  auto hello_world = ArrayFromJSON(utf8(), R"(["hello", "world"])");
+
+  AssertFilter("s"_.In(hello_world), {field("s", utf8())}, R"([
+      {"s": "hello"},
+      {"s": "world"},
+      {"s": ""},
+      {"s": null},
+      {"s": "foo"},
+      {"s": "hello"},
+      {"s": "bar"}
+  ])");
+}
+
+TEST_F(GandivaFilterTest, IsValidExpression) {
+  AssertFilter("s"_.IsValid(), {field("s", utf8())}, R"([
+      {"s": "hello"},
+      {"s": null},
+      {"s": ""},
+      {"s": null}
+  ])");
+}
+
+TEST_F(GandivaFilterTest, ImplicitCast) {
+  ASSERT_OK_AND_ASSIGN(auto filter,
+                       InsertImplicitCasts("a"_ >= "1", Schema({field("a", int32())})));
+
+  AssertFilter(*filter, {field("a", int32()), field("b", float64())}, R"([
+      {"a": 0, "b": -0.1},
+      {"a": 1, "b":  1.0},
+      {"a": 2, "b": -0.1},
+      {"a": null, "b": 0.1}
+  ])");
+
+  AssertFilter("a"_.CastTo(float64()) == double(1.0), {field("a", int32())}, R"([
+      {"a": 0},
+      {"a": 1},
+      {"a": null}
+  ])");
+}
+
+TEST_F(GandivaFilterTest, CachedPerSchema) {
+  // Compiled modules are only reused for batches of an equal schema
+  AssertFilter("a"_ > 0 and "b"_ > 0, {field("a", int32()), field("b", int32())}, R"([
+      {"a": 0, "b": 1},
+      {"a": 1, "b": 1},
+      {"a": 1, "b": 0}
+  ])");
+  AssertFilter("a"_ > 0 and "b"_ > 0, {field("a", int32()), field("b", int32())}, R"([
+      {"a": 1, "b": 1},
+      {"a": 2, "b": null}
+  ])");
+  AssertFilter("a"_ > 0 and "b"_ > 0, {field("b", int32()), field("a", int32())}, R"([
+      {"b": 0, "a": 1},
+      {"b": 1, "a": 1},
+      {"b": 1, "a": 0}
+  ])");
+
+  // Expressions Gandiva can't compile keep falling back
+  AssertFilter("a"_ == 0 and "absent"_ == 0, {field("a", int32())}, R"([{"a": 0}])");
+  AssertFilter("a"_ == 0 and "absent"_ == 0,
+               {field("a", int32()), field("absent", int32())}, R"([
+      {"a": 0, "absent": 0},
+      {"a": 0, "absent": 1}
+  ])");
+}
+
+TEST_F(GandivaFilterTest, FallbackToTreeEvaluator) {
+  // Gandiva can't reference absent columns
+  AssertFilter("a"_ == 0 and "absent"_ == 0, {field("a", int32())}, R"([
+      {"a": 0},
+      {"a": 1},
+      {"a": null}
+  ])");
+}
+
+}  // namespace dataset
+}  // namespace arrow
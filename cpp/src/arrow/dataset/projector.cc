@@ -23,21 +23,40 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/compute/context.h"
+#include "arrow/compute/kernels/cast.h"
 #include "arrow/dataset/type_fwd.h"
 #include "arrow/record_batch.h"
 #include "arrow/result.h"
 #include "arrow/scalar.h"
 #include "arrow/status.h"
 #include "arrow/type.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/logging.h"
 
 namespace arrow {
 namespace dataset {
 
+using internal::checked_cast;
+
+// Whether every value of integer type `from` can be represented by `to`
+static bool IsIntegerWidening(const DataType& from, const DataType& to) {
+  if (!is_integer(from.id()) || !is_integer(to.id())) {
+    return false;
+  }
+  const auto& from_int = checked_cast<const IntegerType&>(from);
+  const auto& to_int = checked_cast<const IntegerType&>(to);
+  if (from_int.is_signed() == to_int.is_signed()) {
+    return to_int.bit_width() >= from_int.bit_width();
+  }
+  return to_int.is_signed() && to_int.bit_width() > from_int.bit_width();
+}
+
 RecordBatchProjector::RecordBatchProjector(std::shared_ptr<Schema> to)
     : to_(std::move(to)),
       missing_columns_(to_->num_fields(), nullptr),
       column_indices_(to_->num_fields(), kNoMatch),
+      column_casts_(to_->num_fields(), false),
       scalars_(to_->num_fields(), nullptr) {}
 
 Status RecordBatchProjector::SetDefaultValue(int index, std::shared_ptr<Scalar> scalar) {
@@ -69,6 +88,11 @@ Result<std::shared_ptr<RecordBatch>> RecordBatchProjector::Project(
   for (int i = 0; i < to_->num_fields(); ++i) {
     if (column_indices_[i] != kNoMatch) {
       columns[i] = batch.column(column_indices_[i]);
+      if (column_casts_[i]) {
+        compute::FunctionContext ctx(pool);
+        RETURN_NOT_OK(compute::Cast(&ctx, *columns[i], to_->field(i)->type(),
+                                    compute::CastOptions::Safe(), &columns[i]));
+      }
     } else {
       columns[i] = missing_columns_[i]->Slice(0, batch.num_rows());
     }
@@ -86,11 +110,16 @@ Status RecordBatchProjector::SetInputSchema(std::shared_ptr<Schema> from,
     int matching_index = from_->GetFieldIndex(field->name());
 
     if (matching_index != kNoMatch) {
-      if (!from_->field(matching_index)->Equals(field)) {
+      // The input field may be non-nullable or have a narrower integer type,
+      // as when the projected schema was unified from several fragments'.
+      const auto& from_field = from_->field(matching_index);
+      const bool same_type = from_field->type()->Equals(field->type());
+      if ((!same_type && !IsIntegerWidening(*from_field->type(), *field->type())) ||
+          (from_field->nullable() && !field->nullable())) {
         return Status::TypeError("fields had matching names but were not equivalent ",
-                                 from_->field(matching_index)->ToString(), " vs ",
-                                 field->ToString());
+                                 from_field->ToString(), " vs ", field->ToString());
       }
+      column_casts_[i] = !same_type;
 
       // Mark column i as not missing by setting missing_columns_[i] to nullptr
       missing_columns_[i] = nullptr;
@@ -35,6 +35,11 @@ namespace dataset {
 /// otherwise the given schema will be satisfied by augmenting with null or constant
 /// columns.
 ///
+/// Columns present in both schemas must have the same type, or an integer type
+/// which the given schema's type widens (for example int32 to int64), and may
+/// be non-nullable in the record batch even if the given schema's field is
+/// nullable. Widened columns are cast when projected.
+///
 /// RecordBatchProjector is most efficient when projecting record batches with a
 /// consistent schema (for example batches from a table), but it can project record
 /// batches having any schema.
@@ -65,6 +70,7 @@ class ARROW_DS_EXPORT RecordBatchProjector {
   int64_t missing_columns_length_ = 0;
   std::vector<std::shared_ptr<Array>> missing_columns_;
   std::vector<int> column_indices_;
+  std::vector<bool> column_casts_;
   std::vector<std::shared_ptr<Scalar>> scalars_;
 };
 
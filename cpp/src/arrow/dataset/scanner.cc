@@ -18,6 +18,8 @@
 #include "arrow/dataset/scanner.h"
 
 #include <algorithm>
+#include <condition_variable>
+#include <deque>
 #include <memory>
 #include <mutex>
 
@@ -25,6 +27,7 @@
 #include "arrow/dataset/dataset_internal.h"
 #include "arrow/dataset/filter.h"
 #include "arrow/dataset/scanner_internal.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/task_group.h"
@@ -41,6 +44,9 @@ ScanOptions::ScanOptions(std::shared_ptr<Schema> schema)
 ScanOptionsPtr ScanOptions::ReplaceSchema(std::shared_ptr<Schema> schema) const {
   auto copy = ScanOptions::Make(std::move(schema));
   copy->use_threads = use_threads;
+  copy->scan_task_readahead = scan_task_readahead;
+  copy->batch_readahead = batch_readahead;
+  copy->preserve_order = preserve_order;
   copy->filter = filter;
   copy->evaluator = evaluator;
   return copy;
@@ -129,6 +135,29 @@ Status ScannerBuilder::UseThreads(bool use_threads) {
   return Status::OK();
 }
 
+Status ScannerBuilder::Readahead(int scan_task_readahead, int batch_readahead) {
+  if (scan_task_readahead <= 0 || batch_readahead <= 0) {
+    return Status::Invalid("Readahead must be positive, got ", scan_task_readahead,
+                           " scan tasks and ", batch_readahead, " batches");
+  }
+  options_->scan_task_readahead = scan_task_readahead;
+  options_->batch_readahead = batch_readahead;
+  return Status::OK();
+}
+
+Status ScannerBuilder::PreserveOrder(bool preserve_order) {
+  options_->preserve_order = preserve_order;
+  return Status::OK();
+}
+
+Status ScannerBuilder::Evaluator(std::shared_ptr<ExpressionEvaluator> evaluator) {
+  if (evaluator == nullptr) {
+    return Status::Invalid("ExpressionEvaluator must not be null");
+  }
+  evaluator_ = std::move(evaluator);
+  return Status::OK();
+}
+
 Result<ScannerPtr> ScannerBuilder::Finish() const {
   ScanOptionsPtr options;
   if (has_projection_ && !project_columns_.empty()) {
@@ -138,7 +167,8 @@ Result<ScannerPtr> ScannerBuilder::Finish() const {
   }
 
   if (!options->filter->Equals(true)) {
-    options->evaluator = std::make_shared<TreeEvaluator>();
+    options->evaluator =
+        evaluator_ != nullptr ? evaluator_ : std::make_shared<TreeEvaluator>();
   }
 
   return std::make_shared<Scanner>(dataset_->sources(), std::move(options), context_);
@@ -198,5 +228,209 @@ Result<std::shared_ptr<Table>> Scanner::ToTable() {
   return aggregator.Finish(options_->schema());
 }
 
+namespace {
+
+/// \brief Yields the RecordBatches of each scan task in turn, executing them
+/// on the consumer's thread.
+class SerialScanReader : public RecordBatchReader {
+ public:
+  SerialScanReader(std::shared_ptr<Schema> schema, ScanTaskIterator scan_tasks)
+      : schema_(std::move(schema)),
+        batches_(MakeFlattenIterator(MakeMaybeMapIterator(
+            [](ScanTaskPtr task) { return task->Execute(); }, std::move(scan_tasks)))) {}
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    return batches_.Next().Value(batch);
+  }
+
+ private:
+  std::shared_ptr<Schema> schema_;
+  RecordBatchIterator batches_;
+};
+
+/// \brief Yields the RecordBatches of scan tasks executed on a ThreadPool.
+///
+/// Each executing scan task is advanced by one RecordBatch per job submitted
+/// to the ThreadPool, and a new job is only submitted while fewer than
+/// batch_readahead of its RecordBatches are buffered. Workers never block
+/// waiting for the consumer.
+class ThreadedScanReader : public RecordBatchReader {
+ public:
+  ThreadedScanReader(std::shared_ptr<Schema> schema, ScanTaskIterator scan_tasks,
+                     internal::ThreadPool* thread_pool, const ScanOptions& options)
+      : schema_(std::move(schema)),
+        scan_tasks_(std::move(scan_tasks)),
+        state_(std::make_shared<State>(thread_pool, options)) {}
+
+  ~ThreadedScanReader() override {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+    state_->aborted = true;
+    // Scan tasks may reference resources which don't outlive this reader
+    state_->cv.wait(lock, [this] { return state_->num_running == 0; });
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    std::unique_lock<std::mutex> lock(state_->mutex);
+
+    while (true) {
+      RETURN_NOT_OK(state_->status);
+      RETURN_NOT_OK(StartTasks(&lock));
+
+      if (state_->tasks.empty()) {
+        *batch = nullptr;
+        return Status::OK();
+      }
+
+      bool removed_task = false;
+      for (auto it = state_->tasks.begin(); it != state_->tasks.end();) {
+        const auto& task = *it;
+        if (!task->batches.empty()) {
+          *batch = std::move(task->batches.front());
+          task->batches.pop_front();
+          state_->Advance(task);
+          return Status::OK();
+        }
+
+        if (task->finished) {
+          it = state_->tasks.erase(it);
+          removed_task = true;
+          continue;
+        }
+
+        if (state_->preserve_order) {
+          // The first task's batches must be yielded before any other's
+          break;
+        }
+        ++it;
+      }
+
+      if (!removed_task) {
+        state_->cv.wait(lock);
+      }
+    }
+  }
+
+ private:
+  struct Task {
+    explicit Task(ScanTaskPtr scan_task) : scan_task(std::move(scan_task)) {}
+
+    ScanTaskPtr scan_task;
+    // Only accessed by the job advancing this task
+    RecordBatchIterator batches_it;
+
+    // Guarded by State::mutex
+    std::deque<std::shared_ptr<RecordBatch>> batches;
+    bool running = false;
+    bool finished = false;
+  };
+  using TaskPtr = std::shared_ptr<Task>;
+
+  struct State : std::enable_shared_from_this<State> {
+    State(internal::ThreadPool* thread_pool, const ScanOptions& options)
+        : thread_pool(thread_pool),
+          scan_task_readahead(std::max(options.scan_task_readahead, 1)),
+          batch_readahead(static_cast<size_t>(std::max(options.batch_readahead, 1))),
+          preserve_order(options.preserve_order) {}
+
+    // Submit a job reading the next RecordBatch of task, if there is room for
+    // it. Must be called with mutex locked.
+    void Advance(const TaskPtr& task) {
+      if (aborted || task->running || task->finished ||
+          task->batches.size() >= batch_readahead) {
+        return;
+      }
+
+      auto self = shared_from_this();
+      auto st = thread_pool->Spawn([self, task] { self->Run(task); });
+      if (!st.ok()) {
+        status = st;
+        aborted = true;
+        return;
+      }
+      task->running = true;
+      ++num_running;
+    }
+
+    void Run(const TaskPtr& task) {
+      auto maybe_batch = [&]() -> Result<std::shared_ptr<RecordBatch>> {
+        if (!task->batches_it) {
+          ARROW_ASSIGN_OR_RAISE(task->batches_it, task->scan_task->Execute());
+        }
+        return task->batches_it.Next();
+      }();
+
+      std::lock_guard<std::mutex> lock(mutex);
+      task->running = false;
+      --num_running;
+
+      if (!maybe_batch.ok()) {
+        if (status.ok()) {
+          status = maybe_batch.status();
+        }
+        aborted = true;
+      } else if (*maybe_batch == nullptr) {
+        task->finished = true;
+      } else {
+        task->batches.push_back(std::move(maybe_batch).ValueOrDie());
+        Advance(task);
+      }
+      cv.notify_all();
+    }
+
+    internal::ThreadPool* thread_pool;
+    const int scan_task_readahead;
+    const size_t batch_readahead;
+    const bool preserve_order;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<TaskPtr> tasks;
+    int num_running = 0;
+    bool aborted = false;
+    Status status;
+  };
+
+  // Start scan tasks until scan_task_readahead are executing. The lock is
+  // released while pulling from scan_tasks_, which may perform IO.
+  Status StartTasks(std::unique_lock<std::mutex>* lock) {
+    while (!scan_tasks_done_ &&
+           static_cast<int>(state_->tasks.size()) < state_->scan_task_readahead) {
+      lock->unlock();
+      auto maybe_scan_task = scan_tasks_.Next();
+      lock->lock();
+
+      ARROW_ASSIGN_OR_RAISE(auto scan_task, std::move(maybe_scan_task));
+      if (scan_task == nullptr) {
+        scan_tasks_done_ = true;
+        break;
+      }
+
+      state_->tasks.push_back(std::make_shared<Task>(std::move(scan_task)));
+      state_->Advance(state_->tasks.back());
+    }
+    return state_->status;
+  }
+
+  std::shared_ptr<Schema> schema_;
+  ScanTaskIterator scan_tasks_;
+  bool scan_tasks_done_ = false;
+  std::shared_ptr<State> state_;
+};
+
+}  // namespace
+
+Result<std::shared_ptr<RecordBatchReader>> Scanner::ToRecordBatchReader() {
+  ARROW_ASSIGN_OR_RAISE(auto scan_tasks, Scan());
+  if (!options_->use_threads) {
+    return std::make_shared<SerialScanReader>(options_->schema(), std::move(scan_tasks));
+  }
+  return std::make_shared<ThreadedScanReader>(options_->schema(), std::move(scan_tasks),
+                                              context_->thread_pool, *options_);
+}
+
 }  // namespace dataset
 }  // namespace arrow
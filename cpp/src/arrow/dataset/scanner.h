@@ -32,6 +32,7 @@
 
 namespace arrow {
 
+class RecordBatchReader;
 class Table;
 
 namespace internal {
@@ -61,6 +62,19 @@ class ARROW_DS_EXPORT ScanOptions {
   // ScanContext.
   bool use_threads = false;
 
+  // When streaming a threaded scan with Scanner::ToRecordBatchReader, the
+  // maximum number of scan tasks executing at once.
+  int scan_task_readahead = 4;
+
+  // When streaming a threaded scan with Scanner::ToRecordBatchReader, the
+  // maximum number of record batches read ahead by each executing scan task.
+  int batch_readahead = 4;
+
+  // When streaming a threaded scan with Scanner::ToRecordBatchReader, whether
+  // record batches are yielded in the order of their scan tasks. If false,
+  // they are yielded as soon as they are produced.
+  bool preserve_order = true;
+
   // Filter
   ExpressionPtr filter;
 
@@ -145,6 +159,16 @@ class ARROW_DS_EXPORT Scanner {
   /// Scan result in memory before creating the Table.
   Result<std::shared_ptr<Table>> ToTable();
 
+  /// \brief Convert a Scanner into a stream of RecordBatches.
+  ///
+  /// Unlike ToTable, the scan is not materialized: scan tasks are executed as
+  /// the stream is consumed. If ScanOptions::use_threads is set, up to
+  /// ScanOptions::scan_task_readahead scan tasks execute at once on the
+  /// ScanContext's ThreadPool, each reading up to
+  /// ScanOptions::batch_readahead RecordBatches ahead of the consumer, so
+  /// memory usage is bounded regardless of the size of the dataset.
+  Result<std::shared_ptr<RecordBatchReader>> ToRecordBatchReader();
+
   std::shared_ptr<Schema> schema() const { return options_->schema(); }
 
  protected:
@@ -193,6 +217,26 @@ class ARROW_DS_EXPORT ScannerBuilder {
   ///        ThreadPool found in ScanContext;
   Status UseThreads(bool use_threads = true);
 
+  /// \brief Set how far ahead of the consumer Scanner::ToRecordBatchReader
+  /// reads when using threads.
+  ///
+  /// \param[in] scan_task_readahead maximum number of scan tasks executing at
+  ///            once
+  /// \param[in] batch_readahead maximum number of RecordBatches buffered per
+  ///            executing scan task
+  ///
+  /// \return Failure if either is not positive.
+  Status Readahead(int scan_task_readahead, int batch_readahead);
+
+  /// \brief Indicate if Scanner::ToRecordBatchReader should yield
+  ///        RecordBatches in the order of their scan tasks when using threads.
+  Status PreserveOrder(bool preserve_order = true);
+
+  /// \brief Set the ExpressionEvaluator used to filter rows.
+  ///
+  /// By default a TreeEvaluator is used if a filter expression was set.
+  Status Evaluator(std::shared_ptr<ExpressionEvaluator> evaluator);
+
   /// \brief Return the constructed now-immutable Scanner object
   Result<ScannerPtr> Finish() const;
 
@@ -202,6 +246,7 @@ class ARROW_DS_EXPORT ScannerBuilder {
   DatasetPtr dataset_;
   ScanOptionsPtr options_;
   ScanContextPtr context_;
+  std::shared_ptr<ExpressionEvaluator> evaluator_;
   bool has_projection_ = false;
   std::vector<std::string> project_columns_;
 };
@@ -33,9 +33,7 @@ static inline RecordBatchIterator FilterRecordBatch(RecordBatchIterator it,
                                                     MemoryPool* pool) {
   return MakeMaybeMapIterator(
       [&filter, &evaluator, pool](std::shared_ptr<RecordBatch> in) {
-        return evaluator.Evaluate(filter, *in, pool).Map([&](compute::Datum selection) {
-          return evaluator.Filter(selection, in);
-        });
+        return evaluator.FilterBatch(filter, in, pool);
       },
       std::move(it));
 }
@@ -16,7 +16,10 @@
 // under the License.
 
 #include "arrow/dataset/scanner.h"
+
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "arrow/compute/context.h"
 #include "arrow/dataset/test_util.h"
@@ -25,6 +28,9 @@
 #include "arrow/testing/util.h"
 
 namespace arrow {
+
+using internal::checked_cast;
+
 namespace dataset {
 
 class TestScanner : public DatasetFixtureMixin {
@@ -140,6 +146,72 @@ TEST_F(TestScanner, ToTable) {
   AssertTablesEqual(*expected, *actual);
 }
 
+TEST_F(TestScanner, ToRecordBatchReader) {
+  SetSchema({field("i32", int32())});
+
+  // Each batch holds a distinct value so that ordering can be checked
+  int32_t value = 0;
+  std::vector<std::shared_ptr<RecordBatch>> expected;
+  DataFragmentVector fragments;
+  for (int64_t i = 0; i < kNumberFragments; ++i) {
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    for (int64_t j = 0; j < kNumberBatches; ++j, ++value) {
+      auto append = [&](Int32Builder* b) { b->UnsafeAppend(value); };
+      ASSERT_OK_AND_ASSIGN(auto i32,
+                           ArrayFromBuilderVisitor(int32(), kBatchSize, append));
+      batches.push_back(RecordBatch::Make(schema_, kBatchSize, {i32}));
+    }
+    expected.insert(expected.end(), batches.begin(), batches.end());
+    fragments.push_back(std::make_shared<SimpleDataFragment>(batches, options_));
+  }
+  Scanner scanner({std::make_shared<SimpleDataSource>(fragments)}, options_, ctx_);
+
+  auto AssertReadsExpected = [&](bool ordered) {
+    ASSERT_OK_AND_ASSIGN(auto reader, scanner.ToRecordBatchReader());
+    AssertSchemaEqual(*schema_, *reader->schema());
+
+    std::vector<std::shared_ptr<RecordBatch>> actual;
+    ASSERT_OK(reader->ReadAll(&actual));
+    ASSERT_EQ(actual.size(), expected.size());
+
+    if (!ordered) {
+      auto first_value = [](const std::shared_ptr<RecordBatch>& batch) {
+        return checked_cast<const Int32Array&>(*batch->column(0)).Value(0);
+      };
+      std::sort(actual.begin(), actual.end(),
+                [&](const std::shared_ptr<RecordBatch>& l,
+                    const std::shared_ptr<RecordBatch>& r) {
+                  return first_value(l) < first_value(r);
+                });
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+      AssertBatchesEqual(*expected[i], *actual[i]);
+    }
+  };
+
+  options_->use_threads = false;
+  AssertReadsExpected(/*ordered=*/true);
+
+  options_->use_threads = true;
+  for (int readahead : {1, 2, 16}) {
+    options_->scan_task_readahead = readahead;
+    options_->batch_readahead = readahead;
+
+    options_->preserve_order = true;
+    AssertReadsExpected(/*ordered=*/true);
+
+    options_->preserve_order = false;
+    AssertReadsExpected(/*ordered=*/false);
+  }
+
+  // A reader may be destroyed before being exhausted
+  ASSERT_OK_AND_ASSIGN(auto reader, scanner.ToRecordBatchReader());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(batch, nullptr);
+  reader.reset();
+}
+
 class TestScannerBuilder : public ::testing::Test {
   void SetUp() {
     DataSourceVector sources;
@@ -174,6 +246,17 @@ TEST_F(TestScannerBuilder, TestProject) {
   ASSERT_RAISES(Invalid, builder.Project({"i8", "not_found_column"}));
 }
 
+TEST_F(TestScannerBuilder, TestReadahead) {
+  ScannerBuilder builder(dataset_, ctx_);
+
+  ASSERT_OK(builder.Readahead(2, 8));
+  ASSERT_OK(builder.PreserveOrder(false));
+  ASSERT_OK_AND_ASSIGN(auto scanner, builder.Finish());
+
+  ASSERT_RAISES(Invalid, builder.Readahead(0, 8));
+  ASSERT_RAISES(Invalid, builder.Readahead(2, -1));
+}
+
 TEST_F(TestScannerBuilder, TestFilter) {
   ScannerBuilder builder(dataset_, ctx_);
 
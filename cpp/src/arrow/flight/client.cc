@@ -20,11 +20,17 @@
 // Platform-specific defines
 #include "arrow/flight/platform.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 #ifdef GRPCPP_PP_INCLUDE
@@ -34,6 +40,7 @@
 #endif
 
 #include "arrow/buffer.h"
+#include "arrow/ipc/dictionary.h"
 #include "arrow/ipc/reader.h"
 #include "arrow/ipc/writer.h"
 #include "arrow/memory_pool.h"
@@ -49,6 +56,7 @@
 #include "arrow/flight/middleware.h"
 #include "arrow/flight/middleware_internal.h"
 #include "arrow/flight/serialization_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 namespace pb = arrow::flight::protocol;
@@ -61,6 +69,9 @@ namespace flight {
 
 FlightCallOptions::FlightCallOptions() : timeout(-1) {}
 
+FlightParallelReadOptions::FlightParallelReadOptions()
+    : max_concurrency(4), max_buffered_batches(16), ordered(true) {}
+
 struct ClientRpc {
   grpc::ClientContext context;
 
@@ -179,6 +190,8 @@ class GrpcClientInterceptorAdapterFactory
       flight_method = FlightMethod::DoAction;
     } else if (method.ends_with("/ListActions")) {
       flight_method = FlightMethod::ListActions;
+    } else if (method.ends_with("/DoExchange")) {
+      flight_method = FlightMethod::DoExchange;
     } else {
       DCHECK(false) << "Unknown Flight method: " << info->method();
     }
@@ -242,6 +255,57 @@ class GrpcClientAuthReader : public ClientAuthReader {
       stream_;
 };
 
+// Read and discard one response from a gRPC stream
+bool DiscardResponse(grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>* stream) {
+  pb::PutResult message;
+  return stream->Read(&message);
+}
+
+template <typename Stream>
+bool DiscardResponse(Stream* stream) {
+  internal::FlightData data;
+  return internal::ReadPayload(stream, &data);
+}
+
+// A gRPC stream along with its RPC context. The call must be finished
+// exactly once, after all responses were read: for DoPut and DoExchange, the
+// stream is shared by the reader and writer handed to the user, and either
+// may finish the call.
+template <typename Stream>
+class FinishableStream {
+ public:
+  FinishableStream(std::shared_ptr<ClientRpc> rpc, std::shared_ptr<Stream> stream)
+      : rpc_(std::move(rpc)), stream_(std::move(stream)) {}
+
+  const std::shared_ptr<ClientRpc>& rpc() const { return rpc_; }
+  Stream* stream() const { return stream_.get(); }
+
+  // gRPC doesn't allow concurrent reads, this must be held while reading
+  std::mutex& read_mutex() { return read_mutex_; }
+
+  bool finished() const { return finished_; }
+
+  // Discard any unread response and get the final status of the call.
+  // The read mutex must be held.
+  Status Finish() {
+    if (!finished_) {
+      while (DiscardResponse(stream_.get())) {
+      }
+      status_ = internal::FromGrpcStatus(stream_->Finish());
+      finished_ = true;
+    }
+    return status_;
+  }
+
+ private:
+  // The RPC context lifetime must be coupled to the stream
+  std::shared_ptr<ClientRpc> rpc_;
+  std::shared_ptr<Stream> stream_;
+  std::mutex read_mutex_;
+  std::atomic<bool> finished_{false};
+  Status status_;
+};
+
 // The next two classes are intertwined. To get the application
 // metadata while avoiding reimplementing RecordBatchStreamReader, we
 // create an ipc::MessageReader that is tied to the
@@ -251,33 +315,49 @@ class GrpcClientAuthReader : public ClientAuthReader {
 // additional method to get both the record batch and application
 // metadata.
 
+template <typename Stream>
 class GrpcIpcMessageReader;
+
 class GrpcStreamReader : public FlightStreamReader {
  public:
-  GrpcStreamReader();
-
-  static Status Open(std::unique_ptr<ClientRpc> rpc,
-                     std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
+  // Unless eager, the schema is only read from the stream when first needed,
+  // as the server of a DoExchange call may wait for data before answering.
+  template <typename Stream>
+  static Status Open(std::shared_ptr<FinishableStream<Stream>> stream, bool eager,
                      std::unique_ptr<GrpcStreamReader>* out);
   std::shared_ptr<Schema> schema() const override;
   Status Next(FlightStreamChunk* out) override;
   void Cancel() override;
 
  private:
+  template <typename Stream>
   friend class GrpcIpcMessageReader;
-  std::unique_ptr<ipc::RecordBatchReader> batch_reader_;
+
+  Status EnsureOpen() const;
+
+  // Opening reads from the stream, hence these are mutable for schema()
+  mutable std::unique_ptr<ipc::MessageReader> message_reader_;
+  mutable std::unique_ptr<ipc::RecordBatchReader> batch_reader_;
+  mutable Status open_status_;
   std::shared_ptr<Buffer> last_app_metadata_;
   std::shared_ptr<ClientRpc> rpc_;
 };
 
+template <typename Stream>
 class GrpcIpcMessageReader : public ipc::MessageReader {
  public:
-  GrpcIpcMessageReader(GrpcStreamReader* reader, std::shared_ptr<ClientRpc> rpc,
-                       std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream)
-      : flight_reader_(reader),
-        rpc_(rpc),
-        stream_(std::move(stream)),
-        stream_finished_(false) {}
+  GrpcIpcMessageReader(GrpcStreamReader* reader,
+                       std::shared_ptr<FinishableStream<Stream>> stream)
+      : flight_reader_(reader), stream_(std::move(stream)), stream_finished_(false) {}
+
+  ~GrpcIpcMessageReader() override {
+    if (!shared_memory_token_.empty()) {
+      // Messages were left unread: stop the server, which deletes the
+      // remaining files if it is still writing them
+      stream_->rpc()->context.TryCancel();
+      internal::FinishSharedMemoryCall(shared_memory_token_);
+    }
+  }
 
   Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
     if (stream_finished_) {
@@ -285,16 +365,22 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
       flight_reader_->last_app_metadata_ = nullptr;
       return Status::OK();
     }
+    std::lock_guard<std::mutex> guard(stream_->read_mutex());
     internal::FlightData data;
-    if (!internal::ReadPayload(stream_.get(), &data)) {
+    if (stream_->finished() || !internal::ReadPayload(stream_->stream(), &data)) {
       // Stream is completed
       stream_finished_ = true;
       *out = nullptr;
       flight_reader_->last_app_metadata_ = nullptr;
-      return OverrideWithServerError(Status::OK());
+      auto st = OverrideWithServerError(Status::OK());
+      FinishSharedMemory();
+      return st;
     }
     // Validate IPC message
-    auto st = data.OpenMessage(out);
+    auto st = ImportSharedMemoryBody(&data);
+    if (st.ok()) {
+      st = data.OpenMessage(out);
+    }
     if (!st.ok()) {
       flight_reader_->last_app_metadata_ = nullptr;
       return OverrideWithServerError(std::move(st));
@@ -304,39 +390,80 @@ class GrpcIpcMessageReader : public ipc::MessageReader {
   }
 
  protected:
+  // If the server accepted to send message bodies through shared memory,
+  // replace the body with the contents of the shared memory file
+  Status ImportSharedMemoryBody(internal::FlightData* data) {
+    CheckSharedMemory();
+    if (shared_memory_token_.empty() || !data->body || data->body->size() == 0) {
+      return Status::OK();
+    }
+    return internal::ImportBodyFromSharedMemory(shared_memory_token_, *data->body,
+                                                &data->body);
+  }
+
+  // The server initial metadata is received along with the first message, or
+  // when the call is finished
+  void CheckSharedMemory() {
+    if (!shared_memory_checked_) {
+      const auto& metadata = stream_->rpc()->context.GetServerInitialMetadata();
+      const auto token = metadata.find(internal::kSharedMemoryHeader);
+      if (token != metadata.end()) {
+        shared_memory_token_.assign(token->second.data(), token->second.length());
+      }
+      shared_memory_checked_ = true;
+    }
+  }
+
+  // Once the call is finished, the server is done with the files too: this
+  // deletes those of any message the server wrote but was not read
+  void FinishSharedMemory() {
+    CheckSharedMemory();
+    internal::FinishSharedMemoryCall(shared_memory_token_);
+    shared_memory_token_.clear();
+  }
+
   Status OverrideWithServerError(Status&& st) {
     // Get the gRPC status if not OK, to propagate any server error message
-    RETURN_NOT_OK(internal::FromGrpcStatus(stream_->Finish()));
+    RETURN_NOT_OK(stream_->Finish());
     return std::move(st);
   }
 
  private:
   GrpcStreamReader* flight_reader_;
-  // The RPC context lifetime must be coupled to the ClientReader
-  std::shared_ptr<ClientRpc> rpc_;
-  std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream_;
+  std::shared_ptr<FinishableStream<Stream>> stream_;
   bool stream_finished_;
+  bool shared_memory_checked_ = false;
+  std::string shared_memory_token_;
 };
 
-GrpcStreamReader::GrpcStreamReader() {}
-
-Status GrpcStreamReader::Open(std::unique_ptr<ClientRpc> rpc,
-                              std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream,
-                              std::unique_ptr<GrpcStreamReader>* out) {
+template <typename Stream>
+Status GrpcStreamReader::Open(std::shared_ptr<FinishableStream<Stream>> stream,
+                              bool eager, std::unique_ptr<GrpcStreamReader>* out) {
   *out = std::unique_ptr<GrpcStreamReader>(new GrpcStreamReader);
-  out->get()->rpc_ = std::move(rpc);
-  std::unique_ptr<GrpcIpcMessageReader> message_reader(
-      new GrpcIpcMessageReader(out->get(), out->get()->rpc_, std::move(stream)));
-  return ipc::RecordBatchStreamReader::Open(std::move(message_reader),
-                                            &(*out)->batch_reader_);
+  out->get()->rpc_ = stream->rpc();
+  out->get()->message_reader_.reset(
+      new GrpcIpcMessageReader<Stream>(out->get(), std::move(stream)));
+  return eager ? (*out)->EnsureOpen() : Status::OK();
+}
+
+Status GrpcStreamReader::EnsureOpen() const {
+  if (message_reader_) {
+    open_status_ =
+        ipc::RecordBatchStreamReader::Open(std::move(message_reader_), &batch_reader_);
+  }
+  return open_status_;
 }
 
 std::shared_ptr<Schema> GrpcStreamReader::schema() const {
+  if (!EnsureOpen().ok()) {
+    return nullptr;
+  }
   return batch_reader_->schema();
 }
 
 Status GrpcStreamReader::Next(FlightStreamChunk* out) {
   out->app_metadata = nullptr;
+  RETURN_NOT_OK(EnsureOpen());
   RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
   out->app_metadata = std::move(last_app_metadata_);
   return Status::OK();
@@ -346,26 +473,31 @@ void GrpcStreamReader::Cancel() { rpc_->context.TryCancel(); }
 
 // Similarly, the next two classes are intertwined. In order to get
 // application-specific metadata to the IpcPayloadWriter,
-// DoPutPayloadWriter takes a pointer to
+// GrpcPayloadWriter takes a pointer to
 // GrpcStreamWriter. GrpcStreamWriter updates a metadata field on
-// write; DoPutPayloadWriter reads that metadata field to determine
+// write; GrpcPayloadWriter reads that metadata field to determine
 // what to write.
+//
+// Both are templated on the type of server responses, which are PutResult
+// messages for DoPut and FlightData messages for DoExchange.
+
+template <typename ProtoReadT>
+class GrpcPayloadWriter;
 
-class DoPutPayloadWriter;
+template <typename ProtoReadT>
 class GrpcStreamWriter : public FlightStreamWriter {
  public:
+  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
+
   ~GrpcStreamWriter() override = default;
 
-  explicit GrpcStreamWriter(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer)
-      : app_metadata_(nullptr), batch_writer_(nullptr), writer_(writer) {}
+  explicit GrpcStreamWriter(std::shared_ptr<FinishableStream<GrpcStream>> stream)
+      : app_metadata_(nullptr), batch_writer_(nullptr), stream_(std::move(stream)) {}
 
-  static Status Open(
-      const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-      std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-      std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      std::unique_ptr<FlightStreamWriter>* out);
+  static Status Open(const FlightDescriptor& descriptor,
+                     const std::shared_ptr<Schema>& schema,
+                     std::shared_ptr<FinishableStream<GrpcStream>> stream,
+                     std::unique_ptr<FlightStreamWriter>* out);
 
   Status WriteRecordBatch(const RecordBatch& batch) override {
     return WriteWithMetadata(batch, nullptr);
@@ -380,7 +512,8 @@ class GrpcStreamWriter : public FlightStreamWriter {
       return Status::OK();
     }
     done_writing_ = true;
-    if (!writer_->WritesDone()) {
+    // The server may already have ended the call
+    if (!stream_->finished() && !stream_->stream()->WritesDone()) {
       return Status::IOError("Could not flush pending record batches.");
     }
     return Status::OK();
@@ -391,30 +524,28 @@ class GrpcStreamWriter : public FlightStreamWriter {
   Status Close() override { return batch_writer_->Close(); }
 
  private:
-  friend class DoPutPayloadWriter;
+  friend class GrpcPayloadWriter<ProtoReadT>;
   std::shared_ptr<Buffer> app_metadata_;
   std::unique_ptr<ipc::RecordBatchWriter> batch_writer_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<FinishableStream<GrpcStream>> stream_;
   bool done_writing_ = false;
 };
 
-/// A IpcPayloadWriter implementation that writes to a DoPut stream
-class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
+/// A IpcPayloadWriter implementation that writes to a DoPut or DoExchange stream
+template <typename ProtoReadT>
+class GrpcPayloadWriter : public ipc::internal::IpcPayloadWriter {
  public:
-  DoPutPayloadWriter(
-      const FlightDescriptor& descriptor, std::unique_ptr<ClientRpc> rpc,
-      std::unique_ptr<pb::PutResult> response, std::shared_ptr<std::mutex> read_mutex,
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
-      GrpcStreamWriter* stream_writer)
+  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, ProtoReadT>;
+
+  GrpcPayloadWriter(const FlightDescriptor& descriptor,
+                    std::shared_ptr<FinishableStream<GrpcStream>> stream,
+                    GrpcStreamWriter<ProtoReadT>* stream_writer)
       : descriptor_(descriptor),
-        rpc_(std::move(rpc)),
-        response_(std::move(response)),
-        read_mutex_(read_mutex),
-        writer_(std::move(writer)),
+        stream_(std::move(stream)),
         first_payload_(true),
         stream_writer_(stream_writer) {}
 
-  ~DoPutPayloadWriter() override = default;
+  ~GrpcPayloadWriter() override = default;
 
   Status Start() override { return Status::OK(); }
 
@@ -442,23 +573,21 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
       payload.app_metadata = std::move(stream_writer_->app_metadata_);
     }
 
-    if (!internal::WritePayload(payload, writer_.get())) {
-      return rpc_->IOError("Could not write record batch to stream: ");
+    if (!internal::WritePayload(payload, stream_->stream())) {
+      return stream_->rpc()->IOError("Could not write record batch to stream: ");
     }
     return Status::OK();
   }
 
   Status Close() override {
-    bool finished_writes = stream_writer_->done_writing_ ? true : writer_->WritesDone();
+    bool finished_writes = stream_writer_->done_writing_ || stream_->finished() ||
+                           stream_->stream()->WritesDone();
     // Drain the read side to avoid hanging
-    std::unique_lock<std::mutex> guard(*read_mutex_, std::try_to_lock);
+    std::unique_lock<std::mutex> guard(stream_->read_mutex(), std::try_to_lock);
     if (!guard.owns_lock()) {
       return Status::IOError("Cannot close stream with pending read operation.");
     }
-    pb::PutResult message;
-    while (writer_->Read(&message)) {
-    }
-    RETURN_NOT_OK(internal::FromGrpcStatus(writer_->Finish()));
+    RETURN_NOT_OK(stream_->Finish());
     if (!finished_writes) {
       return Status::UnknownError(
           "Could not finish writing record batches before closing");
@@ -469,23 +598,19 @@ class DoPutPayloadWriter : public ipc::internal::IpcPayloadWriter {
  protected:
   // TODO: there isn't a way to access this as a user.
   const FlightDescriptor descriptor_;
-  std::unique_ptr<ClientRpc> rpc_;
-  std::unique_ptr<pb::PutResult> response_;
-  std::shared_ptr<std::mutex> read_mutex_;
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer_;
+  std::shared_ptr<FinishableStream<GrpcStream>> stream_;
   bool first_payload_;
-  GrpcStreamWriter* stream_writer_;
+  GrpcStreamWriter<ProtoReadT>* stream_writer_;
 };
 
-Status GrpcStreamWriter::Open(
+template <typename ProtoReadT>
+Status GrpcStreamWriter<ProtoReadT>::Open(
     const FlightDescriptor& descriptor, const std::shared_ptr<Schema>& schema,
-    std::unique_ptr<ClientRpc> rpc, std::unique_ptr<pb::PutResult> response,
-    std::shared_ptr<std::mutex> read_mutex,
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer,
+    std::shared_ptr<FinishableStream<GrpcStream>> stream,
     std::unique_ptr<FlightStreamWriter>* out) {
-  std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(writer));
-  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(new DoPutPayloadWriter(
-      descriptor, std::move(rpc), std::move(response), read_mutex, writer, result.get()));
+  std::unique_ptr<GrpcStreamWriter> result(new GrpcStreamWriter(stream));
+  std::unique_ptr<ipc::internal::IpcPayloadWriter> payload_writer(
+      new GrpcPayloadWriter<ProtoReadT>(descriptor, std::move(stream), result.get()));
   RETURN_NOT_OK(ipc::internal::OpenRecordBatchWriter(std::move(payload_writer), schema,
                                                      &result->batch_writer_));
   *out = std::move(result);
@@ -496,15 +621,15 @@ FlightMetadataReader::~FlightMetadataReader() = default;
 
 class GrpcMetadataReader : public FlightMetadataReader {
  public:
-  explicit GrpcMetadataReader(
-      std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> reader,
-      std::shared_ptr<std::mutex> read_mutex)
-      : reader_(reader), read_mutex_(read_mutex) {}
+  using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>;
+
+  explicit GrpcMetadataReader(std::shared_ptr<FinishableStream<GrpcStream>> stream)
+      : stream_(std::move(stream)) {}
 
   Status ReadMetadata(std::shared_ptr<Buffer>* out) override {
-    std::lock_guard<std::mutex> guard(*read_mutex_);
+    std::lock_guard<std::mutex> guard(stream_->read_mutex());
     pb::PutResult message;
-    if (reader_->Read(&message)) {
+    if (!stream_->finished() && stream_->stream()->Read(&message)) {
       *out = Buffer::FromString(std::move(*message.mutable_app_metadata()));
     } else {
       // Stream finished
@@ -514,13 +639,13 @@ class GrpcMetadataReader : public FlightMetadataReader {
   }
 
  private:
-  std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> reader_;
-  std::shared_ptr<std::mutex> read_mutex_;
+  std::shared_ptr<FinishableStream<GrpcStream>> stream_;
 };
 
 class FlightClient::FlightClientImpl {
  public:
   Status Connect(const Location& location, const FlightClientOptions& options) {
+    options_ = options;
     const std::string& scheme = location.scheme();
 
     std::stringstream grpc_uri;
@@ -689,16 +814,28 @@ class FlightClient::FlightClientImpl {
 
   Status DoGet(const FlightCallOptions& options, const Ticket& ticket,
                std::unique_ptr<FlightStreamReader>* out) {
+    return DoGet(std::make_shared<ClientRpc>(options), ticket, out);
+  }
+
+  // The call can be cancelled through rpc's context from another thread,
+  // even before it was started.
+  Status DoGet(std::shared_ptr<ClientRpc> rpc, const Ticket& ticket,
+               std::unique_ptr<FlightStreamReader>* out) {
+    using GrpcStream = grpc::ClientReader<pb::FlightData>;
     pb::Ticket pb_ticket;
     internal::ToProto(ticket, &pb_ticket);
 
-    std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<grpc::ClientReader<pb::FlightData>> stream(
-        stub_->DoGet(&rpc->context, pb_ticket));
+    if (options_.shared_memory && internal::SharedMemorySupported()) {
+      rpc->context.AddMetadata(internal::kSharedMemoryHeader,
+                               internal::SharedMemoryRequest());
+    }
+    std::shared_ptr<GrpcStream> stream(stub_->DoGet(&rpc->context, pb_ticket));
 
     std::unique_ptr<GrpcStreamReader> reader;
-    RETURN_NOT_OK(GrpcStreamReader::Open(std::move(rpc), std::move(stream), &reader));
+    RETURN_NOT_OK(GrpcStreamReader::Open(
+        std::make_shared<FinishableStream<GrpcStream>>(std::move(rpc), stream),
+        /*eager=*/true, &reader));
     *out = std::move(reader);
     return Status::OK();
   }
@@ -707,24 +844,249 @@ class FlightClient::FlightClientImpl {
                const std::shared_ptr<Schema>& schema,
                std::unique_ptr<FlightStreamWriter>* out,
                std::unique_ptr<FlightMetadataReader>* reader) {
+    using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>;
+    std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
+    RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
+    std::shared_ptr<GrpcStream> writer(stub_->DoPut(&rpc->context));
+
+    auto stream = std::make_shared<FinishableStream<GrpcStream>>(std::move(rpc), writer);
+    *reader = std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(stream));
+    return GrpcStreamWriter<pb::PutResult>::Open(descriptor, schema, std::move(stream),
+                                                 out);
+  }
+
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    using GrpcStream = grpc::ClientReaderWriter<pb::FlightData, pb::FlightData>;
     std::unique_ptr<ClientRpc> rpc(new ClientRpc(options));
     RETURN_NOT_OK(rpc->SetToken(auth_handler_.get()));
-    std::unique_ptr<pb::PutResult> response(new pb::PutResult);
-    std::shared_ptr<grpc::ClientReaderWriter<pb::FlightData, pb::PutResult>> writer(
-        stub_->DoPut(&rpc->context));
+    std::shared_ptr<GrpcStream> grpc_stream(stub_->DoExchange(&rpc->context));
+
+    auto stream =
+        std::make_shared<FinishableStream<GrpcStream>>(std::move(rpc), grpc_stream);
+    std::unique_ptr<GrpcStreamReader> stream_reader;
+    RETURN_NOT_OK(GrpcStreamReader::Open(stream, /*eager=*/false, &stream_reader));
+    *reader = std::move(stream_reader);
+    return GrpcStreamWriter<pb::FlightData>::Open(descriptor, schema, std::move(stream),
+                                                  writer);
+  }
+
+  const FlightClientOptions& options() const { return options_; }
+
+  const std::shared_ptr<ClientAuthHandler>& auth_handler() const {
+    return auth_handler_;
+  }
 
-    std::shared_ptr<std::mutex> read_mutex = std::make_shared<std::mutex>();
-    *reader =
-        std::unique_ptr<FlightMetadataReader>(new GrpcMetadataReader(writer, read_mutex));
-    return GrpcStreamWriter::Open(descriptor, schema, std::move(rpc), std::move(response),
-                                  read_mutex, writer, out);
+  // Present the tokens of another client's handler, without authenticating
+  void ShareAuthHandler(std::shared_ptr<ClientAuthHandler> auth_handler) {
+    auth_handler_ = std::move(auth_handler);
   }
 
  private:
+  FlightClientOptions options_;
   std::unique_ptr<pb::FlightService::Stub> stub_;
   std::shared_ptr<ClientAuthHandler> auth_handler_;
 };
 
+// Reads the endpoints of a flight on a set of worker threads, each
+// fetching one endpoint at a time. Fetched batches are buffered in one
+// queue per endpoint (ordered) or a single queue (unordered) until the
+// consumer reads them.
+class ParallelFlightReader : public RecordBatchReader {
+ public:
+  ParallelFlightReader(FlightClient* client, FlightCallOptions call_options,
+                       std::vector<FlightEndpoint> endpoints,
+                       std::shared_ptr<Schema> schema,
+                       const FlightParallelReadOptions& read_options)
+      : client_(client),
+        client_options_(client->impl_->options()),
+        auth_handler_(client->impl_->auth_handler()),
+        call_options_(std::move(call_options)),
+        endpoints_(std::move(endpoints)),
+        schema_(std::move(schema)),
+        max_buffered_(std::max<int32_t>(read_options.max_buffered_batches, 1)),
+        ordered_(read_options.ordered),
+        queues_(ordered_ ? endpoints_.size() : 1) {
+    const size_t num_workers = std::min<size_t>(
+        std::max<int32_t>(read_options.max_concurrency, 1), endpoints_.size());
+    for (size_t i = 0; i < num_workers; ++i) {
+      workers_.emplace_back([this]() { DoWork(); });
+    }
+  }
+
+  ~ParallelFlightReader() override {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      please_shutdown_ = true;
+      CancelStreamsUnlocked();
+    }
+    batch_pushable_.notify_all();
+    for (auto& worker : workers_) {
+      worker.join();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* out) override {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+      RETURN_NOT_OK(status_);
+      if (ordered_) {
+        // Skip past the endpoints that were fully read
+        while (head_ < endpoints_.size() && queues_[head_].empty() && done_[head_]) {
+          ++head_;
+          batch_pushable_.notify_all();
+        }
+      }
+      const size_t index = ordered_ ? head_ : 0;
+      if (index < queues_.size() && !queues_[index].empty()) {
+        *out = std::move(queues_[index].front());
+        queues_[index].pop_front();
+        --num_buffered_;
+        batch_pushable_.notify_all();
+        return Status::OK();
+      }
+      if (num_done_ == endpoints_.size()) {
+        *out = nullptr;
+        return Status::OK();
+      }
+      batch_pushed_.wait(lock);
+    }
+  }
+
+ private:
+  using Connections = std::unordered_map<std::string, std::unique_ptr<FlightClient>>;
+
+  void DoWork() {
+    // Connections opened by this worker, by location
+    Connections connections;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!please_shutdown_ && status_.ok() && next_endpoint_ < endpoints_.size()) {
+      const size_t index = next_endpoint_++;
+      lock.unlock();
+      Status st = ReadEndpoint(index, &connections);
+      lock.lock();
+      if (!st.ok() && status_.ok()) {
+        status_ = st;
+        CancelStreamsUnlocked();
+        batch_pushable_.notify_all();
+      }
+      done_[index] = true;
+      ++num_done_;
+      batch_pushed_.notify_one();
+    }
+  }
+
+  Status ReadEndpoint(size_t index, Connections* connections) {
+    const FlightEndpoint& endpoint = endpoints_[index];
+    FlightClient* client = client_;
+    if (!endpoint.locations.empty()) {
+      const Location& location = endpoint.locations[0];
+      auto it = connections->find(location.ToString());
+      if (it == connections->end()) {
+        std::unique_ptr<FlightClient> connection;
+        RETURN_NOT_OK(FlightClient::Connect(location, client_options_, &connection));
+        // The locations of a flight usually accept the tokens of its service
+        connection->impl_->ShareAuthHandler(auth_handler_);
+        it = connections->emplace(location.ToString(), std::move(connection)).first;
+      }
+      client = it->second.get();
+    }
+
+    // Starting the call waits for the connection and the schema, so the call
+    // is cancellable from the start
+    auto rpc = std::make_shared<ClientRpc>(call_options_);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (please_shutdown_ || !status_.ok()) {
+        return Status::OK();
+      }
+      starting_calls_[index] = rpc.get();
+    }
+    std::unique_ptr<FlightStreamReader> stream;
+    Status st = client->impl_->DoGet(rpc, endpoint.ticket, &stream);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      starting_calls_.erase(index);
+      if (please_shutdown_ || !status_.ok()) {
+        if (st.ok()) {
+          stream->Cancel();
+        }
+        return Status::OK();
+      }
+      RETURN_NOT_OK(st);
+      active_streams_[index] = stream.get();
+    }
+    st = ReadStream(index, stream.get());
+    std::lock_guard<std::mutex> lock(mutex_);
+    active_streams_.erase(index);
+    return st;
+  }
+
+  Status ReadStream(size_t index, FlightStreamReader* stream) {
+    FlightStreamChunk chunk;
+    while (true) {
+      RETURN_NOT_OK(stream->Next(&chunk));
+      if (chunk.data == nullptr) {
+        return Status::OK();
+      }
+      if (!chunk.data->schema()->Equals(*schema_, /*check_metadata=*/false)) {
+        return Status::Invalid("Endpoint ", index,
+                               " returned a schema different from the flight's");
+      }
+      std::unique_lock<std::mutex> lock(mutex_);
+      // The batches of the endpoint being read are always accepted once
+      // its queue is drained, so that ordered reads can't stall
+      batch_pushable_.wait(lock, [&]() {
+        return please_shutdown_ || !status_.ok() || num_buffered_ < max_buffered_ ||
+               (ordered_ && index == head_ && queues_[index].empty());
+      });
+      if (please_shutdown_ || !status_.ok()) {
+        return Status::OK();
+      }
+      queues_[ordered_ ? index : 0].push_back(std::move(chunk.data));
+      ++num_buffered_;
+      batch_pushed_.notify_one();
+    }
+  }
+
+  void CancelStreamsUnlocked() {
+    for (const auto& rpc : starting_calls_) {
+      rpc.second->context.TryCancel();
+    }
+    for (const auto& stream : active_streams_) {
+      stream.second->Cancel();
+    }
+  }
+
+  FlightClient* client_;
+  const FlightClientOptions client_options_;
+  const std::shared_ptr<ClientAuthHandler> auth_handler_;
+  const FlightCallOptions call_options_;
+  const std::vector<FlightEndpoint> endpoints_;
+  const std::shared_ptr<Schema> schema_;
+  const int32_t max_buffered_;
+  const bool ordered_;
+
+  std::mutex mutex_;
+  std::condition_variable batch_pushed_;
+  std::condition_variable batch_pushable_;
+  std::vector<std::deque<std::shared_ptr<RecordBatch>>> queues_;
+  std::vector<bool> done_ = std::vector<bool>(endpoints_.size(), false);
+  std::map<size_t, ClientRpc*> starting_calls_;
+  std::map<size_t, FlightStreamReader*> active_streams_;
+  size_t next_endpoint_ = 0;
+  size_t num_done_ = 0;
+  size_t head_ = 0;
+  int32_t num_buffered_ = 0;
+  bool please_shutdown_ = false;
+  Status status_;
+  std::vector<std::thread> workers_;
+};
+
 FlightClient::FlightClient() { impl_.reset(new FlightClientImpl); }
 
 FlightClient::~FlightClient() {}
@@ -782,6 +1144,17 @@ Status FlightClient::DoGet(const FlightCallOptions& options, const Ticket& ticke
   return impl_->DoGet(options, ticket, stream);
 }
 
+Status FlightClient::DoGet(const FlightCallOptions& options, const FlightInfo& info,
+                           const FlightParallelReadOptions& read_options,
+                           std::unique_ptr<RecordBatchReader>* reader) {
+  ipc::DictionaryMemo dictionary_memo;
+  std::shared_ptr<Schema> schema;
+  RETURN_NOT_OK(info.GetSchema(&dictionary_memo, &schema));
+  reader->reset(new ParallelFlightReader(this, options, info.endpoints(),
+                                         std::move(schema), read_options));
+  return Status::OK();
+}
+
 Status FlightClient::DoPut(const FlightCallOptions& options,
                            const FlightDescriptor& descriptor,
                            const std::shared_ptr<Schema>& schema,
@@ -790,5 +1163,13 @@ Status FlightClient::DoPut(const FlightCallOptions& options,
   return impl_->DoPut(options, descriptor, schema, stream, reader);
 }
 
+Status FlightClient::DoExchange(const FlightCallOptions& options,
+                                const FlightDescriptor& descriptor,
+                                const std::shared_ptr<Schema>& schema,
+                                std::unique_ptr<FlightStreamWriter>* writer,
+                                std::unique_ptr<FlightStreamReader>* reader) {
+  return impl_->DoExchange(options, descriptor, schema, writer, reader);
+}
+
 }  // namespace flight
 }  // namespace arrow
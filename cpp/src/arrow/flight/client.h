@@ -21,6 +21,7 @@
 #pragma once
 
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -37,6 +38,7 @@ namespace arrow {
 
 class MemoryPool;
 class RecordBatch;
+class RecordBatchReader;
 class Schema;
 
 namespace flight {
@@ -69,6 +71,30 @@ class ARROW_FLIGHT_EXPORT FlightClientOptions {
   std::string override_hostname;
   /// \brief A list of client middleware to apply.
   std::vector<std::shared_ptr<ClientMiddlewareFactory>> middleware;
+  /// \brief Ask the server to send the record batches of DoGet streams
+  /// through shared memory rather than over the connection. Streams fall
+  /// back to the connection unless the server runs on the same host as the
+  /// same user and supports it.
+  bool shared_memory = false;
+};
+
+/// \brief Options for reading all the endpoints of a flight at once.
+class ARROW_FLIGHT_EXPORT FlightParallelReadOptions {
+ public:
+  /// Create a default set of parallel read options.
+  FlightParallelReadOptions();
+
+  /// \brief The maximum number of endpoints fetched at the same time.
+  ///
+  /// Each concurrent fetch keeps its own connection to the locations it
+  /// reads from, and reuses it for further endpoints at the same location.
+  int32_t max_concurrency;
+  /// \brief The maximum number of record batches buffered ahead of the
+  /// reader, across all endpoints.
+  int32_t max_buffered_batches;
+  /// \brief Whether record batches are read in endpoint order. Otherwise,
+  /// they are read in whichever order they arrive.
+  bool ordered;
 };
 
 /// \brief A RecordBatchReader exposing Flight metadata and cancel
@@ -217,6 +243,30 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoGet({}, ticket, stream);
   }
 
+  /// \brief Read all the endpoints of a flight concurrently, as a single
+  /// stream of record batches.
+  ///
+  /// Endpoints without a location are redeemed with this client, which
+  /// must outlive the returned reader; others are redeemed at their first
+  /// location, over connections opened with this client's options. Those
+  /// connections send the tokens of the handler this client authenticated
+  /// with (if any) instead of authenticating again, so the handler must be
+  /// safe to use from several threads. Destroying the reader cancels the
+  /// remaining fetches, including calls still being started.
+  ///
+  /// \param[in] options Per-RPC options, applied to each endpoint
+  /// \param[in] info the flight to read
+  /// \param[in] read_options the parallelism and ordering of the read
+  /// \param[out] reader the returned RecordBatchReader
+  /// \return Status
+  Status DoGet(const FlightCallOptions& options, const FlightInfo& info,
+               const FlightParallelReadOptions& read_options,
+               std::unique_ptr<RecordBatchReader>* reader);
+  Status DoGet(const FlightInfo& info, const FlightParallelReadOptions& read_options,
+               std::unique_ptr<RecordBatchReader>* reader) {
+    return DoGet({}, info, read_options, reader);
+  }
+
   /// \brief Upload data to a Flight described by the given
   /// descriptor. The caller must call Close() on the returned stream
   /// once they are done writing.
@@ -241,7 +291,36 @@ class ARROW_FLIGHT_EXPORT FlightClient {
     return DoPut({}, descriptor, schema, stream, reader);
   }
 
+  /// \brief Open a bidirectional data exchange with the server for the
+  /// given descriptor: record batches are uploaded while the server streams
+  /// record batches back, both along with application metadata.
+  ///
+  /// The descriptor and schema are sent along with the first record
+  /// batch (or when closing the writer). Reading the server's schema or data
+  /// blocks until the server sends it. As with DoPut, closing the writer
+  /// also closes the reader; use \a DoneWriting to only end the upload
+  /// while reading the rest of the server's stream.
+  ///
+  /// \param[in] options Per-RPC options
+  /// \param[in] descriptor the descriptor of the exchange
+  /// \param[in] schema the schema for the data to upload
+  /// \param[out] writer a writer to upload record batches with
+  /// \param[out] reader a reader for the record batches from the server
+  /// \return Status
+  Status DoExchange(const FlightCallOptions& options, const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader);
+  Status DoExchange(const FlightDescriptor& descriptor,
+                    const std::shared_ptr<Schema>& schema,
+                    std::unique_ptr<FlightStreamWriter>* writer,
+                    std::unique_ptr<FlightStreamReader>* reader) {
+    return DoExchange({}, descriptor, schema, writer, reader);
+  }
+
  private:
+  friend class ParallelFlightReader;
+
   FlightClient();
   class FlightClientImpl;
   std::unique_ptr<FlightClientImpl> impl_;
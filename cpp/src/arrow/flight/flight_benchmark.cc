@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <mutex>
 #include <sstream>
@@ -45,6 +46,11 @@ DEFINE_int32(num_threads, 4, "Number of concurrent gets");
 DEFINE_int32(records_per_stream, 10000000, "Total records per stream");
 DEFINE_int32(records_per_batch, 4096, "Total records per batch within stream");
 DEFINE_bool(test_put, false, "Test DoPut instead of DoGet");
+DEFINE_bool(test_exchange, false,
+            "Test DoExchange round trips (each batch is echoed) instead of DoGet");
+DEFINE_bool(test_shared_memory, false,
+            "Test DoGet both over the connection and through shared memory (the "
+            "server must run on the same host)");
 
 namespace perf = arrow::flight::perf;
 
@@ -58,6 +64,8 @@ namespace flight {
 struct PerformanceResult {
   int64_t num_records;
   int64_t num_bytes;
+  // Only for DoExchange
+  std::vector<uint64_t> round_trip_nanos;
 };
 
 struct PerformanceStats {
@@ -65,14 +73,42 @@ struct PerformanceStats {
   std::mutex mutex;
   int64_t total_records;
   int64_t total_bytes;
+  std::vector<uint64_t> round_trip_nanos;
 
-  void Update(const int64_t total_records, const int64_t total_bytes) {
+  void Update(const PerformanceResult& perf) {
     std::lock_guard<std::mutex> lock(this->mutex);
-    this->total_records += total_records;
-    this->total_bytes += total_bytes;
+    this->total_records += perf.num_records;
+    this->total_bytes += perf.num_bytes;
+    this->round_trip_nanos.insert(this->round_trip_nanos.end(),
+                                  perf.round_trip_nanos.begin(),
+                                  perf.round_trip_nanos.end());
   }
 };
 
+std::shared_ptr<Schema> PerfSchema() {
+  return arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
+                        field("d", int64())});
+}
+
+// Make a batch of random data to upload
+Status MakePerfBatch(const perf::Token& token, const std::shared_ptr<Schema>& schema,
+                     std::shared_ptr<RecordBatch>* out) {
+  std::shared_ptr<ResizableBuffer> buffer;
+  std::vector<std::shared_ptr<Array>> arrays;
+
+  const int32_t length = token.definition().records_per_batch();
+  const int32_t ncolumns = 4;
+  for (int i = 0; i < ncolumns; ++i) {
+    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
+                                       &buffer, static_cast<int32_t>(i) /* seed */));
+    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
+    RETURN_NOT_OK(arrays.back()->Validate());
+  }
+
+  *out = RecordBatch::Make(schema, length, arrays);
+  return Status::OK();
+}
+
 Status WaitForReady(FlightClient* client) {
   Action action{"ping", nullptr};
   for (int attempt = 0; attempt < 10; attempt++) {
@@ -130,9 +166,7 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
                                               const FlightEndpoint& endpoint) {
   std::unique_ptr<FlightStreamWriter> writer;
   std::unique_ptr<FlightMetadataReader> reader;
-  std::shared_ptr<Schema> schema =
-      arrow::schema({field("a", int64()), field("b", int64()), field("c", int64()),
-                     field("d", int64())});
+  std::shared_ptr<Schema> schema = PerfSchema();
   RETURN_NOT_OK(client->DoPut(FlightDescriptor{}, schema, &writer, &reader));
 
   // This is hard-coded for right now, 4 columns each with int64
@@ -141,19 +175,9 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
   int64_t num_bytes = 0;
   int64_t num_records = 0;
 
-  std::shared_ptr<ResizableBuffer> buffer;
-  std::vector<std::shared_ptr<Array>> arrays;
-
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(MakePerfBatch(token, schema, &batch));
   const int32_t length = token.definition().records_per_batch();
-  const int32_t ncolumns = 4;
-  for (int i = 0; i < ncolumns; ++i) {
-    RETURN_NOT_OK(MakeRandomByteBuffer(length * sizeof(int64_t), default_memory_pool(),
-                                       &buffer, static_cast<int32_t>(i) /* seed */));
-    arrays.push_back(std::make_shared<Int64Array>(length, buffer));
-    RETURN_NOT_OK(arrays.back()->Validate());
-  }
-
-  std::shared_ptr<RecordBatch> batch = RecordBatch::Make(schema, length, arrays);
 
   int records_sent = 0;
   const int total_records = token.definition().records_per_stream();
@@ -178,7 +202,47 @@ arrow::Result<PerformanceResult> RunDoPutTest(FlightClient* client,
   return PerformanceResult{num_records, num_bytes};
 }
 
-Status RunPerformanceTest(FlightClient* client, bool test_put) {
+arrow::Result<PerformanceResult> RunDoExchangeTest(FlightClient* client,
+                                                   const perf::Token& token,
+                                                   const FlightEndpoint& endpoint) {
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  std::shared_ptr<Schema> schema = PerfSchema();
+  RETURN_NOT_OK(client->DoExchange(FlightDescriptor{}, schema, &writer, &reader));
+
+  // This is hard-coded for right now, 4 columns each with int64
+  const int bytes_per_record = 32;
+
+  std::shared_ptr<RecordBatch> batch;
+  RETURN_NOT_OK(MakePerfBatch(token, schema, &batch));
+
+  PerformanceResult result{0, 0, {}};
+  FlightStreamChunk chunk;
+  StopWatch timer;
+  const int64_t total_records = token.definition().records_per_stream();
+  while (result.num_records < total_records) {
+    // Send a batch and wait for the server to echo it
+    const int64_t length =
+        std::min(batch->num_rows(), total_records - result.num_records);
+    timer.Start();
+    RETURN_NOT_OK(writer->WriteRecordBatch(*batch->Slice(0, length)));
+    RETURN_NOT_OK(reader->Next(&chunk));
+    result.round_trip_nanos.push_back(timer.Stop());
+    if (!chunk.data || chunk.data->num_rows() != length) {
+      return Status::Invalid("Server did not echo the record batch");
+    }
+    result.num_records += length;
+    // Hard-coded
+    result.num_bytes += length * bytes_per_record;
+  }
+
+  RETURN_NOT_OK(writer->DoneWriting());
+  RETURN_NOT_OK(writer->Close());
+  return result;
+}
+
+Status RunPerformanceTest(FlightClient* client, const FlightClientOptions& client_options,
+                          bool test_put, bool test_exchange) {
   // TODO(wesm): Multiple servers
   // std::vector<std::unique_ptr<TestServer>> servers;
 
@@ -202,11 +266,14 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   RETURN_NOT_OK(plan->GetSchema(&dict_memo, &schema));
 
   PerformanceStats stats;
-  auto test_loop = test_put ? &RunDoPutTest : &RunDoGetTest;
-  auto ConsumeStream = [&stats, &test_loop](const FlightEndpoint& endpoint) {
+  auto test_loop = test_put ? &RunDoPutTest
+                            : test_exchange ? &RunDoExchangeTest : &RunDoGetTest;
+  auto ConsumeStream = [&stats, &test_loop,
+                        &client_options](const FlightEndpoint& endpoint) {
     // TODO(wesm): Use location from endpoint, same host/port for now
     std::unique_ptr<FlightClient> client;
-    RETURN_NOT_OK(FlightClient::Connect(endpoint.locations.front(), &client));
+    RETURN_NOT_OK(
+        FlightClient::Connect(endpoint.locations.front(), client_options, &client));
 
     perf::Token token;
     token.ParseFromString(endpoint.ticket.ticket);
@@ -214,7 +281,7 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
     const auto& result = test_loop(client.get(), token, endpoint);
     if (result.ok()) {
       const PerformanceResult& perf = result.ValueOrDie();
-      stats.Update(perf.num_records, perf.num_bytes);
+      stats.Update(perf);
     }
     return result.status();
   };
@@ -256,6 +323,22 @@ Status RunPerformanceTest(FlightClient* client, bool test_put) {
   std::cout << "Speed: "
             << (static_cast<double>(stats.total_bytes) / kMegabyte / time_elapsed)
             << " MB/s" << std::endl;
+
+  auto& round_trips = stats.round_trip_nanos;
+  if (!round_trips.empty()) {
+    std::sort(round_trips.begin(), round_trips.end());
+    uint64_t total_nanos = 0;
+    for (uint64_t nanos : round_trips) {
+      total_nanos += nanos;
+    }
+    auto percentile = [&](double q) {
+      return round_trips[static_cast<size_t>(q * (round_trips.size() - 1))] / 1000.0;
+    };
+    std::cout << "Round trips: " << round_trips.size() << std::endl;
+    std::cout << "Round trip latency (us): mean "
+              << total_nanos / 1000.0 / round_trips.size() << ", median "
+              << percentile(0.5) << ", p99 " << percentile(0.99) << std::endl;
+  }
   return Status::OK();
 }
 
@@ -280,6 +363,8 @@ int main(int argc, char** argv) {
   std::cout << "Testing method: ";
   if (FLAGS_test_put) {
     std::cout << "DoPut";
+  } else if (FLAGS_test_exchange) {
+    std::cout << "DoExchange";
   } else {
     std::cout << "DoGet";
   }
@@ -295,7 +380,20 @@ int main(int argc, char** argv) {
   ABORT_NOT_OK(arrow::flight::FlightClient::Connect(location, &client));
   ABORT_NOT_OK(arrow::flight::WaitForReady(client.get()));
 
-  arrow::Status s = arrow::flight::RunPerformanceTest(client.get(), FLAGS_test_put);
+  arrow::flight::FlightClientOptions client_options;
+  arrow::Status s;
+  if (FLAGS_test_shared_memory && !FLAGS_test_put && !FLAGS_test_exchange) {
+    std::cout << "Transport: connection" << std::endl;
+    s = arrow::flight::RunPerformanceTest(client.get(), client_options, false, false);
+    if (s.ok()) {
+      std::cout << "Transport: shared memory" << std::endl;
+      client_options.shared_memory = true;
+      s = arrow::flight::RunPerformanceTest(client.get(), client_options, false, false);
+    }
+  } else {
+    s = arrow::flight::RunPerformanceTest(client.get(), client_options, FLAGS_test_put,
+                                          FLAGS_test_exchange);
+  }
 
   if (server) {
     server->Stop();
@@ -15,25 +15,35 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <thread>
 #include <vector>
 
+#ifdef __linux__
+#include <unistd.h>
+#endif
+
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "arrow/builder.h"
 #include "arrow/ipc/test_common.h"
 #include "arrow/status.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/util.h"
+#include "arrow/util/checked_cast.h"
+#include "arrow/util/io_util.h"
 #include "arrow/util/make_unique.h"
 
 #include "arrow/flight/api.h"
@@ -44,6 +54,7 @@
 
 #include "arrow/flight/internal.h"
 #include "arrow/flight/middleware_internal.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/test_util.h"
 
 namespace pb = arrow::flight::protocol;
@@ -442,6 +453,95 @@ class MetadataTestServer : public FlightServerBase {
   }
 };
 
+class DoExchangeTestServer : public FlightServerBase {
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    // Echo uploaded batches as they arrive, numbering them in the metadata
+    FlightStreamChunk chunk;
+    int counter = 0;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (chunk.data == nullptr) break;
+      if (counter == 0) {
+        if (reader->descriptor().cmd == "error") {
+          return Status::Invalid("Expected error");
+        }
+        RETURN_NOT_OK(writer->Begin(reader->schema()));
+      }
+      auto metadata = Buffer::FromString(std::to_string(counter));
+      RETURN_NOT_OK(writer->WriteWithMetadata(*chunk.data, metadata));
+      counter++;
+    }
+    return Status::OK();
+  }
+};
+
+// Serves, for the ticket "<k>", three batches with values k * 100 + i
+// A stream failing after the payloads of the wrapped stream
+class FailingFlightDataStream : public FlightDataStream {
+ public:
+  explicit FailingFlightDataStream(std::unique_ptr<FlightDataStream> stream)
+      : stream_(std::move(stream)) {}
+
+  std::shared_ptr<Schema> schema() override { return stream_->schema(); }
+  Status GetSchemaPayload(FlightPayload* payload) override {
+    return stream_->GetSchemaPayload(payload);
+  }
+  Status Next(FlightPayload* payload) override {
+    RETURN_NOT_OK(stream_->Next(payload));
+    if (payload->ipc_message.metadata == nullptr) {
+      return Status::IOError("Expected error");
+    }
+    return Status::OK();
+  }
+
+ private:
+  std::unique_ptr<FlightDataStream> stream_;
+};
+
+class ParallelDoGetTestServer : public FlightServerBase {
+ public:
+  static std::shared_ptr<Schema> ShardSchema() {
+    return arrow::schema({field("f", int64())});
+  }
+
+  static Status MakeBatches(int shard, BatchVector* out) {
+    out->clear();
+    for (int i = 0; i < 3; ++i) {
+      Int64Builder builder;
+      RETURN_NOT_OK(builder.AppendValues({shard * 100 + 2 * i, shard * 100 + 2 * i + 1}));
+      std::shared_ptr<Array> array;
+      RETURN_NOT_OK(builder.Finish(&array));
+      out->push_back(RecordBatch::Make(ShardSchema(), array->length(), {array}));
+    }
+    return Status::OK();
+  }
+
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    if (request.ticket == "error") {
+      return Status::Invalid("Expected error");
+    }
+    if (request.ticket == "slow") {
+      // Hold the call before sending the schema
+      std::this_thread::sleep_for(std::chrono::seconds(2));
+      return Status::Invalid("Not cancelled");
+    }
+    // Fails after sending the batches of shard 0
+    const bool failing = request.ticket == "failing";
+    BatchVector batches;
+    RETURN_NOT_OK(MakeBatches(failing ? 0 : std::stoi(request.ticket), &batches));
+    auto reader = std::make_shared<BatchIterator>(ShardSchema(), batches);
+    *data_stream = std::unique_ptr<FlightDataStream>(new RecordBatchStream(reader));
+    if (failing) {
+      *data_stream = std::unique_ptr<FlightDataStream>(
+          new FailingFlightDataStream(std::move(*data_stream)));
+    }
+    return Status::OK();
+  }
+};
+
 class TestMetadata : public ::testing::Test {
  public:
   void SetUp() {
@@ -537,6 +637,220 @@ class TestDoPut : public ::testing::Test {
   DoPutTestServer* do_put_server_;
 };
 
+class TestDoExchange : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<DoExchangeTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+class TestParallelDoGet : public ::testing::Test {
+ public:
+  void SetUp() {
+    ASSERT_OK(MakeServer<ParallelDoGetTestServer>(
+        &server_, &client_, [](FlightServerOptions* options) { return Status::OK(); },
+        [](FlightClientOptions* options) { return Status::OK(); }));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  // A flight with one endpoint per ticket, all redeemed at the given locations
+  FlightInfo MakeInfo(const std::vector<std::string>& tickets,
+                      const std::vector<Location>& locations = {}) {
+    std::vector<FlightEndpoint> endpoints;
+    for (const auto& ticket : tickets) {
+      endpoints.push_back(FlightEndpoint{{ticket}, locations});
+    }
+    FlightInfo::Data data;
+    ARROW_EXPECT_OK(MakeFlightInfo(*ParallelDoGetTestServer::ShardSchema(),
+                                   FlightDescriptor::Command(""), endpoints, -1, -1,
+                                   &data));
+    return FlightInfo(data);
+  }
+
+  void CheckRead(const FlightInfo& info, int num_endpoints,
+                 const FlightParallelReadOptions& read_options) {
+    std::unique_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->DoGet(info, read_options, &reader));
+    AssertSchemaEqual(*ParallelDoGetTestServer::ShardSchema(), *reader->schema());
+
+    BatchVector expected, shard, actual;
+    for (int i = 0; i < num_endpoints; ++i) {
+      ASSERT_OK(ParallelDoGetTestServer::MakeBatches(i, &shard));
+      expected.insert(expected.end(), shard.begin(), shard.end());
+    }
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader->ReadNext(&batch));
+      if (batch == nullptr) break;
+      actual.push_back(batch);
+    }
+    ASSERT_EQ(expected.size(), actual.size());
+    if (!read_options.ordered) {
+      auto by_first_value = [](const std::shared_ptr<RecordBatch>& batch) {
+        const auto& values = *batch->column(0);
+        return arrow::internal::checked_cast<const Int64Array&>(values).Value(0);
+      };
+      std::sort(actual.begin(), actual.end(),
+                [&](const std::shared_ptr<RecordBatch>& left,
+                    const std::shared_ptr<RecordBatch>& right) {
+                  return by_first_value(left) < by_first_value(right);
+                });
+    }
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected[i], *actual[i]);
+    }
+  }
+
+ protected:
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
+// Counts the calls whose server accepted shared memory transfers
+class SharedMemoryClientMiddleware : public ClientMiddleware {
+ public:
+  explicit SharedMemoryClientMiddleware(std::atomic<int>* accepted)
+      : accepted_(accepted) {}
+
+  void SendingHeaders(AddCallHeaders* outgoing_headers) override {}
+
+  void ReceivedHeaders(const CallHeaders& incoming_headers) override {
+    if (incoming_headers.find(internal::kSharedMemoryHeader) != incoming_headers.end()) {
+      (*accepted_)++;
+    }
+  }
+
+  void CallCompleted(const Status& status) override {}
+
+ private:
+  std::atomic<int>* accepted_;
+};
+
+class SharedMemoryClientMiddlewareFactory : public ClientMiddlewareFactory {
+ public:
+  void StartCall(const CallInfo& info,
+                 std::unique_ptr<ClientMiddleware>* middleware) override {
+    *middleware = arrow::internal::make_unique<SharedMemoryClientMiddleware>(&accepted_);
+  }
+
+  std::atomic<int> accepted_{0};
+};
+
+// A stream calling a function when destroyed
+class NotifyingFlightDataStream : public FlightDataStream {
+ public:
+  NotifyingFlightDataStream(std::unique_ptr<FlightDataStream> stream,
+                            std::function<void()> on_destroyed)
+      : stream_(std::move(stream)), on_destroyed_(std::move(on_destroyed)) {}
+  ~NotifyingFlightDataStream() override { on_destroyed_(); }
+
+  std::shared_ptr<Schema> schema() override { return stream_->schema(); }
+  Status GetSchemaPayload(FlightPayload* payload) override {
+    return stream_->GetSchemaPayload(payload);
+  }
+  Status Next(FlightPayload* payload) override { return stream_->Next(payload); }
+
+ private:
+  std::unique_ptr<FlightDataStream> stream_;
+  std::function<void()> on_destroyed_;
+};
+
+// Counts the DoGet calls the server is done with. The server is done with
+// the shared memory files of a call before it destroys its data stream.
+class SharedMemoryTestServer : public ParallelDoGetTestServer {
+ public:
+  Status DoGet(const ServerCallContext& context, const Ticket& request,
+               std::unique_ptr<FlightDataStream>* data_stream) override {
+    RETURN_NOT_OK(ParallelDoGetTestServer::DoGet(context, request, data_stream));
+    *data_stream = std::unique_ptr<FlightDataStream>(
+        new NotifyingFlightDataStream(std::move(*data_stream), [this] {
+          std::lock_guard<std::mutex> guard(mutex_);
+          ++calls_done_;
+          calls_done_cv_.notify_all();
+        }));
+    return Status::OK();
+  }
+
+  void WaitForCallsDone(int num_calls) {
+    std::unique_lock<std::mutex> lock(mutex_);
+    calls_done_cv_.wait(lock, [&] { return calls_done_ >= num_calls; });
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable calls_done_cv_;
+  int calls_done_ = 0;
+};
+
+class TestSharedMemory : public ::testing::Test {
+ public:
+  void SetUp() {
+    middleware_ = std::make_shared<SharedMemoryClientMiddlewareFactory>();
+    ASSERT_OK(MakeServer<SharedMemoryTestServer>(
+        &server_, &client_,
+        [](FlightServerOptions* options) {
+          options->shared_memory = true;
+          return Status::OK();
+        },
+        [&](FlightClientOptions* options) {
+          options->shared_memory = true;
+          options->middleware.push_back(middleware_);
+          return Status::OK();
+        }));
+  }
+
+  void TearDown() { ASSERT_OK(server_->Shutdown()); }
+
+  void WaitForServerCallsDone(int num_calls) {
+    arrow::internal::checked_cast<SharedMemoryTestServer*>(server_.get())
+        ->WaitForCallsDone(num_calls);
+  }
+
+  // The shared memory files left by this process
+  std::vector<std::string> LeftoverFiles() {
+    std::vector<std::string> files;
+#ifdef __linux__
+    auto dir = arrow::internal::PlatformFilename::FromString("/dev/shm");
+    if (!dir.ok()) return files;
+    auto entries = arrow::internal::ListDir(*dir);
+    if (!entries.ok()) return files;
+    const std::string prefix = "arrow-flight-" + std::to_string(getpid()) + "-";
+    for (const auto& entry : *entries) {
+      if (entry.ToString().compare(0, prefix.size(), prefix) == 0) {
+        files.push_back(entry.ToString());
+      }
+    }
+#endif
+    return files;
+  }
+
+  void CheckDoGet(FlightClient* client, int shard) {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client->DoGet(Ticket{std::to_string(shard)}, &stream));
+    BatchVector expected, actual;
+    ASSERT_OK(ParallelDoGetTestServer::MakeBatches(shard, &expected));
+    ASSERT_OK(stream->ReadAll(&actual));
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); ++i) {
+      ASSERT_BATCHES_EQUAL(*expected[i], *actual[i]);
+    }
+  }
+
+ protected:
+  std::shared_ptr<SharedMemoryClientMiddlewareFactory> middleware_;
+  std::unique_ptr<FlightClient> client_;
+  std::unique_ptr<FlightServerBase> server_;
+};
+
 class TestTls : public ::testing::Test {
  public:
   void SetUp() {
@@ -1039,6 +1353,457 @@ TEST_F(TestDoPut, DoPutDicts) {
   CheckDoPut(descr, schema, batches);
 }
 
+TEST_F(TestDoExchange, RoundTrip) {
+  // Each batch is echoed before the next one is uploaded
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), batches[0]->schema(),
+                                &writer, &reader));
+  FlightStreamChunk chunk;
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_OK(writer->WriteRecordBatch(*batches[i]));
+    ASSERT_OK(reader->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ASSERT_BATCHES_EQUAL(*batches[i], *chunk.data);
+    ASSERT_NE(nullptr, chunk.app_metadata);
+    ASSERT_EQ(std::to_string(i), chunk.app_metadata->ToString());
+  }
+  AssertSchemaEqual(*batches[0]->schema(), *reader->schema());
+  ASSERT_OK(writer->DoneWriting());
+  ASSERT_OK(reader->Next(&chunk));
+  ASSERT_EQ(nullptr, chunk.data);
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, Dicts) {
+  // Upload everything before reading the results
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("echo"), batches[0]->schema(),
+                                &writer, &reader));
+  for (const auto& batch : batches) {
+    ASSERT_OK(writer->WriteRecordBatch(*batch));
+  }
+  ASSERT_OK(writer->DoneWriting());
+  BatchVector results;
+  ASSERT_OK(reader->ReadAll(&results));
+  ASSERT_EQ(batches.size(), results.size());
+  for (size_t i = 0; i < batches.size(); ++i) {
+    ASSERT_BATCHES_EQUAL(*batches[i], *results[i]);
+  }
+  ASSERT_OK(writer->Close());
+}
+
+TEST_F(TestDoExchange, ServerError) {
+  BatchVector batches;
+  ASSERT_OK(ExampleIntBatches(&batches));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client_->DoExchange(FlightDescriptor::Command("error"), batches[0]->schema(),
+                                &writer, &reader));
+  ASSERT_OK(writer->WriteRecordBatch(*batches[0]));
+  FlightStreamChunk chunk;
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Expected error"),
+                                  reader->Next(&chunk));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Expected error"),
+                                  writer->Close());
+}
+
+TEST_F(TestDoExchange, NotImplemented) {
+  std::unique_ptr<FlightServerBase> server;
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(MakeServer<FlightServerBase>(
+      &server, &client, [](FlightServerOptions* options) { return Status::OK(); },
+      [](FlightClientOptions* options) { return Status::OK(); }));
+  std::unique_ptr<FlightStreamWriter> writer;
+  std::unique_ptr<FlightStreamReader> reader;
+  ASSERT_OK(client->DoExchange(FlightDescriptor::Command(""), arrow::schema({}), &writer,
+                               &reader));
+  FlightStreamChunk chunk;
+  ASSERT_RAISES(NotImplemented, reader->Next(&chunk));
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST_F(TestParallelDoGet, Ordered) {
+  const FlightInfo info = MakeInfo({"0", "1", "2", "3", "4"});
+  FlightParallelReadOptions read_options;
+  CheckRead(info, 5, read_options);
+  // A single buffered batch must not stall the endpoints read ahead
+  read_options.max_concurrency = 3;
+  read_options.max_buffered_batches = 1;
+  CheckRead(info, 5, read_options);
+  read_options.max_concurrency = 1;
+  CheckRead(info, 5, read_options);
+}
+
+TEST_F(TestParallelDoGet, Unordered) {
+  const FlightInfo info = MakeInfo({"0", "1", "2", "3", "4"});
+  FlightParallelReadOptions read_options;
+  read_options.ordered = false;
+  CheckRead(info, 5, read_options);
+  read_options.max_buffered_batches = 1;
+  CheckRead(info, 5, read_options);
+}
+
+TEST_F(TestParallelDoGet, Empty) {
+  FlightParallelReadOptions read_options;
+  CheckRead(MakeInfo({}), 0, read_options);
+  read_options.ordered = false;
+  CheckRead(MakeInfo({}), 0, read_options);
+}
+
+TEST_F(TestParallelDoGet, Locations) {
+  // Redeem the tickets at another server than the one the client connects to
+  std::unique_ptr<FlightServerBase> server;
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(MakeServer<ParallelDoGetTestServer>(
+      &server, &client, [](FlightServerOptions* options) { return Status::OK(); },
+      [](FlightClientOptions* options) { return Status::OK(); }));
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+  FlightParallelReadOptions read_options;
+  read_options.max_concurrency = 2;
+  CheckRead(MakeInfo({"0", "1", "2"}, {location}), 3, read_options);
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST_F(TestParallelDoGet, AuthenticatedLocations) {
+  // Connections to the endpoints' locations present the client's token
+  std::unique_ptr<FlightServerBase> server;
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(MakeServer<ParallelDoGetTestServer>(
+      &server, &client,
+      [](FlightServerOptions* options) {
+        options->auth_handler = std::unique_ptr<ServerAuthHandler>(
+            new TestServerAuthHandler("user", "p4ssw0rd"));
+        return Status::OK();
+      },
+      [](FlightClientOptions* options) { return Status::OK(); }));
+  ASSERT_OK(client->Authenticate(
+      {},
+      std::unique_ptr<ClientAuthHandler>(new TestClientAuthHandler("user", "p4ssw0rd"))));
+  Location location;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server->port(), &location));
+  FlightParallelReadOptions read_options;
+  read_options.max_concurrency = 2;
+  std::swap(client, client_);
+  CheckRead(MakeInfo({"0", "1", "2"}, {location}), 3, read_options);
+  std::swap(client, client_);
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST_F(TestParallelDoGet, CancelWhileStarting) {
+  // Destroying the reader cancels calls still waiting for their schema
+  std::unique_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->DoGet(MakeInfo({"slow", "slow"}), {}, &reader));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  const auto start = std::chrono::steady_clock::now();
+  reader.reset();
+  ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(1));
+}
+
+TEST_F(TestParallelDoGet, Error) {
+  const FlightInfo info = MakeInfo({"0", "1", "error", "3"});
+  for (const bool ordered : {true, false}) {
+    FlightParallelReadOptions read_options;
+    read_options.ordered = ordered;
+    std::unique_ptr<RecordBatchReader> reader;
+    ASSERT_OK(client_->DoGet(info, read_options, &reader));
+    std::shared_ptr<RecordBatch> batch;
+    Status st;
+    do {
+      st = reader->ReadNext(&batch);
+    } while (st.ok() && batch != nullptr);
+    EXPECT_RAISES_WITH_MESSAGE_THAT(Invalid, ::testing::HasSubstr("Expected error"), st);
+  }
+}
+
+TEST_F(TestParallelDoGet, Cancel) {
+  // Destroying the reader early stops the remaining fetches
+  FlightParallelReadOptions read_options;
+  read_options.max_buffered_batches = 1;
+  std::unique_ptr<RecordBatchReader> reader;
+  ASSERT_OK(client_->DoGet(MakeInfo({"0", "1", "2", "3", "4", "5"}), read_options,
+                           &reader));
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_OK(reader->ReadNext(&batch));
+  ASSERT_NE(nullptr, batch);
+  reader.reset();
+}
+
+TEST_F(TestSharedMemory, DoGet) {
+  CheckDoGet(client_.get(), 0);
+  CheckDoGet(client_.get(), 7);
+  ASSERT_EQ(internal::SharedMemorySupported() ? 2 : 0, middleware_->accepted_.load());
+  ASSERT_EQ(std::vector<std::string>{}, LeftoverFiles());
+}
+
+TEST_F(TestSharedMemory, PartialRead) {
+  // The files of unread messages are deleted once the stream is dropped,
+  // whether or not the server is done writing
+  int num_calls = 0;
+  for (const bool server_done_first : {true, false}) {
+    std::unique_ptr<FlightStreamReader> stream;
+    ASSERT_OK(client_->DoGet(Ticket{"0"}, &stream));
+    FlightStreamChunk chunk;
+    ASSERT_OK(stream->Next(&chunk));
+    ASSERT_NE(nullptr, chunk.data);
+    ++num_calls;
+    if (server_done_first) {
+      // The batches fit in the flow control window, so the server returns
+      WaitForServerCallsDone(num_calls);
+    }
+    stream.reset();
+    WaitForServerCallsDone(num_calls);
+    ASSERT_EQ(std::vector<std::string>{}, LeftoverFiles());
+  }
+}
+
+TEST_F(TestSharedMemory, ServerError) {
+  std::unique_ptr<FlightStreamReader> stream;
+  BatchVector batches;
+  ASSERT_OK(client_->DoGet(Ticket{"failing"}, &stream));
+  EXPECT_RAISES_WITH_MESSAGE_THAT(UnknownError, ::testing::HasSubstr("Expected error"),
+                                  stream->ReadAll(&batches));
+  ASSERT_EQ(std::vector<std::string>{}, LeftoverFiles());
+  stream.reset();
+
+  // Dropping the stream after the first message
+  ASSERT_OK(client_->DoGet(Ticket{"failing"}, &stream));
+  FlightStreamChunk chunk;
+  ASSERT_OK(stream->Next(&chunk));
+  stream.reset();
+  WaitForServerCallsDone(2);
+  ASSERT_EQ(std::vector<std::string>{}, LeftoverFiles());
+}
+
+TEST_F(TestSharedMemory, AcceptRequest) {
+  if (!internal::SharedMemorySupported()) {
+    return;
+  }
+  const std::string request = internal::SharedMemoryRequest();
+  ASSERT_TRUE(internal::AcceptSharedMemoryRequest("ipv4:127.0.0.1:1234", request));
+  ASSERT_TRUE(internal::AcceptSharedMemoryRequest("ipv6:%5B::1%5D:1234", request));
+  ASSERT_TRUE(internal::AcceptSharedMemoryRequest("ipv6:[::1]:1234", request));
+  ASSERT_TRUE(internal::AcceptSharedMemoryRequest("unix:/tmp/flight.sock", request));
+  // Remote clients
+  ASSERT_FALSE(internal::AcceptSharedMemoryRequest("ipv4:10.0.0.1:1234", request));
+  ASSERT_FALSE(internal::AcceptSharedMemoryRequest("ipv6:%5B::2%5D:1234", request));
+  // Other users
+  ASSERT_FALSE(internal::AcceptSharedMemoryRequest("ipv4:127.0.0.1:1234", request + "0"));
+  ASSERT_FALSE(internal::AcceptSharedMemoryRequest("ipv4:127.0.0.1:1234", ""));
+}
+
+TEST_F(TestSharedMemory, Fallback) {
+  // Clients not asking for shared memory get the data over the connection
+  Location location;
+  std::unique_ptr<FlightClient> client;
+  ASSERT_OK(Location::ForGrpcTcp("localhost", server_->port(), &location));
+  ASSERT_OK(FlightClient::Connect(location, &client));
+  CheckDoGet(client.get(), 1);
+
+  // As do clients of servers not offering it
+  std::unique_ptr<FlightServerBase> server;
+  ASSERT_OK(MakeServer<ParallelDoGetTestServer>(
+      &server, &client, [](FlightServerOptions* options) { return Status::OK(); },
+      [](FlightClientOptions* options) {
+        options->shared_memory = true;
+        return Status::OK();
+      }));
+  CheckDoGet(client.get(), 2);
+  ASSERT_OK(server->Shutdown());
+}
+
+TEST_F(TestSharedMemory, ExportImport) {
+  if (!internal::SharedMemorySupported()) {
+    return;
+  }
+  BatchVector batches;
+  ASSERT_OK(ParallelDoGetTestServer::MakeBatches(3, &batches));
+  ipc::internal::IpcPayload payload;
+  ASSERT_OK(ipc::internal::GetRecordBatchPayload(*batches[0], ipc::IpcOptions::Defaults(),
+                                                 default_memory_pool(), &payload));
+  const int64_t body_length = payload.body_length;
+  internal::SharedMemoryExporter exporter;
+  ASSERT_OK(exporter.Export(&payload));
+  ASSERT_EQ(1U, LeftoverFiles().size());
+
+  // Only the files of the call may be imported
+  internal::SharedMemoryExporter other_exporter;
+  ASSERT_NE(exporter.token(), other_exporter.token());
+  std::shared_ptr<Buffer> body;
+  ASSERT_RAISES(IOError, internal::ImportBodyFromSharedMemory(
+                             other_exporter.token(), *payload.body_buffers[0], &body));
+
+  ASSERT_OK(internal::ImportBodyFromSharedMemory(exporter.token(),
+                                                 *payload.body_buffers[0], &body));
+  ASSERT_EQ(body_length, body->size());
+  ASSERT_EQ(std::vector<std::string>{}, LeftoverFiles());
+
+  std::unique_ptr<ipc::Message> message;
+  ASSERT_OK(ipc::Message::Open(payload.metadata, body, &message));
+  std::shared_ptr<RecordBatch> batch;
+  ipc::DictionaryMemo dictionary_memo;
+  ASSERT_OK(ipc::ReadRecordBatch(*message, batches[0]->schema(), &dictionary_memo,
+                                 &batch));
+  ASSERT_BATCHES_EQUAL(*batches[0], *batch);
+
+  // Already imported
+  ASSERT_RAISES(IOError, internal::ImportBodyFromSharedMemory(
+                             exporter.token(), *payload.body_buffers[0], &body));
+  internal::FinishSharedMemoryCall(exporter.token());
+  internal::FinishSharedMemoryCall(other_exporter.token());
+}
+
+TEST_F(TestSharedMemory, FinishCall) {
+  if (!internal::SharedMemorySupported()) {
+    return;
+  }
+  BatchVector batches;
+  ASSERT_OK(ParallelDoGetTestServer::MakeBatches(3, &batches));
+  ipc::internal::IpcPayload payload;
+  ASSERT_OK(ipc::internal::GetRecordBatchPayload(*batches[0], ipc::IpcOptions::Defaults(),
+                                                 default_memory_pool(), &payload));
+  // Whichever side is done last deletes the file and the marker of the first
+  std::string token;
+  {
+    internal::SharedMemoryExporter exporter;
+    auto copy = payload;
+    ASSERT_OK(exporter.Export(&copy));
+    token = exporter.token();
+  }
+  ASSERT_EQ(2U, LeftoverFiles().size());
+  internal::FinishSharedMemoryCall(token);
+  ASSERT_EQ(std::vector<std::string>{}, LeftoverFiles());
+  {
+    internal::SharedMemoryExporter exporter;
+    auto copy = payload;
+    ASSERT_OK(exporter.Export(&copy));
+    internal::FinishSharedMemoryCall(exporter.token());
+    ASSERT_EQ(2U, LeftoverFiles().size());
+  }
+  ASSERT_EQ(std::vector<std::string>{}, LeftoverFiles());
+}
+
+TEST_F(TestSharedMemory, InvalidDescription) {
+  internal::SharedMemoryExporter exporter;
+  const std::string token = exporter.token();
+  std::shared_ptr<Buffer> body;
+  ASSERT_RAISES(IOError, internal::ImportBodyFromSharedMemory(
+                             token, *Buffer::FromString("short"), &body));
+  // Only files created by Flight may be imported
+  std::string description(12, '\0');
+  description[0] = 8;
+  description[8] = 6;
+  description += "passwd";
+  ASSERT_RAISES(IOError,
+                internal::ImportBodyFromSharedMemory(token, Buffer(description), &body));
+  const std::string name = "arrow-flight-" + token + "-../../passwd";
+  description[8] = static_cast<char>(name.size());
+  description.replace(12, 6, name);
+  ASSERT_RAISES(IOError,
+                internal::ImportBodyFromSharedMemory(token, Buffer(description), &body));
+  // Nor with a token other than the server's
+  ASSERT_RAISES(IOError,
+                internal::ImportBodyFromSharedMemory("", Buffer(description), &body));
+  internal::FinishSharedMemoryCall(token);
+}
+
+// Check that prefetching yields the same payloads as the wrapped stream
+void AssertPayloadsEqual(const FlightPayload& expected, const FlightPayload& actual) {
+  const auto& expected_ipc = expected.ipc_message;
+  const auto& actual_ipc = actual.ipc_message;
+  ASSERT_EQ(expected_ipc.metadata == nullptr, actual_ipc.metadata == nullptr);
+  if (expected_ipc.metadata == nullptr) return;
+  ASSERT_EQ(expected_ipc.type, actual_ipc.type);
+  AssertBufferEqual(*expected_ipc.metadata, *actual_ipc.metadata);
+  ASSERT_EQ(expected_ipc.body_length, actual_ipc.body_length);
+  ASSERT_EQ(expected_ipc.body_buffers.size(), actual_ipc.body_buffers.size());
+  for (size_t i = 0; i < expected_ipc.body_buffers.size(); ++i) {
+    const auto& expected_buffer = expected_ipc.body_buffers[i];
+    const auto& actual_buffer = actual_ipc.body_buffers[i];
+    ASSERT_EQ(expected_buffer == nullptr, actual_buffer == nullptr);
+    if (expected_buffer) AssertBufferEqual(*expected_buffer, *actual_buffer);
+  }
+}
+
+void CheckPrefetching(const BatchVector& batches, int32_t max_payloads,
+                      int64_t max_bytes) {
+  const auto schema = batches[0]->schema();
+  RecordBatchStream expected(std::make_shared<BatchIterator>(schema, batches));
+  PrefetchingFlightDataStream actual(
+      std::unique_ptr<FlightDataStream>(
+          new RecordBatchStream(std::make_shared<BatchIterator>(schema, batches))),
+      max_payloads, max_bytes);
+  AssertSchemaEqual(*schema, *actual.schema());
+
+  FlightPayload expected_schema, actual_schema;
+  ASSERT_OK(expected.GetSchemaPayload(&expected_schema));
+  ASSERT_OK(actual.GetSchemaPayload(&actual_schema));
+  AssertPayloadsEqual(expected_schema, actual_schema);
+  while (true) {
+    FlightPayload expected_payload, actual_payload;
+    ASSERT_OK(expected.Next(&expected_payload));
+    ASSERT_OK(actual.Next(&actual_payload));
+    AssertPayloadsEqual(expected_payload, actual_payload);
+    if (expected_payload.ipc_message.metadata == nullptr) break;
+  }
+  // Iteration stays over
+  FlightPayload payload;
+  ASSERT_OK(actual.Next(&payload));
+  ASSERT_EQ(nullptr, payload.ipc_message.metadata);
+}
+
+TEST(TestPrefetchingFlightDataStream, Basics) {
+  BatchVector batches;
+  ASSERT_OK(ParallelDoGetTestServer::MakeBatches(1, &batches));
+  CheckPrefetching(batches, 8, 64 << 20);
+  CheckPrefetching(batches, 1, 64 << 20);
+  // A payload is always prefetched, whatever its size
+  CheckPrefetching(batches, 8, 1);
+}
+
+TEST(TestPrefetchingFlightDataStream, Dicts) {
+  BatchVector batches;
+  ASSERT_OK(ExampleDictBatches(&batches));
+  CheckPrefetching(batches, 2, 64 << 20);
+}
+
+TEST(TestPrefetchingFlightDataStream, Error) {
+  BatchVector batches;
+  ASSERT_OK(ParallelDoGetTestServer::MakeBatches(1, &batches));
+  auto reader = std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+  PrefetchingFlightDataStream stream(std::unique_ptr<FlightDataStream>(
+      new FailingFlightDataStream(std::unique_ptr<FlightDataStream>(
+          new RecordBatchStream(reader)))));
+  FlightPayload schema_payload;
+  ASSERT_OK(stream.GetSchemaPayload(&schema_payload));
+  // The payloads computed before the error are returned first
+  for (size_t i = 0; i < batches.size(); ++i) {
+    FlightPayload payload;
+    ASSERT_OK(stream.Next(&payload));
+    ASSERT_NE(nullptr, payload.ipc_message.metadata);
+  }
+  FlightPayload payload;
+  ASSERT_RAISES(IOError, stream.Next(&payload));
+}
+
+TEST(TestPrefetchingFlightDataStream, Abandon) {
+  // Destroying the stream stops prefetching
+  BatchVector batches;
+  ASSERT_OK(ParallelDoGetTestServer::MakeBatches(1, &batches));
+  auto reader = std::make_shared<BatchIterator>(batches[0]->schema(), batches);
+  PrefetchingFlightDataStream stream(
+      std::unique_ptr<FlightDataStream>(new RecordBatchStream(reader)), 1);
+  FlightPayload payload;
+  ASSERT_OK(stream.GetSchemaPayload(&payload));
+  ASSERT_OK(stream.Next(&payload));
+}
+
 TEST_F(TestAuthHandler, PassAuthenticatedCalls) {
   ASSERT_OK(client_->Authenticate(
       {},
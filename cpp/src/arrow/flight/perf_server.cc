@@ -200,6 +200,24 @@ class FlightPerfServer : public FlightServerBase {
     return Status::OK();
   }
 
+  Status DoExchange(const ServerCallContext& context,
+                    std::unique_ptr<FlightMessageReader> reader,
+                    std::unique_ptr<FlightMessageWriter> writer) override {
+    // Echo each batch as soon as it arrives
+    FlightStreamChunk chunk;
+    bool started = false;
+    while (true) {
+      RETURN_NOT_OK(reader->Next(&chunk));
+      if (!chunk.data) break;
+      if (!started) {
+        RETURN_NOT_OK(writer->Begin(chunk.data->schema()));
+        started = true;
+      }
+      RETURN_NOT_OK(writer->WriteWithMetadata(*chunk.data, chunk.app_metadata));
+    }
+    return Status::OK();
+  }
+
   Status DoAction(const ServerCallContext& context, const Action& action,
                   std::unique_ptr<ResultStream>* result) override {
     if (action.type == "ping") {
@@ -234,6 +252,8 @@ int main(int argc, char** argv) {
   arrow::flight::Location location;
   ARROW_CHECK_OK(arrow::flight::Location::ForGrpcTcp("0.0.0.0", FLAGS_port, &location));
   arrow::flight::FlightServerOptions options(location);
+  // Only used by the clients asking for it
+  options.shared_memory = true;
 
   ARROW_CHECK_OK(g_server->Init(options));
   // Exit with a clean error code (0) on SIGTERM
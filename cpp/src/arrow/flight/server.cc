@@ -21,11 +21,16 @@
 #include "arrow/flight/server.h"
 
 #include <signal.h>
+#include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 
@@ -45,6 +50,7 @@
 #include "arrow/status.h"
 #include "arrow/util/io_util.h"
 #include "arrow/util/logging.h"
+#include "arrow/util/macros.h"
 #include "arrow/util/uri.h"
 
 #include "arrow/flight/internal.h"
@@ -53,6 +59,7 @@
 #include "arrow/flight/serialization_internal.h"
 #include "arrow/flight/server_auth.h"
 #include "arrow/flight/server_middleware.h"
+#include "arrow/flight/shared_memory_internal.h"
 #include "arrow/flight/types.h"
 
 using FlightService = arrow::flight::protocol::FlightService;
@@ -92,12 +99,13 @@ namespace flight {
 namespace {
 
 // A MessageReader implementation that reads from a gRPC ServerReader
+// (the client stream of a DoPut or DoExchange call)
+template <typename GrpcStream>
 class FlightIpcMessageReader : public ipc::MessageReader {
  public:
-  explicit FlightIpcMessageReader(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader,
-      std::shared_ptr<Buffer>* last_metadata)
-      : reader_(reader), app_metadata_(last_metadata) {}
+  FlightIpcMessageReader(GrpcStream* reader, FlightDescriptor* descriptor,
+                         std::shared_ptr<Buffer>* last_metadata)
+      : reader_(reader), descriptor_(descriptor), app_metadata_(last_metadata) {}
 
   Status ReadNextMessage(std::unique_ptr<ipc::Message>* out) override {
     if (stream_finished_) {
@@ -120,9 +128,9 @@ class FlightIpcMessageReader : public ipc::MessageReader {
 
     if (first_message_) {
       if (!data.descriptor) {
-        return Status::Invalid("DoPut must start with non-null descriptor");
+        return Status::Invalid("Client stream must start with non-null descriptor");
       }
-      descriptor_ = *data.descriptor;
+      *descriptor_ = *data.descriptor;
       first_message_ = false;
     }
 
@@ -131,48 +139,123 @@ class FlightIpcMessageReader : public ipc::MessageReader {
     return Status::OK();
   }
 
-  const FlightDescriptor& descriptor() const { return descriptor_; }
-
  protected:
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
+  GrpcStream* reader_;
   bool stream_finished_ = false;
   bool first_message_ = true;
-  FlightDescriptor descriptor_;
+  FlightDescriptor* descriptor_;
   std::shared_ptr<Buffer>* app_metadata_;
 };
 
+template <typename GrpcStream>
 class FlightMessageReaderImpl : public FlightMessageReader {
  public:
-  explicit FlightMessageReaderImpl(
-      grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader)
-      : reader_(reader) {}
-
-  Status Init() {
-    message_reader_ = new FlightIpcMessageReader(reader_, &last_metadata_);
-    return ipc::RecordBatchStreamReader::Open(
-        std::unique_ptr<ipc::MessageReader>(message_reader_), &batch_reader_);
+  explicit FlightMessageReaderImpl(GrpcStream* reader) : reader_(reader) {}
+
+  // Read the descriptor and schema from the client. This happens when
+  // first needed for DoExchange, as the client may wait for data from the
+  // server before sending its own.
+  Status Init() const {
+    if (!initialized_) {
+      initialized_ = true;
+      std::unique_ptr<ipc::MessageReader> message_reader(
+          new FlightIpcMessageReader<GrpcStream>(reader_, &descriptor_, &last_metadata_));
+      init_status_ =
+          ipc::RecordBatchStreamReader::Open(std::move(message_reader), &batch_reader_);
+    }
+    return init_status_;
   }
 
   const FlightDescriptor& descriptor() const override {
-    return message_reader_->descriptor();
+    ARROW_UNUSED(Init());
+    return descriptor_;
   }
 
-  std::shared_ptr<Schema> schema() const override { return batch_reader_->schema(); }
+  std::shared_ptr<Schema> schema() const override {
+    if (!Init().ok()) {
+      return nullptr;
+    }
+    return batch_reader_->schema();
+  }
 
   Status Next(FlightStreamChunk* out) override {
     out->app_metadata = nullptr;
+    RETURN_NOT_OK(Init());
     RETURN_NOT_OK(batch_reader_->ReadNext(&out->data));
     out->app_metadata = std::move(last_metadata_);
     return Status::OK();
   }
 
  private:
+  GrpcStream* reader_;
+  // Initializing reads from the stream, hence these are mutable for schema()
+  // and descriptor()
+  mutable bool initialized_ = false;
+  mutable FlightDescriptor descriptor_;
+  mutable std::shared_ptr<Buffer> last_metadata_;
+  mutable std::shared_ptr<RecordBatchReader> batch_reader_;
+  mutable Status init_status_;
+};
+
+// A FlightMessageWriter implementation that writes to a DoExchange stream
+class GrpcMessageWriter : public FlightMessageWriter {
+ public:
+  explicit GrpcMessageWriter(
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer)
+      : writer_(writer), ipc_options_(ipc::IpcOptions::Defaults()) {}
+
+  Status Begin(const std::shared_ptr<Schema>& schema) override {
+    if (schema_) {
+      return Status::Invalid("This writer has already been started");
+    }
+    schema_ = schema;
+    FlightPayload payload;
+    RETURN_NOT_OK(ipc::internal::GetSchemaPayload(
+        *schema_, ipc_options_, &dictionary_memo_, &payload.ipc_message));
+    return Write(payload);
+  }
+
+  Status WriteWithMetadata(const RecordBatch& batch,
+                           std::shared_ptr<Buffer> app_metadata) override {
+    if (!schema_) {
+      return Status::Invalid("Begin() must be called before writing record batches");
+    }
+    if (!batch.schema()->Equals(*schema_, false /* check_metadata */)) {
+      return Status::Invalid("Tried to write record batch with different schema");
+    }
+    if (!wrote_dictionaries_) {
+      RETURN_NOT_OK(ipc::CollectDictionaries(batch, &dictionary_memo_));
+      for (const auto& pair : dictionary_memo_.id_to_dictionary()) {
+        FlightPayload payload;
+        RETURN_NOT_OK(ipc::internal::GetDictionaryPayload(
+            pair.first, pair.second, ipc_options_, pool_, &payload.ipc_message));
+        RETURN_NOT_OK(Write(payload));
+      }
+      wrote_dictionaries_ = true;
+    }
+    FlightPayload payload;
+    RETURN_NOT_OK(ipc::internal::GetRecordBatchPayload(batch, ipc_options_, pool_,
+                                                       &payload.ipc_message));
+    payload.app_metadata = std::move(app_metadata);
+    return Write(payload);
+  }
+
+  void set_memory_pool(MemoryPool* pool) override { pool_ = pool; }
+
+ private:
+  Status Write(const FlightPayload& payload) {
+    if (!internal::WritePayload(payload, writer_)) {
+      return Status::IOError("Could not write record batch to stream");
+    }
+    return Status::OK();
+  }
+
+  grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* writer_;
   std::shared_ptr<Schema> schema_;
-  std::unique_ptr<ipc::DictionaryMemo> dictionary_memo_;
-  grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>* reader_;
-  FlightIpcMessageReader* message_reader_;
-  std::shared_ptr<Buffer> last_metadata_;
-  std::shared_ptr<RecordBatchReader> batch_reader_;
+  ipc::DictionaryMemo dictionary_memo_;
+  ipc::IpcOptions ipc_options_;
+  MemoryPool* pool_ = default_memory_pool();
+  bool wrote_dictionaries_ = false;
 };
 
 class GrpcMetadataWriter : public FlightMetadataWriter {
@@ -288,8 +371,11 @@ class FlightServiceImpl : public FlightService::Service {
       std::shared_ptr<ServerAuthHandler> auth_handler,
       std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
           middleware,
-      FlightServerBase* server)
-      : auth_handler_(auth_handler), middleware_(middleware), server_(server) {}
+      FlightServerBase* server, bool shared_memory)
+      : auth_handler_(auth_handler),
+        middleware_(middleware),
+        server_(server),
+        shared_memory_(shared_memory && internal::SharedMemorySupported()) {}
 
   template <typename UserType, typename Iterator, typename ProtoType>
   grpc::Status WriteStream(Iterator* iterator, ServerWriter<ProtoType>* writer) {
@@ -494,6 +580,23 @@ class FlightServiceImpl : public FlightService::Service {
                                                           "No data in this flight"));
     }
 
+    // Send message bodies through shared memory if a client on this host
+    // asked for it; this is announced in the initial metadata. The server is
+    // done with the files when the exporter is destroyed, before data_stream.
+    std::unique_ptr<internal::SharedMemoryExporter> shared_memory;
+    if (shared_memory_) {
+      const auto& client_metadata = context->client_metadata();
+      const auto request = client_metadata.find(internal::kSharedMemoryHeader);
+      if (request != client_metadata.end() &&
+          internal::AcceptSharedMemoryRequest(
+              context->peer(),
+              std::string(request->second.data(), request->second.length()))) {
+        shared_memory.reset(new internal::SharedMemoryExporter);
+        context->AddInitialMetadata(internal::kSharedMemoryHeader,
+                                    shared_memory->token());
+      }
+    }
+
     // Write the schema as the first message in the stream
     FlightPayload schema_payload;
     SERVICE_RETURN_NOT_OK(flight_context, data_stream->GetSchemaPayload(&schema_payload));
@@ -506,11 +609,15 @@ class FlightServiceImpl : public FlightService::Service {
     while (true) {
       FlightPayload payload;
       SERVICE_RETURN_NOT_OK(flight_context, data_stream->Next(&payload));
-      if (payload.ipc_message.metadata == nullptr ||
-          !internal::WritePayload(payload, writer))
-        // No more messages to write, or connection terminated for some other
-        // reason
-        break;
+      if (payload.ipc_message.metadata == nullptr) break;
+      if (shared_memory) {
+        SERVICE_RETURN_NOT_OK(flight_context,
+                              shared_memory->Export(&payload.ipc_message));
+      }
+      if (!internal::WritePayload(payload, writer)) {
+        // Connection terminated for some other reason
+        RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
+      }
     }
     RETURN_WITH_MIDDLEWARE(flight_context, grpc::Status::OK);
   }
@@ -520,8 +627,9 @@ class FlightServiceImpl : public FlightService::Service {
     GrpcServerCallContext flight_context;
     GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoPut, context, flight_context));
 
-    auto message_reader =
-        std::unique_ptr<FlightMessageReaderImpl>(new FlightMessageReaderImpl(reader));
+    using ReaderImpl =
+        FlightMessageReaderImpl<grpc::ServerReaderWriter<pb::PutResult, pb::FlightData>>;
+    auto message_reader = std::unique_ptr<ReaderImpl>(new ReaderImpl(reader));
     SERVICE_RETURN_NOT_OK(flight_context, message_reader->Init());
     auto metadata_writer =
         std::unique_ptr<FlightMetadataWriter>(new GrpcMetadataWriter(reader));
@@ -530,6 +638,22 @@ class FlightServiceImpl : public FlightService::Service {
                                           std::move(metadata_writer)));
   }
 
+  grpc::Status DoExchange(
+      ServerContext* context,
+      grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>* stream) {
+    GrpcServerCallContext flight_context;
+    GRPC_RETURN_NOT_GRPC_OK(CheckAuth(FlightMethod::DoExchange, context, flight_context));
+
+    using ReaderImpl =
+        FlightMessageReaderImpl<grpc::ServerReaderWriter<pb::FlightData, pb::FlightData>>;
+    auto message_reader = std::unique_ptr<FlightMessageReader>(new ReaderImpl(stream));
+    auto message_writer =
+        std::unique_ptr<FlightMessageWriter>(new GrpcMessageWriter(stream));
+    RETURN_WITH_MIDDLEWARE(flight_context,
+                           server_->DoExchange(flight_context, std::move(message_reader),
+                                               std::move(message_writer)));
+  }
+
   grpc::Status ListActions(ServerContext* context, const pb::Empty* request,
                            ServerWriter<pb::ActionType>* writer) {
     GrpcServerCallContext flight_context;
@@ -579,12 +703,19 @@ class FlightServiceImpl : public FlightService::Service {
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware_;
   FlightServerBase* server_;
+  bool shared_memory_;
 };
 
 }  // namespace
 
 FlightMetadataWriter::~FlightMetadataWriter() = default;
 
+FlightMessageWriter::~FlightMessageWriter() = default;
+
+Status FlightMessageWriter::WriteRecordBatch(const RecordBatch& batch) {
+  return WriteWithMetadata(batch, nullptr);
+}
+
 //
 // gRPC server lifecycle
 //
@@ -635,7 +766,7 @@ thread_local std::atomic<FlightServerBase::Impl*>
 #endif
 
 FlightServerOptions::FlightServerOptions(const Location& location_)
-    : location(location_), auth_handler(nullptr) {}
+    : location(location_), auth_handler(nullptr), shared_memory(false) {}
 
 FlightServerOptions::~FlightServerOptions() = default;
 
@@ -645,7 +776,8 @@ FlightServerBase::~FlightServerBase() {}
 
 Status FlightServerBase::Init(const FlightServerOptions& options) {
   impl_->service_.reset(
-      new FlightServiceImpl(options.auth_handler, options.middleware, this));
+      new FlightServiceImpl(options.auth_handler, options.middleware, this,
+                            options.shared_memory));
 
   grpc::ServerBuilder builder;
   // Allow uploading messages of any length
@@ -770,6 +902,12 @@ Status FlightServerBase::DoPut(const ServerCallContext& context,
   return Status::NotImplemented("NYI");
 }
 
+Status FlightServerBase::DoExchange(const ServerCallContext& context,
+                                    std::unique_ptr<FlightMessageReader> reader,
+                                    std::unique_ptr<FlightMessageWriter> writer) {
+  return Status::NotImplemented("NYI");
+}
+
 Status FlightServerBase::DoAction(const ServerCallContext& context, const Action& action,
                                   std::unique_ptr<ResultStream>* result) {
   return Status::NotImplemented("NYI");
@@ -871,6 +1009,113 @@ class RecordBatchStream::RecordBatchStreamImpl {
   int dictionary_index_ = 0;
 };
 
+// ----------------------------------------------------------------------
+// Implement PrefetchingFlightDataStream
+
+class PrefetchingFlightDataStream::PrefetchingFlightDataStreamImpl {
+ public:
+  PrefetchingFlightDataStreamImpl(std::unique_ptr<FlightDataStream> stream,
+                                  int32_t max_payloads, int64_t max_bytes)
+      : stream_(std::move(stream)),
+        max_payloads_(std::max<int32_t>(max_payloads, 1)),
+        max_bytes_(max_bytes) {}
+
+  ~PrefetchingFlightDataStreamImpl() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      please_shutdown_ = true;
+    }
+    payload_consumed_.notify_one();
+    if (thread_.joinable()) {
+      thread_.join();
+    }
+  }
+
+  std::shared_ptr<Schema> schema() { return stream_->schema(); }
+
+  Status GetSchemaPayload(FlightPayload* payload) {
+    // The schema payload may update the state of the wrapped stream (e.g.
+    // collect dictionaries), hence prefetching only starts afterwards
+    DCHECK(!thread_.joinable());
+    RETURN_NOT_OK(stream_->GetSchemaPayload(payload));
+    Start();
+    return Status::OK();
+  }
+
+  Status Next(FlightPayload* payload) {
+    Start();
+    std::unique_lock<std::mutex> lock(mutex_);
+    payload_produced_.wait(lock, [this]() { return !payloads_.empty() || finished_; });
+    if (payloads_.empty()) {
+      RETURN_NOT_OK(status_);
+      // Signal that iteration is over
+      payload->ipc_message.metadata = nullptr;
+      return Status::OK();
+    }
+    *payload = std::move(payloads_.front());
+    payloads_.pop_front();
+    bytes_ -= PayloadSize(*payload);
+    lock.unlock();
+    payload_consumed_.notify_one();
+    return Status::OK();
+  }
+
+ private:
+  static int64_t PayloadSize(const FlightPayload& payload) {
+    int64_t size = payload.ipc_message.body_length;
+    if (payload.ipc_message.metadata) size += payload.ipc_message.metadata->size();
+    if (payload.app_metadata) size += payload.app_metadata->size();
+    return size;
+  }
+
+  void Start() {
+    if (!thread_.joinable()) {
+      thread_ = std::thread([this]() { DoWork(); });
+    }
+  }
+
+  void DoWork() {
+    while (true) {
+      FlightPayload payload;
+      Status st = stream_->Next(&payload);
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!st.ok() || payload.ipc_message.metadata == nullptr) {
+        status_ = std::move(st);
+        finished_ = true;
+        lock.unlock();
+        payload_produced_.notify_one();
+        return;
+      }
+      bytes_ += PayloadSize(payload);
+      payloads_.push_back(std::move(payload));
+      payload_produced_.notify_one();
+      // Wait for room for the next payload
+      payload_consumed_.wait(lock, [this]() {
+        return please_shutdown_ ||
+               (static_cast<int32_t>(payloads_.size()) < max_payloads_ &&
+                bytes_ < max_bytes_);
+      });
+      if (please_shutdown_) {
+        return;
+      }
+    }
+  }
+
+  std::unique_ptr<FlightDataStream> stream_;
+  const int32_t max_payloads_;
+  const int64_t max_bytes_;
+
+  std::mutex mutex_;
+  std::condition_variable payload_produced_;
+  std::condition_variable payload_consumed_;
+  std::deque<FlightPayload> payloads_;
+  int64_t bytes_ = 0;
+  bool finished_ = false;
+  bool please_shutdown_ = false;
+  Status status_;
+  std::thread thread_;
+};
+
 FlightDataStream::~FlightDataStream() {}
 
 RecordBatchStream::RecordBatchStream(const std::shared_ptr<RecordBatchReader>& reader,
@@ -888,5 +1133,23 @@ Status RecordBatchStream::GetSchemaPayload(FlightPayload* payload) {
 
 Status RecordBatchStream::Next(FlightPayload* payload) { return impl_->Next(payload); }
 
+PrefetchingFlightDataStream::PrefetchingFlightDataStream(
+    std::unique_ptr<FlightDataStream> stream, int32_t max_payloads, int64_t max_bytes) {
+  impl_.reset(
+      new PrefetchingFlightDataStreamImpl(std::move(stream), max_payloads, max_bytes));
+}
+
+PrefetchingFlightDataStream::~PrefetchingFlightDataStream() {}
+
+std::shared_ptr<Schema> PrefetchingFlightDataStream::schema() { return impl_->schema(); }
+
+Status PrefetchingFlightDataStream::GetSchemaPayload(FlightPayload* payload) {
+  return impl_->GetSchemaPayload(payload);
+}
+
+Status PrefetchingFlightDataStream::Next(FlightPayload* payload) {
+  return impl_->Next(payload);
+}
+
 }  // namespace flight
 }  // namespace arrow
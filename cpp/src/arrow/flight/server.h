@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
@@ -79,6 +80,34 @@ class ARROW_FLIGHT_EXPORT RecordBatchStream : public FlightDataStream {
   std::unique_ptr<RecordBatchStreamImpl> impl_;
 };
 
+/// \brief A FlightDataStream computing the payloads of another stream
+/// ahead of time on a background thread, so that producing them (e.g.
+/// reading and serializing record batches) overlaps with sending them.
+///
+/// The wrapped stream's Next is only called from the background thread,
+/// once GetSchemaPayload was called or when the first payload is needed.
+/// An error of the wrapped stream is returned after the payloads computed
+/// before it.
+class ARROW_FLIGHT_EXPORT PrefetchingFlightDataStream : public FlightDataStream {
+ public:
+  /// \param[in] stream the stream to prefetch the payloads of
+  /// \param[in] max_payloads the maximum number of payloads computed ahead
+  /// \param[in] max_bytes the size of payloads (metadata and body) computed
+  /// ahead beyond which prefetching pauses; one payload is always prefetched
+  explicit PrefetchingFlightDataStream(std::unique_ptr<FlightDataStream> stream,
+                                       int32_t max_payloads = 8,
+                                       int64_t max_bytes = 64 << 20);
+  ~PrefetchingFlightDataStream() override;
+
+  std::shared_ptr<Schema> schema() override;
+  Status GetSchemaPayload(FlightPayload* payload) override;
+  Status Next(FlightPayload* payload) override;
+
+ private:
+  class PrefetchingFlightDataStreamImpl;
+  std::unique_ptr<PrefetchingFlightDataStreamImpl> impl_;
+};
+
 /// \brief A reader for IPC payloads uploaded by a client. Also allows
 /// reading application-defined metadata via the Flight protocol.
 class ARROW_FLIGHT_EXPORT FlightMessageReader : public MetadataRecordBatchReader {
@@ -96,6 +125,24 @@ class ARROW_FLIGHT_EXPORT FlightMetadataWriter {
   virtual Status WriteMetadata(const Buffer& app_metadata) = 0;
 };
 
+/// \brief A writer for IPC payloads to a client, along with
+/// application-defined metadata. Used to answer a DoExchange call.
+class ARROW_FLIGHT_EXPORT FlightMessageWriter {
+ public:
+  virtual ~FlightMessageWriter();
+  /// \brief Send the schema of the stream to the client. This must be
+  /// called once before writing record batches.
+  virtual Status Begin(const std::shared_ptr<Schema>& schema) = 0;
+  /// \brief Send a record batch to the client.
+  virtual Status WriteRecordBatch(const RecordBatch& batch);
+  /// \brief Send a record batch along with application metadata
+  /// (which may be null) to the client.
+  virtual Status WriteWithMetadata(const RecordBatch& batch,
+                                   std::shared_ptr<Buffer> app_metadata) = 0;
+  /// \brief Set the memory pool used to serialize record batches.
+  virtual void set_memory_pool(MemoryPool* pool) = 0;
+};
+
 /// \brief Call state/contextual data.
 class ARROW_FLIGHT_EXPORT ServerCallContext {
  public:
@@ -130,6 +177,13 @@ class ARROW_FLIGHT_EXPORT FlightServerOptions {
   std::vector<std::pair<std::string, std::shared_ptr<ServerMiddlewareFactory>>>
       middleware;
 
+  /// \brief Whether to send the record batches of DoGet streams through
+  /// shared memory to the clients asking for it (see
+  /// FlightClientOptions::shared_memory). Only clients connecting through a
+  /// Unix socket or the loopback interface as the same user are served this
+  /// way. Unsupported platforms ignore this.
+  bool shared_memory;
+
   /// \brief A Flight implementation-specific callback to customize
   /// transport-specific options.
   ///
@@ -233,6 +287,20 @@ class ARROW_FLIGHT_EXPORT FlightServerBase {
                        std::unique_ptr<FlightMessageReader> reader,
                        std::unique_ptr<FlightMetadataWriter> writer);
 
+  /// \brief Exchange streams of IPC payloads with a client, e.g. to
+  /// transform uploaded record batches as they arrive
+  ///
+  /// Reading the descriptor, schema or data from the reader blocks until
+  /// the client has sent its first record batch. The client only gets data
+  /// once Begin() was called on the writer.
+  /// \param[in] context The call context.
+  /// \param[in] reader a sequence of uploaded record batches
+  /// \param[in] writer send record batches back to the client
+  /// \return Status
+  virtual Status DoExchange(const ServerCallContext& context,
+                            std::unique_ptr<FlightMessageReader> reader,
+                            std::unique_ptr<FlightMessageWriter> writer);
+
   /// \brief Execute an action, return stream of zero or more results
   /// \param[in] context The call context.
   /// \param[in] action the action to execute, with type and body
@@ -0,0 +1,289 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/flight/shared_memory_internal.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <random>
+#include <sstream>
+#include <string>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#include "arrow/buffer.h"
+#include "arrow/io/file.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/io_util.h"
+#include "arrow/util/macros.h"
+#include "arrow/util/string_view.h"
+
+namespace arrow {
+namespace flight {
+namespace internal {
+
+const char* kSharedMemoryHeader = "x-arrow-flight-shared-memory";
+
+namespace {
+
+// Files are created in a tmpfs mount, so that their pages are only in memory
+constexpr char kSharedMemoryDirectory[] = "/dev/shm/";
+constexpr char kFilePrefix[] = "arrow-flight-";
+constexpr size_t kRandomDigits = 16;
+
+// Description layout, little-endian: body size (int64), file name size
+// (int32), then the file name
+constexpr size_t kDescriptionHeaderSize = 8 + 4;
+
+Status DeleteFile(const std::string& path) {
+  ARROW_ASSIGN_OR_RAISE(auto file_name,
+                        ::arrow::internal::PlatformFilename::FromString(path));
+  return ::arrow::internal::DeleteFile(file_name).status();
+}
+
+bool IsDigits(util::string_view s) {
+  return !s.empty() && std::all_of(s.begin(), s.end(),
+                                   [](char c) { return c >= '0' && c <= '9'; });
+}
+
+// Tokens are "<pid>-<random hex digits>"; the client deletes files named
+// after them, so they must not hold anything else
+bool IsValidToken(util::string_view token) {
+  const auto dash = token.find('-');
+  if (dash == util::string_view::npos || !IsDigits(token.substr(0, dash))) {
+    return false;
+  }
+  const auto random = token.substr(dash + 1);
+  return random.size() == kRandomDigits &&
+         std::all_of(random.begin(), random.end(), [](char c) {
+           return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+         });
+}
+
+std::string FilePrefix(const std::string& token) { return kFilePrefix + token + "-"; }
+
+// Only accept the files of the call, as the importer deletes the file
+bool IsValidFileName(util::string_view name, const std::string& token) {
+  const std::string prefix = FilePrefix(token);
+  return IsValidToken(token) && name.starts_with(util::string_view(prefix)) &&
+         IsDigits(name.substr(prefix.size()));
+}
+
+#ifdef __linux__
+const uint8_t kPaddingBytes[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+
+// Names the marker file of FinishSharedMemoryCall, which is never imported
+// as it doesn't end with digits
+constexpr char kDoneMarker[] = "done";
+
+void DeleteFiles(const std::string& token) {
+  auto maybe_dir =
+      ::arrow::internal::PlatformFilename::FromString(kSharedMemoryDirectory);
+  if (!maybe_dir.ok()) return;
+  auto maybe_entries = ::arrow::internal::ListDir(*maybe_dir);
+  if (!maybe_entries.ok()) return;
+  const std::string prefix = FilePrefix(token);
+  for (const auto& entry : *maybe_entries) {
+    const std::string name = entry.ToString();
+    if (name.compare(0, prefix.size(), prefix) == 0) {
+      ARROW_UNUSED(DeleteFile(kSharedMemoryDirectory + name));
+    }
+  }
+}
+
+// File names must not be predictable, or another user could create them first
+std::string MakeToken() {
+  std::random_device device;
+  std::stringstream ss;
+  ss << getpid() << "-" << std::hex << std::setfill('0');
+  for (size_t i = 0; i < kRandomDigits / 8; ++i) {
+    ss << std::setw(8) << static_cast<uint32_t>(device());
+  }
+  return ss.str();
+}
+
+// gRPC doesn't give the credentials of the peer: only accept connections from
+// this host. A local client of another user could still send our user id, but
+// couldn't read the files.
+bool IsLocalPeer(util::string_view peer) {
+  for (const char* prefix : {"unix:", "unix-abstract:", "ipv4:127.", "ipv6:[::1]:",
+                             "ipv6:%5B::1%5D:", "ipv6:[::ffff:127.",
+                             "ipv6:%5B::ffff:127."}) {
+    if (peer.starts_with(prefix)) return true;
+  }
+  return false;
+}
+#endif
+
+}  // namespace
+
+bool SharedMemorySupported() {
+#ifdef __linux__
+  static const bool supported = [] {
+    auto maybe_dir =
+        ::arrow::internal::PlatformFilename::FromString(kSharedMemoryDirectory);
+    if (!maybe_dir.ok()) return false;
+    auto maybe_exists = ::arrow::internal::FileExists(*maybe_dir);
+    return maybe_exists.ok() && *maybe_exists;
+  }();
+  return supported;
+#else
+  return false;
+#endif
+}
+
+std::string SharedMemoryRequest() {
+#ifdef __linux__
+  return std::to_string(getuid());
+#else
+  return "";
+#endif
+}
+
+bool AcceptSharedMemoryRequest(const std::string& peer, const std::string& request) {
+#ifdef __linux__
+  return IsLocalPeer(peer) && request == std::to_string(getuid());
+#else
+  return false;
+#endif
+}
+
+SharedMemoryExporter::SharedMemoryExporter() {
+#ifdef __linux__
+  token_ = MakeToken();
+#endif
+}
+
+SharedMemoryExporter::~SharedMemoryExporter() { FinishSharedMemoryCall(token_); }
+
+Status SharedMemoryExporter::Export(ipc::internal::IpcPayload* payload) {
+  int64_t body_size = 0;
+  for (const auto& buffer : payload->body_buffers) {
+    if (buffer) body_size += BitUtil::RoundUpToMultipleOf8(buffer->size());
+  }
+  if (body_size == 0) {
+    return Status::OK();
+  }
+#ifdef __linux__
+  const std::string name = FilePrefix(token_) + std::to_string(num_files_++);
+  const std::string path = kSharedMemoryDirectory + name;
+  // The directory is shared with other users: never reuse an existing file,
+  // and keep the data private
+  const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+  if (fd < 0) {
+    return Status::IOError("Failed to create shared memory file '", path,
+                           "': ", std::strerror(errno));
+  }
+  // Writing the file is cheaper than mapping it, as its pages are allocated
+  // in bulk rather than faulted one by one
+  ARROW_ASSIGN_OR_RAISE(auto file, io::FileOutputStream::Open(fd));
+  for (const auto& buffer : payload->body_buffers) {
+    if (!buffer) continue;
+    // Lay the buffers out as in a serialized message body
+    RETURN_NOT_OK(file->Write(buffer->data(), buffer->size()));
+    const int64_t padding =
+        BitUtil::RoundUpToMultipleOf8(buffer->size()) - buffer->size();
+    if (padding > 0) {
+      RETURN_NOT_OK(file->Write(kPaddingBytes, padding));
+    }
+  }
+  RETURN_NOT_OK(file->Close());
+
+  std::string description(kDescriptionHeaderSize + name.size(), '\0');
+  const int64_t le_body_size = BitUtil::ToLittleEndian(body_size);
+  const int32_t le_name_size = BitUtil::ToLittleEndian(static_cast<int32_t>(name.size()));
+  std::memcpy(&description[0], &le_body_size, 8);
+  std::memcpy(&description[8], &le_name_size, 4);
+  std::memcpy(&description[kDescriptionHeaderSize], name.data(), name.size());
+
+  payload->body_buffers = {Buffer::FromString(std::move(description))};
+  payload->body_length = payload->body_buffers[0]->size();
+  return Status::OK();
+#else
+  return Status::NotImplemented("Shared memory transfers are not supported");
+#endif
+}
+
+Status ImportBodyFromSharedMemory(const std::string& token, const Buffer& description,
+                                  std::shared_ptr<Buffer>* body) {
+  // The description may be followed by the padding of the message body
+  if (description.size() < static_cast<int64_t>(kDescriptionHeaderSize)) {
+    return Status::IOError("Invalid shared memory message body");
+  }
+  int64_t body_size;
+  int32_t name_size;
+  std::memcpy(&body_size, description.data(), 8);
+  std::memcpy(&name_size, description.data() + 8, 4);
+  body_size = BitUtil::FromLittleEndian(body_size);
+  name_size = BitUtil::FromLittleEndian(name_size);
+  if (body_size <= 0 || name_size < 0 ||
+      description.size() < static_cast<int64_t>(kDescriptionHeaderSize) + name_size) {
+    return Status::IOError("Invalid shared memory message body");
+  }
+  const util::string_view name(
+      reinterpret_cast<const char*>(description.data()) + kDescriptionHeaderSize,
+      name_size);
+  if (!IsValidFileName(name, token)) {
+    return Status::IOError("Invalid shared memory file name '", name, "'");
+  }
+#ifdef __linux__
+  const std::string path = kSharedMemoryDirectory + name.to_string();
+  ARROW_ASSIGN_OR_RAISE(auto file, io::MemoryMappedFile::Open(path, io::FileMode::READ));
+  // The mapping stays valid once the file is deleted
+  Status st = DeleteFile(path);
+  if (st.ok()) {
+    ARROW_ASSIGN_OR_RAISE(int64_t size, file->GetSize());
+    if (size != body_size) {
+      st = Status::IOError("Shared memory file '", name, "' has size ", size,
+                           ", expected ", body_size);
+    }
+  }
+  if (st.ok()) {
+    // Zero-copy: the buffer keeps the memory mapped after closing the file
+    st = file->ReadAt(0, body_size).Value(body);
+  }
+  ARROW_UNUSED(file->Close());
+  return st;
+#else
+  return Status::NotImplemented("Shared memory transfers are not supported");
+#endif
+}
+
+void FinishSharedMemoryCall(const std::string& token) {
+  if (!IsValidToken(token)) return;
+#ifdef __linux__
+  // Creating the marker is atomic, so exactly one side finds it already
+  // there. If it can't be created, delete the files rather than leak them.
+  const std::string path = kSharedMemoryDirectory + FilePrefix(token) + kDoneMarker;
+  const int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+  if (fd >= 0) {
+    close(fd);
+    return;
+  }
+  DeleteFiles(token);
+#endif
+}
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -0,0 +1,107 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+// Transfer of IPC message bodies through shared memory, for clients and
+// servers running on the same host.
+//
+// A client asks for it by sending the kSharedMemoryHeader header with its
+// call. The server only accepts from local peers of the same user, by
+// sending the same header back in its initial metadata, along with a random
+// token naming the files of the call. The body of each message is then
+// written to a file in a shared memory file system, and the data_body field
+// of the FlightData message only holds the name of that file; the client
+// maps the file and deletes it. Files of messages the client doesn't read
+// are deleted by whichever side of the call is done last: the server when
+// its handler returns, or the client when it stops reading.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "arrow/ipc/writer.h"
+#include "arrow/status.h"
+#include "arrow/util/macros.h"
+
+namespace arrow {
+
+class Buffer;
+
+namespace flight {
+namespace internal {
+
+/// The header (and server initial metadata) negotiating shared memory transfers
+extern const char* kSharedMemoryHeader;
+
+/// \brief Whether shared memory transfers are available on this platform.
+bool SharedMemorySupported();
+
+/// \brief The value of the kSharedMemoryHeader header sent by clients.
+std::string SharedMemoryRequest();
+
+/// \brief Whether a server should accept a client's request for shared
+/// memory transfers.
+///
+/// \param[in] peer the gRPC URI of the client
+/// \param[in] request the value of the kSharedMemoryHeader header
+bool AcceptSharedMemoryRequest(const std::string& peer, const std::string& request);
+
+/// \brief Writes the message bodies of a call to shared memory files.
+///
+/// The server is done with the files on destruction, see
+/// FinishSharedMemoryCall.
+class SharedMemoryExporter {
+ public:
+  SharedMemoryExporter();
+  ~SharedMemoryExporter();
+
+  /// \brief The random token naming the files of the call, sent to the client
+  const std::string& token() const { return token_; }
+
+  /// \brief Write the body of an IPC payload to a new file, and replace the
+  /// body with a description of that file. Payloads without a body are left
+  /// untouched.
+  Status Export(ipc::internal::IpcPayload* payload);
+
+ private:
+  std::string token_;
+  int64_t num_files_ = 0;
+
+  ARROW_DISALLOW_COPY_AND_ASSIGN(SharedMemoryExporter);
+};
+
+/// \brief Map the shared memory file described by a message body, and
+/// delete the file. The mapping lives as long as the returned buffer.
+///
+/// \param[in] token the token sent by the server
+/// \param[in] description the message body
+/// \param[out] body the contents of the file
+Status ImportBodyFromSharedMemory(const std::string& token, const Buffer& description,
+                                  std::shared_ptr<Buffer>* body);
+
+/// \brief Mark one side of a call as done with its shared memory files.
+///
+/// Called once by the server, after its last export, and once by the client,
+/// when it stops reading. The first call creates a marker file; the second
+/// one deletes the remaining files of the call along with the marker, as
+/// neither side may still create or read them. Errors are ignored.
+void FinishSharedMemoryCall(const std::string& token);
+
+}  // namespace internal
+}  // namespace flight
+}  // namespace arrow
@@ -38,6 +38,18 @@ enum class UnexpectedFieldBehavior : char {
   InferType
 };
 
+/// \brief Strategies for lexing a block of JSON
+enum class ParserBackend : char {
+  /// Drive rapidjson's SAX reader
+  RapidJson,
+  /// First locate quotes, structural characters and other values 64 bytes at a
+  /// time, then walk their positions.  Gives the same results and errors as
+  /// RapidJson, except that numbers out of the range of a double are not
+  /// rejected until conversion, and that the values of fields ignored by
+  /// UnexpectedFieldBehavior::Ignore are skipped without being validated.
+  Indexed
+};
+
 struct ARROW_EXPORT ParseOptions {
   // Parsing options
 
@@ -52,6 +64,9 @@ struct ARROW_EXPORT ParseOptions {
   /// How JSON fields outside of explicit_schema (if given) are treated
   UnexpectedFieldBehavior unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
 
+  /// How blocks of JSON are lexed
+  ParserBackend backend = ParserBackend::RapidJson;
+
   /// Create parsing options with default values
   static ParseOptions Defaults();
 };
@@ -64,6 +79,9 @@ struct ARROW_EXPORT ReadOptions {
   /// Block size we request from the IO layer; also determines the size of
   /// chunks when use_threads is true
   int32_t block_size = 1 << 20;  // 1 MB
+  /// Number of blocks a StreamingReader may read and parse ahead of the
+  /// consumer when use_threads is true
+  int32_t readahead_blocks = 4;
 
   /// Create read options with default values
   static ReadOptions Defaults();
@@ -17,8 +17,11 @@
 
 #include "arrow/json/parser.h"
 
+#include <algorithm>
+#include <cstring>
 #include <functional>
 #include <limits>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
@@ -33,6 +36,7 @@
 #include "arrow/builder.h"
 #include "arrow/memory_pool.h"
 #include "arrow/type.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/make_unique.h"
 #include "arrow/util/string_view.h"
@@ -564,6 +568,722 @@ class RawBuilderSet {
       arenas_;
 };
 
+namespace {
+
+constexpr int64_t kIndexBlockSize = 64;
+
+// Bitmasks of the characters of a 64-byte block which are significant to the
+// structure of JSON
+struct CharacterMasks {
+  uint64_t quotes;
+  uint64_t backslashes;
+  // {}[]:,
+  uint64_t operators;
+  uint64_t whitespace;
+  // Characters below 0x20, which may not appear unescaped in strings
+  uint64_t controls;
+};
+
+#if defined(ARROW_HAVE_SSE2)
+
+inline CharacterMasks ClassifyBlock(const char* data) {
+  CharacterMasks masks = {0, 0, 0, 0, 0};
+  for (int i = 0; i < 4; ++i) {
+    const __m128i chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data) + i);
+    auto match = [&](char c) { return _mm_cmpeq_epi8(chunk, _mm_set1_epi8(c)); };
+    auto bits = [&](__m128i matches) {
+      return static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(matches)))
+             << (16 * i);
+    };
+    // Setting bit 0x20 maps '[' and ']' to '{' and '}'
+    const __m128i folded = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+    const __m128i brackets = _mm_or_si128(_mm_cmpeq_epi8(folded, _mm_set1_epi8('{')),
+                                          _mm_cmpeq_epi8(folded, _mm_set1_epi8('}')));
+    masks.quotes |= bits(match('"'));
+    masks.backslashes |= bits(match('\\'));
+    masks.operators |=
+        bits(_mm_or_si128(brackets, _mm_or_si128(match(':'), match(','))));
+    masks.whitespace |= bits(_mm_or_si128(_mm_or_si128(match(' '), match('\t')),
+                                          _mm_or_si128(match('\n'), match('\r'))));
+    masks.controls |= bits(_mm_cmpeq_epi8(_mm_subs_epu8(chunk, _mm_set1_epi8(0x1f)),
+                                          _mm_setzero_si128()));
+  }
+  return masks;
+}
+
+#else
+
+inline CharacterMasks ClassifyBlock(const char* data) {
+  CharacterMasks masks = {0, 0, 0, 0, 0};
+  for (int i = 0; i < kIndexBlockSize; ++i) {
+    const uint64_t bit = uint64_t(1) << i;
+    switch (data[i]) {
+      case '"':
+        masks.quotes |= bit;
+        break;
+      case '\\':
+        masks.backslashes |= bit;
+        break;
+      case '{':
+      case '}':
+      case '[':
+      case ']':
+      case ':':
+      case ',':
+        masks.operators |= bit;
+        break;
+      case ' ':
+      case '\t':
+      case '\n':
+      case '\r':
+        masks.whitespace |= bit;
+        break;
+      default:
+        break;
+    }
+    if (static_cast<uint8_t>(data[i]) < 0x20) {
+      masks.controls |= bit;
+    }
+  }
+  return masks;
+}
+
+#endif
+
+// Compute the mask of characters preceded by an odd number of backslashes.
+// *escape_carry is 1 if the first character of the block is escaped by the
+// previous block, and is updated for the next block.
+inline uint64_t FindEscaped(uint64_t backslashes, uint64_t* escape_carry) {
+  constexpr uint64_t kOddBits = 0xAAAAAAAAAAAAAAAAULL;
+  if (backslashes == 0) {
+    const uint64_t escaped = *escape_carry;
+    *escape_carry = 0;
+    return escaped;
+  }
+  // An escaped backslash cannot start an escape.  Subtracting each run of
+  // potential escapes from the odd bits marks where the run ends, and whether
+  // it has even or odd length.
+  const uint64_t potential_escapes = backslashes & ~*escape_carry;
+  const uint64_t codes = ((potential_escapes << 1) | kOddBits) - potential_escapes;
+  const uint64_t escapes_and_terminals = codes ^ kOddBits;
+  const uint64_t escaped = escapes_and_terminals ^ (backslashes | *escape_carry);
+  *escape_carry = (escapes_and_terminals & backslashes) >> 63;
+  return escaped;
+}
+
+// For each bit, compute the xor of all bits up to and including it
+inline uint64_t PrefixXor(uint64_t bits) {
+  bits ^= bits << 1;
+  bits ^= bits << 2;
+  bits ^= bits << 4;
+  bits ^= bits << 8;
+  bits ^= bits << 16;
+  bits ^= bits << 32;
+  return bits;
+}
+
+inline uint32_t* WritePositions(uint64_t bits, uint32_t base, uint32_t* out) {
+  while (bits != 0) {
+    *out++ = base + BitUtil::CountTrailingZeros(bits);
+    bits &= bits - 1;
+  }
+  return out;
+}
+
+inline bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+inline bool IsHexDigit(char c) {
+  return IsDigit(c) || (c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F');
+}
+
+// Whether a character continues a literal or number
+inline bool IsScalarChar(char c) {
+  switch (c) {
+    case ' ':
+    case '\t':
+    case '\n':
+    case '\r':
+    case '{':
+    case '}':
+    case '[':
+    case ']':
+    case ':':
+    case ',':
+    case '"':
+      return false;
+    default:
+      return true;
+  }
+}
+
+}  // namespace
+
+/// \brief A reader of JSON documents from a structural index
+///
+/// The block is first classified 64 bytes at a time into bitmasks, from which
+/// the positions of structural characters, quotes and the first character of
+/// other values are collected (see Langdale & Lemire, "Parsing Gigabytes of JSON
+/// per Second").  Documents are then read by walking those positions, emitting
+/// the same events to the handler as rj::Reader.  The grammar and error codes
+/// mirror those of rj::Reader's iterative parser with the flags used by
+/// HandlerBase::DoParse.
+class IndexedReader {
+ public:
+  Status Index(const char* data, int64_t size) {
+    if (size > std::numeric_limits<uint32_t>::max() - kIndexBlockSize) {
+      return Status::Invalid("JSON block too large to index");
+    }
+    data_ = data;
+    end_ = data + size;
+    // There is at most one position per character
+    const int64_t max_positions = size + kIndexBlockSize + 1;
+    structurals_.resize(std::min<int64_t>(max_positions, size / 4 + kIndexBlockSize));
+    specials_.resize(kIndexBlockSize + 1);
+
+    uint32_t num_structurals = 0;
+    uint32_t num_specials = 0;
+    uint64_t escape_carry = 0;
+    uint64_t string_carry = 0;
+    uint64_t scalar_carry = 0;
+    char tail[kIndexBlockSize];
+    for (int64_t offset = 0; offset < size; offset += kIndexBlockSize) {
+      const char* block = data + offset;
+      if (size - offset < kIndexBlockSize) {
+        // Pad the last block with whitespace
+        std::memset(tail, ' ', kIndexBlockSize);
+        std::memcpy(tail, block, static_cast<size_t>(size - offset));
+        block = tail;
+      }
+      const CharacterMasks masks = ClassifyBlock(block);
+      const uint64_t quotes =
+          masks.quotes & ~FindEscaped(masks.backslashes, &escape_carry);
+      // Strings span from their opening quote to just before their closing quote
+      const uint64_t strings = PrefixXor(quotes) ^ string_carry;
+      string_carry = static_cast<uint64_t>(static_cast<int64_t>(strings) >> 63);
+      const uint64_t scalars = ~(masks.operators | masks.whitespace | quotes | strings);
+      const uint64_t scalar_starts = scalars & ~((scalars << 1) | scalar_carry);
+      scalar_carry = scalars >> 63;
+
+      const uint64_t structurals = (masks.operators & ~strings) | quotes | scalar_starts;
+      const uint64_t specials = (masks.backslashes | masks.controls) & strings;
+      if (static_cast<int64_t>(structurals_.size()) < num_structurals + kIndexBlockSize) {
+        structurals_.resize(std::min<int64_t>(max_positions, 2 * structurals_.size()));
+      }
+      num_structurals = static_cast<uint32_t>(
+          WritePositions(structurals, static_cast<uint32_t>(offset),
+                         structurals_.data() + num_structurals) -
+          structurals_.data());
+      if (ARROW_PREDICT_FALSE(specials != 0)) {
+        if (static_cast<int64_t>(specials_.size()) < num_specials + kIndexBlockSize + 1) {
+          specials_.resize(std::min<int64_t>(max_positions, 2 * specials_.size()));
+        }
+        num_specials = static_cast<uint32_t>(
+            WritePositions(specials, static_cast<uint32_t>(offset),
+                           specials_.data() + num_specials) -
+            specials_.data());
+      }
+    }
+    num_structurals_ = num_structurals;
+    specials_[num_specials] = std::numeric_limits<uint32_t>::max();
+    next_structural_ = 0;
+    next_special_ = 0;
+    pending_ = NULLPTR;
+    return Status::OK();
+  }
+
+  /// \brief Read one document, like rj::Reader::Parse
+  ///
+  /// Returns kParseErrorDocumentEmpty once all documents have been read.
+  template <typename Handler>
+  rj::ParseErrorCode Parse(Handler& handler) {
+    State state = kStart;
+    containers_.clear();
+    while (true) {
+      const char* token = NextToken();
+      // As rj::Reader, stop at a NUL character
+      const char c = token == NULLPTR ? '\0' : *token;
+      if (c == '\0') {
+        return Error(state);
+      }
+
+      switch (state) {
+        case kObjectInitial:
+        case kMemberDelimiter:
+          if (c == '"') {
+            string_view key;
+            auto code = ParseString(token, &key);
+            if (code != rj::kParseErrorNone) {
+              return code;
+            }
+            if (!handler.Key(key.data(), static_cast<rj::SizeType>(key.size()), true)) {
+              return rj::kParseErrorTermination;
+            }
+            skip_value_ = handler.SkipsValue();
+            state = kMemberKey;
+            continue;
+          }
+          if (c != '}' || state != kObjectInitial) {
+            return Error(state);
+          }
+          containers_.pop_back();
+          if (!handler.EndObject(0)) {
+            return rj::kParseErrorTermination;
+          }
+          break;
+
+        case kMemberKey:
+          if (c != ':') {
+            return Error(state);
+          }
+          if (skip_value_) {
+            auto code = SkipValue();
+            if (code != rj::kParseErrorNone) {
+              return code;
+            }
+            break;
+          }
+          state = kKeyValueDelimiter;
+          continue;
+
+        case kMemberValue:
+          if (c == ',') {
+            state = kMemberDelimiter;
+            continue;
+          }
+          if (c != '}') {
+            return Error(state);
+          }
+          if (!handler.EndObject(PopContainer())) {
+            return rj::kParseErrorTermination;
+          }
+          break;
+
+        case kElement:
+          if (c == ',') {
+            state = kElementDelimiter;
+            continue;
+          }
+          if (c != ']') {
+            return Error(state);
+          }
+          if (!handler.EndArray(PopContainer())) {
+            return rj::kParseErrorTermination;
+          }
+          break;
+
+        case kArrayInitial:
+          if (c == ']') {
+            containers_.pop_back();
+            if (!handler.EndArray(0)) {
+              return rj::kParseErrorTermination;
+            }
+            break;
+          }
+          // fall through
+
+        default:
+          // a value is expected
+          switch (c) {
+            case '{':
+              if (!handler.StartObject()) {
+                return rj::kParseErrorTermination;
+              }
+              containers_.push_back({true, 0});
+              state = kObjectInitial;
+              continue;
+            case '[':
+              if (!handler.StartArray()) {
+                return rj::kParseErrorTermination;
+              }
+              containers_.push_back({false, 0});
+              state = kArrayInitial;
+              continue;
+            case '}':
+            case ']':
+            case ':':
+            case ',':
+              return Error(state);
+            default: {
+              auto code = ParseScalar(handler, token);
+              if (code != rj::kParseErrorNone) {
+                return code;
+              }
+              break;
+            }
+          }
+          break;
+      }
+
+      // a value was completed
+      if (containers_.empty()) {
+        return rj::kParseErrorNone;
+      }
+      ++containers_.back().size;
+      state = containers_.back().is_object ? kMemberValue : kElement;
+    }
+  }
+
+ private:
+  // The states of rj::Reader's iterative parser
+  enum State {
+    kStart,
+    kObjectInitial,
+    kMemberKey,
+    kKeyValueDelimiter,
+    kMemberValue,
+    kMemberDelimiter,
+    kArrayInitial,
+    kElement,
+    kElementDelimiter,
+  };
+
+  struct Container {
+    bool is_object;
+    rj::SizeType size;
+  };
+
+  // The error raised by rj::Reader on an unexpected character in a given state
+  static rj::ParseErrorCode Error(State state) {
+    switch (state) {
+      case kStart:
+        return rj::kParseErrorDocumentEmpty;
+      case kObjectInitial:
+      case kMemberDelimiter:
+        return rj::kParseErrorObjectMissName;
+      case kMemberKey:
+        return rj::kParseErrorObjectMissColon;
+      case kMemberValue:
+        return rj::kParseErrorObjectMissCommaOrCurlyBracket;
+      case kElement:
+        return rj::kParseErrorArrayMissCommaOrSquareBracket;
+      default:
+        return rj::kParseErrorValueInvalid;
+    }
+  }
+
+  rj::SizeType PopContainer() {
+    auto size = containers_.back().size;
+    containers_.pop_back();
+    return size;
+  }
+
+  // Skip a value without emitting events for it.  Only its extent is checked.
+  rj::ParseErrorCode SkipValue() {
+    int depth = 0;
+    do {
+      const char* token = NextToken();
+      const char c = token == NULLPTR ? '\0' : *token;
+      switch (c) {
+        case '\0':
+          return depth == 0 ? rj::kParseErrorValueInvalid
+                            : rj::kParseErrorUnspecificSyntaxError;
+        case '{':
+        case '[':
+          ++depth;
+          break;
+        case '}':
+        case ']':
+          if (--depth < 0) {
+            return rj::kParseErrorValueInvalid;
+          }
+          break;
+        case ':':
+        case ',':
+          if (depth == 0) {
+            return rj::kParseErrorValueInvalid;
+          }
+          break;
+        case '"':
+          // skip the closing quote
+          if (next_structural_ == num_structurals_) {
+            return rj::kParseErrorStringMissQuotationMark;
+          }
+          ++next_structural_;
+          break;
+        default:
+          break;
+      }
+    } while (depth > 0);
+    return rj::kParseErrorNone;
+  }
+
+  // Return the first character of the next token, or null at the end of the block
+  const char* NextToken() {
+    if (pending_ != NULLPTR) {
+      const char* token = pending_;
+      pending_ = NULLPTR;
+      return token;
+    }
+    if (next_structural_ == num_structurals_) {
+      return NULLPTR;
+    }
+    return data_ + structurals_[next_structural_++];
+  }
+
+  // Only the first character of a literal or number is indexed, any characters
+  // following its valid prefix form the next token
+  void FinishScalar(const char* end) {
+    if (end < end_ && IsScalarChar(*end)) {
+      pending_ = end;
+    }
+  }
+
+  char At(const char* p) const { return p < end_ ? *p : '\0'; }
+
+  template <typename Handler>
+  rj::ParseErrorCode ParseScalar(Handler& handler, const char* token) {
+    bool ok;
+    switch (*token) {
+      case '"': {
+        string_view value;
+        auto code = ParseString(token, &value);
+        if (code != rj::kParseErrorNone) {
+          return code;
+        }
+        ok = handler.String(value.data(), static_cast<rj::SizeType>(value.size()), true);
+        break;
+      }
+      case 't':
+        if (!ParseLiteral(token, "true")) {
+          return rj::kParseErrorValueInvalid;
+        }
+        ok = handler.Bool(true);
+        break;
+      case 'f':
+        if (!ParseLiteral(token, "false")) {
+          return rj::kParseErrorValueInvalid;
+        }
+        ok = handler.Bool(false);
+        break;
+      case 'n':
+        if (!ParseLiteral(token, "null")) {
+          return rj::kParseErrorValueInvalid;
+        }
+        ok = handler.Null();
+        break;
+      default: {
+        string_view number;
+        auto code = ParseNumber(token, &number);
+        if (code != rj::kParseErrorNone) {
+          return code;
+        }
+        ok = handler.RawNumber(number.data(), static_cast<rj::SizeType>(number.size()),
+                               true);
+        break;
+      }
+    }
+    return ok ? rj::kParseErrorNone : rj::kParseErrorTermination;
+  }
+
+  bool ParseLiteral(const char* token, const char* literal) {
+    const auto length = static_cast<int64_t>(std::strlen(literal));
+    if (end_ - token < length || std::memcmp(token, literal, length) != 0) {
+      return false;
+    }
+    FinishScalar(token + length);
+    return true;
+  }
+
+  rj::ParseErrorCode ParseNumber(const char* token, string_view* out) {
+    const char* p = token;
+    if (At(p) == '-') {
+      ++p;
+    }
+    if (At(p) == 'N') {
+      if (At(p + 1) != 'a' || At(p + 2) != 'N') {
+        return rj::kParseErrorValueInvalid;
+      }
+      p += 3;
+    } else if (At(p) == 'I') {
+      if (At(p + 1) != 'n' || At(p + 2) != 'f') {
+        return rj::kParseErrorValueInvalid;
+      }
+      p += 3;
+      if (At(p) == 'i') {
+        if (end_ - p < 5 || std::memcmp(p, "inity", 5) != 0) {
+          return rj::kParseErrorValueInvalid;
+        }
+        p += 5;
+      }
+    } else {
+      if (At(p) == '0') {
+        ++p;
+      } else if (IsDigit(At(p))) {
+        while (IsDigit(At(++p))) {
+        }
+      } else {
+        return rj::kParseErrorValueInvalid;
+      }
+      if (At(p) == '.') {
+        if (!IsDigit(At(++p))) {
+          return rj::kParseErrorNumberMissFraction;
+        }
+        while (IsDigit(At(++p))) {
+        }
+      }
+      if (At(p) == 'e' || At(p) == 'E') {
+        ++p;
+        if (At(p) == '+' || At(p) == '-') {
+          ++p;
+        }
+        if (!IsDigit(At(p))) {
+          return rj::kParseErrorNumberMissExponent;
+        }
+        while (IsDigit(At(++p))) {
+        }
+      }
+    }
+    FinishScalar(p);
+    *out = string_view(token, p - token);
+    return rj::kParseErrorNone;
+  }
+
+  // Parse the string opened by the quote at `open`, whose closing quote is the
+  // next indexed position
+  rj::ParseErrorCode ParseString(const char* open, string_view* out) {
+    const auto open_offset = static_cast<uint32_t>(open - data_);
+    while (specials_[next_special_] < open_offset) {
+      ++next_special_;
+    }
+    if (next_structural_ < num_structurals_) {
+      const uint32_t close_offset = structurals_[next_structural_];
+      if (specials_[next_special_] > close_offset) {
+        // no escapes or control characters, refer to the block directly
+        ++next_structural_;
+        *out = string_view(open + 1, close_offset - open_offset - 1);
+        return rj::kParseErrorNone;
+      }
+    }
+    return UnescapeString(open, out);
+  }
+
+  rj::ParseErrorCode UnescapeString(const char* open, string_view* out) {
+    unescaped_.clear();
+    const char* p = open + 1;
+    while (true) {
+      const char c = At(p);
+      if (c == '"') {
+        break;
+      }
+      if (c == '\\') {
+        const char escaped = At(p + 1);
+        p += 2;
+        switch (escaped) {
+          case '"':
+          case '\\':
+          case '/':
+            unescaped_.push_back(escaped);
+            break;
+          case 'b':
+            unescaped_.push_back('\b');
+            break;
+          case 'f':
+            unescaped_.push_back('\f');
+            break;
+          case 'n':
+            unescaped_.push_back('\n');
+            break;
+          case 'r':
+            unescaped_.push_back('\r');
+            break;
+          case 't':
+            unescaped_.push_back('\t');
+            break;
+          case 'u': {
+            uint32_t codepoint;
+            if (!ParseHex4(&p, &codepoint)) {
+              return rj::kParseErrorStringUnicodeEscapeInvalidHex;
+            }
+            if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+              // a UTF-16 surrogate pair
+              if (At(p) != '\\' || At(p + 1) != 'u') {
+                return rj::kParseErrorStringUnicodeSurrogateInvalid;
+              }
+              p += 2;
+              uint32_t low;
+              if (!ParseHex4(&p, &low)) {
+                return rj::kParseErrorStringUnicodeEscapeInvalidHex;
+              }
+              if (low < 0xDC00 || low > 0xDFFF) {
+                return rj::kParseErrorStringUnicodeSurrogateInvalid;
+              }
+              codepoint = (((codepoint - 0xD800) << 10) | (low - 0xDC00)) + 0x10000;
+            }
+            AppendUtf8(codepoint);
+            break;
+          }
+          default:
+            return rj::kParseErrorStringEscapeInvalid;
+        }
+        continue;
+      }
+      if (static_cast<uint8_t>(c) < 0x20) {
+        return c == '\0' ? rj::kParseErrorStringMissQuotationMark
+                         : rj::kParseErrorStringInvalidEncoding;
+      }
+      unescaped_.push_back(c);
+      ++p;
+    }
+    // skip the closing quote
+    DCHECK(next_structural_ < num_structurals_ &&
+           data_ + structurals_[next_structural_] == p);
+    ++next_structural_;
+    *out = unescaped_;
+    return rj::kParseErrorNone;
+  }
+
+  bool ParseHex4(const char** p, uint32_t* out) const {
+    uint32_t codepoint = 0;
+    for (int i = 0; i < 4; ++i) {
+      const char c = At(*p + i);
+      if (!IsHexDigit(c)) {
+        return false;
+      }
+      const int digit = c <= '9' ? c - '0' : (c | 0x20) - 'a' + 10;
+      codepoint = (codepoint << 4) | static_cast<uint32_t>(digit);
+    }
+    *p += 4;
+    *out = codepoint;
+    return true;
+  }
+
+  void AppendUtf8(uint32_t codepoint) {
+    if (codepoint < 0x80) {
+      unescaped_.push_back(static_cast<char>(codepoint));
+    } else if (codepoint < 0x800) {
+      unescaped_.push_back(static_cast<char>(0xC0 | (codepoint >> 6)));
+      unescaped_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else if (codepoint < 0x10000) {
+      unescaped_.push_back(static_cast<char>(0xE0 | (codepoint >> 12)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    } else {
+      unescaped_.push_back(static_cast<char>(0xF0 | (codepoint >> 18)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F)));
+      unescaped_.push_back(static_cast<char>(0x80 | (codepoint & 0x3F)));
+    }
+  }
+
+  const char* data_ = NULLPTR;
+  const char* end_ = NULLPTR;
+  // Positions of operators outside strings, unescaped quotes, and the first
+  // character of literals and numbers
+  std::vector<uint32_t> structurals_;
+  uint32_t num_structurals_ = 0;
+  uint32_t next_structural_ = 0;
+  // Positions of backslashes and control characters inside strings, terminated
+  // by UINT32_MAX
+  std::vector<uint32_t> specials_;
+  uint32_t next_special_ = 0;
+  // The rest of a literal or number
+  const char* pending_ = NULLPTR;
+  // Whether the handler ignores the value of the current key
+  bool skip_value_ = false;
+  std::vector<Container> containers_;
+  std::string unescaped_;
+};
+
 /// Three implementations are provided for BlockParser, one for each
 /// UnexpectedFieldBehavior. However most of the logic is identical in each
 /// case, so the majority of the implementation is in this base class
@@ -637,8 +1357,14 @@ class HandlerBase : public BlockParser,
   }
   /// @}
 
+  /// \brief Whether the value of the last key is ignored
+  ///
+  /// If so, IndexedReader skips it without emitting any events.
+  bool SkipsValue() const { return false; }
+
   /// \brief Set up builders using an expected Schema
-  Status Initialize(const std::shared_ptr<Schema>& s) {
+  Status Initialize(const std::shared_ptr<Schema>& s, ParserBackend backend) {
+    backend_ = backend;
     auto type = struct_({});
     if (s) {
       type = struct_(s->fields());
@@ -672,17 +1398,11 @@ class HandlerBase : public BlockParser,
   }
 
  protected:
-  template <typename Handler, typename Stream>
-  Status DoParse(Handler& handler, Stream&& json) {
-    constexpr auto parse_flags = rj::kParseIterativeFlag | rj::kParseNanAndInfFlag |
-                                 rj::kParseStopWhenDoneFlag |
-                                 rj::kParseNumbersAsStringsFlag;
-
-    rj::Reader reader;
-
+  template <typename Handler, typename ParseRow>
+  Status DoParseRows(Handler& handler, ParseRow&& parse_row) {
     for (; num_rows_ < kMaxParserNumRows; ++num_rows_) {
-      auto ok = reader.Parse<parse_flags>(json, handler);
-      switch (ok.Code()) {
+      const rj::ParseErrorCode code = parse_row();
+      switch (code) {
         case rj::kParseErrorNone:
           // parse the next object
           continue;
@@ -694,15 +1414,32 @@ class HandlerBase : public BlockParser,
           return handler.Error();
         default:
           // rj emitted an error
-          return ParseError(rj::GetParseError_En(ok.Code()), " in row ", num_rows_);
+          return ParseError(rj::GetParseError_En(code), " in row ", num_rows_);
       }
     }
     return Status::Invalid("Exceeded maximum rows");
   }
 
+  template <typename Handler, typename Stream>
+  Status DoParse(Handler& handler, Stream&& json) {
+    constexpr auto parse_flags = rj::kParseIterativeFlag | rj::kParseNanAndInfFlag |
+                                 rj::kParseStopWhenDoneFlag |
+                                 rj::kParseNumbersAsStringsFlag;
+
+    rj::Reader reader;
+    return DoParseRows(handler,
+                       [&] { return reader.Parse<parse_flags>(json, handler).Code(); });
+  }
+
   template <typename Handler>
   Status DoParse(Handler& handler, const std::shared_ptr<Buffer>& json) {
     RETURN_NOT_OK(ReserveScalarStorage(json->size()));
+    if (backend_ == ParserBackend::Indexed) {
+      IndexedReader reader;
+      RETURN_NOT_OK(reader.Index(reinterpret_cast<const char*>(json->data()),
+                                 json->size()));
+      return DoParseRows(handler, [&] { return reader.Parse(handler); });
+    }
     rj::MemoryStream ms(reinterpret_cast<const char*>(json->data()), json->size());
     using InputStream = rj::EncodedInputStream<rj::UTF8<>, rj::MemoryStream>;
     return DoParse(handler, InputStream(ms));
@@ -830,6 +1567,7 @@ class HandlerBase : public BlockParser,
   }
 
   Status status_;
+  ParserBackend backend_ = ParserBackend::RapidJson;
   RawBuilderSet builder_set_;
   BuilderPtr builder_;
   // top of this stack is the parent of builder_
@@ -935,6 +1673,8 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
     return true;
   }
 
+  bool SkipsValue() const { return Skipping(); }
+
   bool EndObject(...) {
     MaybeStopSkipping();
     --depth_;
@@ -959,7 +1699,7 @@ class Handler<UnexpectedFieldBehavior::Ignore> : public HandlerBase {
   }
 
  private:
-  bool Skipping() { return depth_ >= skip_depth_; }
+  bool Skipping() const { return depth_ >= skip_depth_; }
 
   void MaybeStopSkipping() {
     if (skip_depth_ == depth_) {
@@ -1085,7 +1825,8 @@ Status BlockParser::Make(MemoryPool* pool, const ParseOptions& options,
       *out = make_unique<Handler<UnexpectedFieldBehavior::InferType>>(pool);
       break;
   }
-  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema);
+  return static_cast<HandlerBase&>(**out).Initialize(options.explicit_schema,
+                                                     options.backend);
 }
 
 Status BlockParser::Make(const ParseOptions& options, std::unique_ptr<BlockParser>* out) {
@@ -113,6 +113,39 @@ static void ParseJSONBlockWithSchema(
   BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
 }
 
+static void ParseJSONBlockWithSchemaIndexed(
+    benchmark::State& state) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  options.explicit_schema = TestSchema();
+  options.backend = ParserBackend::Indexed;
+
+  auto json = TestJsonData(num_rows);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void BenchmarkParseJSONPrettyPrinted(
+    benchmark::State& state, ParserBackend backend) {  // NOLINT non-const reference
+  const int32_t num_rows = 5000;
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  options.backend = backend;
+
+  auto json = TestJsonData(num_rows, /* pretty */ true);
+  BenchmarkJSONParsing(state, std::make_shared<Buffer>(json), num_rows, options);
+}
+
+static void ParseJSONPrettyPrinted(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONPrettyPrinted(state, ParserBackend::RapidJson);
+}
+
+static void ParseJSONPrettyPrintedIndexed(
+    benchmark::State& state) {  // NOLINT non-const reference
+  BenchmarkParseJSONPrettyPrinted(state, ParserBackend::Indexed);
+}
+
 static void BenchmarkJSONReading(benchmark::State& state,  // NOLINT non-const reference
                                  const std::string& json, int32_t num_rows,
                                  ReadOptions read_options, ParseOptions parse_options) {
@@ -158,6 +191,9 @@ static void ReadJSONBlockWithSchemaMultiThread(
 BENCHMARK(ChunkJSONPrettyPrinted);
 BENCHMARK(ChunkJSONLineDelimited);
 BENCHMARK(ParseJSONBlockWithSchema);
+BENCHMARK(ParseJSONBlockWithSchemaIndexed);
+BENCHMARK(ParseJSONPrettyPrinted);
+BENCHMARK(ParseJSONPrettyPrintedIndexed);
 
 BENCHMARK(ReadJSONBlockWithSchemaSingleThread);
 BENCHMARK(ReadJSONBlockWithSchemaMultiThread)->UseRealTime();
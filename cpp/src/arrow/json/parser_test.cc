@@ -15,6 +15,7 @@
 // specific language governing permissions and limitations
 // under the License.
 
+#include <random>
 #include <string>
 #include <utility>
 #include <vector>
@@ -235,5 +236,134 @@ TEST(BlockParser, Nested) {
                       R"([{"ps":null}, null, {"ps":"78"}, {"ps":"90"}])"});
 }
 
+// Parse with both backends, expecting identical results or errors
+void AssertBackendsAgree(ParseOptions options, string_view src_str) {
+  std::shared_ptr<Array> expected, actual;
+  options.backend = ParserBackend::RapidJson;
+  Status expected_status = ParseFromString(options, src_str, &expected);
+  options.backend = ParserBackend::Indexed;
+  Status actual_status = ParseFromString(options, src_str, &actual);
+  ASSERT_EQ(expected_status.ToString(), actual_status.ToString()) << src_str;
+  if (expected_status.ok()) {
+    AssertArraysEqual(*expected, *actual);
+  }
+}
+
+TEST(BlockParser, BackendsAgree) {
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  for (std::string src : {
+           scalars_only_src(),
+           nested_src(),
+           std::string(""),
+           std::string(" \n\r\t"),
+           std::string(R"({"a":[[1,2],[]],"b":{}}{"a":[[-1.5e+3]],"b":{"c":0}})"),
+           std::string(R"({"a":"x\"y\\z","b":"😀\b\f\n\r\t\/"})"),
+           std::string(R"({"a":NaN,"b":-Infinity,"c":Inf,"d":-0.0E-7})"),
+           std::string("{\"a\":\"\xe5\xbf\x8d\"}"),
+           std::string(R"({"a":1}})"),
+           std::string(R"({"a":1} x)"),
+           std::string(R"({"a":1,})"),
+           std::string(R"({"a" 1})"),
+           std::string(R"({"a":})"),
+           std::string(R"({"a":[1,]})"),
+           std::string(R"({"a":[1 2]})"),
+           std::string(R"({"a":12x})"),
+           std::string(R"({"a":01})"),
+           std::string(R"({"a":1.})"),
+           std::string(R"({"a":1e})"),
+           std::string(R"({"a":-})"),
+           std::string(R"({"a":Infin})"),
+           std::string(R"({"a":tru})"),
+           std::string(R"({"a":truex})"),
+           std::string(R"({"a":"abc)"),
+           std::string("{\"a\":\"ab\tc\"}"),
+           std::string(R"({"a":"\x"})"),
+           std::string(R"({"a":"\u12G4"})"),
+           std::string(R"({"a":"\ud800x"})"),
+           std::string(R"({"a":"\ud800A"})"),
+           std::string(R"({"a":0, "b")"),
+           std::string("{\"a\":0}\n[1]"),
+           std::string("{\"a\":0}\n1"),
+           std::string("{\"a\":0}\n\"s\""),
+           std::string("{\"a\":0}\0{\"a\":1}", 15),
+           std::string("{\"a\":1\0}", 8),
+           std::string("{\"a\":0}\n{\"a\":true}"),
+           std::string("{"),
+           std::string(R"({"a":[0)"),
+       }) {
+    AssertBackendsAgree(options, src);
+  }
+}
+
+TEST(BlockParser, BackendsAgreeRandom) {
+  std::vector<std::shared_ptr<Field>> fields = {
+      field("int", int32()), field("str", utf8()), field("list", list(float64())),
+      field("struct",
+            struct_({field("bool", boolean()), field("strs", list(utf8()))}))};
+  auto options = ParseOptions::Defaults();
+  options.explicit_schema = schema(fields);
+  std::default_random_engine engine(0x5eed);
+  for (bool pretty : {false, true}) {
+    std::string json;
+    for (int i = 0; i < 1000; ++i) {
+      StringBuffer sb;
+      Writer writer(sb);
+      ASSERT_OK(Generate(options.explicit_schema, engine, &writer));
+      json += pretty ? PrettyPrint(sb.GetString()) : sb.GetString();
+      json += "\n";
+    }
+    for (auto behavior : {UnexpectedFieldBehavior::Ignore, UnexpectedFieldBehavior::Error,
+                          UnexpectedFieldBehavior::InferType}) {
+      options.unexpected_field_behavior = behavior;
+      AssertBackendsAgree(options, json);
+    }
+    options.explicit_schema = nullptr;
+    AssertBackendsAgree(options, json);
+    options.explicit_schema = schema(fields);
+  }
+}
+
+TEST(BlockParser, BackendsAgreeEscapes) {
+  // Escapes and runs of backslashes straddling the 64-byte blocks of the index
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  std::default_random_engine engine(0x5eed);
+  const std::string escapes[] = {"a", "\\\\", "\\\"", "\\n", "\\u00e9", "\"", "\x01"};
+  std::uniform_int_distribution<size_t> pick(0, 4);
+  std::uniform_int_distribution<size_t> pick_invalid(0, 6);
+  for (int i = 0; i < 200; ++i) {
+    std::string json;
+    for (int row = 0; row < 20; ++row) {
+      json += "{\"s\":\"";
+      for (int j = 0; j < 50; ++j) {
+        // the last row may be malformed
+        json += escapes[row == 19 ? pick_invalid(engine) : pick(engine)];
+      }
+      json += "\"}\n";
+    }
+    AssertBackendsAgree(options, json);
+  }
+}
+
+TEST(BlockParser, BackendsAgreeIgnoredFields) {
+  // The indexed backend skips the values of ignored fields without building them.
+  // Skipped values are only checked for balance, so the malformed values below are
+  // limited to ones which both backends reject with the same error.
+  auto options = ParseOptions::Defaults();
+  options.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  options.explicit_schema = schema({field("a", int64()), field("n", struct_({}))});
+  for (auto json : {
+           R"({"skip": {"deep": [1, {"s": "}]\"\\"}]}, "a": 1, "x": "\"y"})",
+           R"({"a": 2, "skip": [[], {}, [[]]], "n": {"skip": [3, "]"]}})",
+           R"({"skip": null, "a": 3, "t": true, "f": -1.5e3, "u": "\u00e9"})",
+           "{\"skip\": {\"a\": 1}}\n{\"n\": {\"skip\": {}}, \"skip\": \"\"}",
+           R"({"skip": ]})",
+           R"({"skip": "unterminated)",
+       }) {
+    AssertBackendsAgree(options, json);
+  }
+}
+
 }  // namespace json
 }  // namespace arrow
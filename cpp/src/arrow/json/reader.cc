@@ -29,6 +29,7 @@
 #include "arrow/json/parser.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
+#include "arrow/util/checked_cast.h"
 #include "arrow/util/iterator.h"
 #include "arrow/util/logging.h"
 #include "arrow/util/string_view.h"
@@ -39,12 +40,47 @@ namespace arrow {
 
 using util::string_view;
 
+using internal::checked_cast;
 using internal::GetCpuThreadPool;
 using internal::TaskGroup;
 using internal::ThreadPool;
 
 namespace json {
 
+namespace {
+
+// Parse the whole objects of a block, preceded by the object straddling it and
+// the previous block
+Status ParseBlock(MemoryPool* pool, const ParseOptions& parse_options,
+                  const std::shared_ptr<Buffer>& partial,
+                  const std::shared_ptr<Buffer>& completion,
+                  const std::shared_ptr<Buffer>& whole, std::shared_ptr<Array>* parsed) {
+  std::unique_ptr<BlockParser> parser;
+  RETURN_NOT_OK(BlockParser::Make(pool, parse_options, &parser));
+  RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
+                                             whole->size()));
+
+  if (partial->size() != 0 || completion->size() != 0) {
+    std::shared_ptr<Buffer> straddling;
+    if (partial->size() == 0) {
+      straddling = completion;
+    } else if (completion->size() == 0) {
+      straddling = partial;
+    } else {
+      RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool, &straddling));
+    }
+    RETURN_NOT_OK(parser->Parse(straddling));
+  }
+
+  if (whole->size() != 0) {
+    RETURN_NOT_OK(parser->Parse(whole));
+  }
+
+  return parser->Finish(parsed);
+}
+
+}  // namespace
+
 class TableReaderImpl : public TableReader,
                         public std::enable_shared_from_this<TableReaderImpl> {
  public:
@@ -128,29 +164,8 @@ class TableReaderImpl : public TableReader,
   Status ParseAndInsert(const std::shared_ptr<Buffer>& partial,
                         const std::shared_ptr<Buffer>& completion,
                         const std::shared_ptr<Buffer>& whole, int64_t block_index) {
-    std::unique_ptr<BlockParser> parser;
-    RETURN_NOT_OK(BlockParser::Make(pool_, parse_options_, &parser));
-    RETURN_NOT_OK(parser->ReserveScalarStorage(partial->size() + completion->size() +
-                                               whole->size()));
-
-    if (partial->size() != 0 || completion->size() != 0) {
-      std::shared_ptr<Buffer> straddling;
-      if (partial->size() == 0) {
-        straddling = completion;
-      } else if (completion->size() == 0) {
-        straddling = partial;
-      } else {
-        RETURN_NOT_OK(ConcatenateBuffers({partial, completion}, pool_, &straddling));
-      }
-      RETURN_NOT_OK(parser->Parse(straddling));
-    }
-
-    if (whole->size() != 0) {
-      RETURN_NOT_OK(parser->Parse(whole));
-    }
-
     std::shared_ptr<Array> parsed;
-    RETURN_NOT_OK(parser->Finish(&parsed));
+    RETURN_NOT_OK(ParseBlock(pool_, parse_options_, partial, completion, whole, &parsed));
     builder_->Insert(block_index, field("", parsed->type()), parsed);
     return Status::OK();
   }
@@ -164,6 +179,157 @@ class TableReaderImpl : public TableReader,
   std::shared_ptr<ChunkedArrayBuilder> builder_;
 };
 
+/// Delimits the blocks of an input stream into whole objects, and parses and
+/// converts each block into a RecordBatch
+class BlockBatchIterator {
+ public:
+  BlockBatchIterator(MemoryPool* pool, const ParseOptions& parse_options,
+                     Iterator<std::shared_ptr<Buffer>> block_iterator)
+      : pool_(pool),
+        parse_options_(parse_options),
+        chunker_(MakeChunker(parse_options_)),
+        block_iterator_(std::move(block_iterator)),
+        partial_(std::make_shared<Buffer>("")) {
+    if (parse_options_.unexpected_field_behavior != UnexpectedFieldBehavior::InferType) {
+      // Without an explicit schema every field is unexpected
+      schema_ = parse_options_.explicit_schema ? parse_options_.explicit_schema
+                                               : ::arrow::schema({});
+    }
+  }
+
+  /// \brief The schema of the converted batches, or null while it is inferred
+  const std::shared_ptr<Schema>& schema() const { return schema_; }
+
+  /// \brief Make the following blocks conform to the given schema
+  ///
+  /// Fields outside of it will be an error.
+  void ConformTo(std::shared_ptr<Schema> schema) {
+    parse_options_.explicit_schema = schema;
+    parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+    schema_ = std::move(schema);
+  }
+
+  Result<std::shared_ptr<RecordBatch>> Next() {
+    if (!started_) {
+      started_ = true;
+      ARROW_ASSIGN_OR_RAISE(block_, block_iterator_.Next());
+    }
+
+    // Skip blocks without any objects
+    while (block_ != nullptr) {
+      std::shared_ptr<Buffer> next_block, whole, completion, next_partial;
+      ARROW_ASSIGN_OR_RAISE(next_block, block_iterator_.Next());
+
+      if (next_block == nullptr) {
+        RETURN_NOT_OK(chunker_->ProcessFinal(partial_, block_, &completion, &whole));
+      } else {
+        std::shared_ptr<Buffer> starts_with_whole;
+        RETURN_NOT_OK(chunker_->ProcessWithPartial(partial_, block_, &completion,
+                                                   &starts_with_whole));
+        RETURN_NOT_OK(chunker_->Process(starts_with_whole, &whole, &next_partial));
+      }
+
+      std::shared_ptr<Array> parsed;
+      RETURN_NOT_OK(
+          ParseBlock(pool_, parse_options_, partial_, completion, whole, &parsed));
+      partial_ = next_partial;
+      block_ = next_block;
+
+      if (parsed->length() != 0) {
+        return Convert(parsed);
+      }
+    }
+    return nullptr;
+  }
+
+ private:
+  Result<std::shared_ptr<RecordBatch>> Convert(const std::shared_ptr<Array>& parsed) {
+    auto type = parse_options_.explicit_schema
+                    ? struct_(parse_options_.explicit_schema->fields())
+                    : struct_({});
+    auto promotion_graph =
+        parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType
+            ? GetPromotionGraph()
+            : nullptr;
+    std::shared_ptr<ChunkedArrayBuilder> builder;
+    RETURN_NOT_OK(MakeChunkedArrayBuilder(TaskGroup::MakeSerial(), pool_,
+                                          promotion_graph, type, &builder));
+    builder->Insert(0, field("", parsed->type()), parsed);
+    std::shared_ptr<ChunkedArray> chunked;
+    RETURN_NOT_OK(builder->Finish(&chunked));
+    const auto& converted = checked_cast<const StructArray&>(*chunked->chunk(0));
+
+    std::vector<std::shared_ptr<Array>> columns(converted.num_fields());
+    for (int i = 0; i < converted.num_fields(); ++i) {
+      columns[i] = converted.field(i);
+    }
+    auto batch_schema = schema_ ? schema_ : ::arrow::schema(converted.type()->children());
+    return RecordBatch::Make(std::move(batch_schema), converted.length(),
+                             std::move(columns));
+  }
+
+  MemoryPool* pool_;
+  ParseOptions parse_options_;
+  std::unique_ptr<Chunker> chunker_;
+  Iterator<std::shared_ptr<Buffer>> block_iterator_;
+  std::shared_ptr<Schema> schema_;
+  bool started_ = false;
+  std::shared_ptr<Buffer> block_;
+  // The incomplete object at the end of the previous block
+  std::shared_ptr<Buffer> partial_;
+};
+
+class StreamingReaderImpl : public StreamingReader {
+ public:
+  StreamingReaderImpl(MemoryPool* pool, const ReadOptions& read_options,
+                      const ParseOptions& parse_options)
+      : pool_(pool), read_options_(read_options), parse_options_(parse_options) {}
+
+  Status Init(std::shared_ptr<io::InputStream> input) {
+    ARROW_ASSIGN_OR_RAISE(auto block_iterator,
+                          io::MakeInputStreamIterator(input, read_options_.block_size));
+    BlockBatchIterator batches(pool_, parse_options_, std::move(block_iterator));
+
+    if (parse_options_.unexpected_field_behavior == UnexpectedFieldBehavior::InferType) {
+      // Infer the schema from the first block
+      ARROW_ASSIGN_OR_RAISE(first_batch_, batches.Next());
+      if (first_batch_ == nullptr) {
+        return Status::Invalid("Empty JSON file");
+      }
+      schema_ = first_batch_->schema();
+      batches.ConformTo(schema_);
+    } else {
+      schema_ = batches.schema();
+    }
+
+    batch_iterator_ = Iterator<std::shared_ptr<RecordBatch>>(std::move(batches));
+    if (read_options_.use_threads) {
+      ARROW_ASSIGN_OR_RAISE(batch_iterator_,
+                            MakeReadaheadIterator(std::move(batch_iterator_),
+                                                  read_options_.readahead_blocks));
+    }
+    return Status::OK();
+  }
+
+  std::shared_ptr<Schema> schema() const override { return schema_; }
+
+  Status ReadNext(std::shared_ptr<RecordBatch>* batch) override {
+    if (first_batch_ != nullptr) {
+      *batch = std::move(first_batch_);
+      return Status::OK();
+    }
+    return batch_iterator_.Next().Value(batch);
+  }
+
+ private:
+  MemoryPool* pool_;
+  ReadOptions read_options_;
+  ParseOptions parse_options_;
+  std::shared_ptr<Schema> schema_;
+  std::shared_ptr<RecordBatch> first_batch_;
+  Iterator<std::shared_ptr<RecordBatch>> batch_iterator_;
+};
+
 Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
                          const ReadOptions& read_options,
                          const ParseOptions& parse_options,
@@ -181,6 +347,16 @@ Status TableReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> inpu
   return Status::OK();
 }
 
+Status StreamingReader::Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                             const ReadOptions& read_options,
+                             const ParseOptions& parse_options,
+                             std::shared_ptr<StreamingReader>* out) {
+  auto ptr = std::make_shared<StreamingReaderImpl>(pool, read_options, parse_options);
+  RETURN_NOT_OK(ptr->Init(std::move(input)));
+  *out = std::move(ptr);
+  return Status::OK();
+}
+
 Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                 std::shared_ptr<RecordBatch>* out) {
   std::unique_ptr<BlockParser> parser;
@@ -201,9 +377,9 @@ Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                                         &builder));
 
   builder->Insert(0, field("", type), parsed);
-  std::shared_ptr<ChunkedArray> converted_chunked;
-  RETURN_NOT_OK(builder->Finish(&converted_chunked));
-  auto converted = static_cast<const StructArray*>(converted_chunked->chunk(0).get());
+  std::shared_ptr<ChunkedArray> chunked;
+  RETURN_NOT_OK(builder->Finish(&chunked));
+  auto converted = static_cast<const StructArray*>(chunked->chunk(0).get());
 
   std::vector<std::shared_ptr<Array>> columns(converted->num_fields());
   for (int i = 0; i < converted->num_fields(); ++i) {
@@ -20,6 +20,7 @@
 #include <memory>
 
 #include "arrow/json/options.h"
+#include "arrow/record_batch.h"
 #include "arrow/status.h"
 #include "arrow/util/macros.h"
 #include "arrow/util/visibility.h"
@@ -29,7 +30,6 @@ namespace arrow {
 class Buffer;
 class MemoryPool;
 class Table;
-class RecordBatch;
 class Array;
 class DataType;
 
@@ -55,6 +55,25 @@ class ARROW_EXPORT TableReader {
                      std::shared_ptr<TableReader>* out);
 };
 
+/// A class that reads a JSON file as a stream of RecordBatches, one per block
+///
+/// The file is expected to consist of individual line-separated JSON objects.
+/// If ReadOptions::use_threads, blocks are read and parsed on a background
+/// thread at most ReadOptions::readahead_blocks ahead of the consumer, so that
+/// memory use is bounded regardless of the size of the file.
+///
+/// With UnexpectedFieldBehavior::InferType, the schema is inferred from the
+/// first block; later blocks must conform to it, and fields outside of it are an
+/// error.
+class ARROW_EXPORT StreamingReader : public RecordBatchReader {
+ public:
+  /// Create a StreamingReader instance, parsing the first block if types are
+  /// to be inferred
+  static Status Make(MemoryPool* pool, std::shared_ptr<io::InputStream> input,
+                     const ReadOptions&, const ParseOptions&,
+                     std::shared_ptr<StreamingReader>* out);
+};
+
 ARROW_EXPORT Status ParseOne(ParseOptions options, std::shared_ptr<Buffer> json,
                              std::shared_ptr<RecordBatch>* out);
 
@@ -25,6 +25,7 @@
 #include "arrow/json/options.h"
 #include "arrow/json/reader.h"
 #include "arrow/json/test_common.h"
+#include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/testing/gtest_util.h"
 
@@ -273,5 +274,140 @@ TEST(ReaderTest, MultipleChunksParallel) {
   AssertTablesEqual(*serial, *threaded);
 }
 
+class StreamingReaderTest : public ::testing::TestWithParam<bool> {
+ public:
+  void SetUpReader(util::string_view input) {
+    read_options_.use_threads = GetParam();
+    std::shared_ptr<io::InputStream> stream;
+    ASSERT_OK(MakeStream(input, &stream));
+    ASSERT_OK(StreamingReader::Make(default_memory_pool(), stream, read_options_,
+                                    parse_options_, &reader_));
+  }
+
+  void ReadAll(std::vector<std::shared_ptr<RecordBatch>>* batches) {
+    batches->clear();
+    std::shared_ptr<RecordBatch> batch;
+    while (true) {
+      ASSERT_OK(reader_->ReadNext(&batch));
+      if (batch == nullptr) break;
+      AssertSchemaEqual(*reader_->schema(), *batch->schema());
+      batches->push_back(batch);
+    }
+  }
+
+  ParseOptions parse_options_ = ParseOptions::Defaults();
+  ReadOptions read_options_ = ReadOptions::Defaults();
+  std::shared_ptr<StreamingReader> reader_;
+};
+
+INSTANTIATE_TEST_CASE_P(StreamingReaderTest, StreamingReaderTest,
+                        ::testing::Values(false, true));
+
+TEST_P(StreamingReaderTest, MultipleBatches) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  auto src = scalars_only_src();
+  read_options_.block_size = static_cast<int>(src.length() / 3);
+  SetUpReader(src);
+
+  auto schema = ::arrow::schema(
+      {field("hello", float64()), field("world", boolean()), field("yo", utf8())});
+  AssertSchemaEqual(*schema, *reader_->schema());
+
+  // the last block of the file is "  ", which yields no batch
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  ASSERT_EQ(batches.size(), 3);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([
+    {"hello": 3.5, "world": false, "yo": "thing"}
+  ])"),
+                     *batches[0]);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([
+    {"hello": 3.25, "world": null, "yo": null}
+  ])"),
+                     *batches[1]);
+  AssertBatchesEqual(*RecordBatchFromJSON(schema, R"([
+    {"hello": 3.125, "world": null, "yo": "\u5fcd"},
+    {"hello": 0.0, "world": true, "yo": null}
+  ])"),
+                     *batches[2]);
+}
+
+TEST_P(StreamingReaderTest, IgnoredFields) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  std::string src = R"(
+    {"skip": {"deep": [1, {"s": "}]\"\\"}]}, "a": 1, "also": "x\"y"}
+    {"a": 2, "skip": []}
+    {"skip": null, "a": 3}
+  )";
+
+  for (auto backend : {ParserBackend::RapidJson, ParserBackend::Indexed}) {
+    parse_options_.backend = backend;
+    SetUpReader(src);
+    AssertSchemaEqual(*parse_options_.explicit_schema, *reader_->schema());
+
+    std::vector<std::shared_ptr<RecordBatch>> batches;
+    ReadAll(&batches);
+    ASSERT_EQ(batches.size(), 1);
+    AssertBatchesEqual(
+        *RecordBatchFromJSON(parse_options_.explicit_schema, R"([
+          {"a": 1}, {"a": 2}, {"a": 3}
+        ])"),
+        *batches[0]);
+  }
+}
+
+TEST_P(StreamingReaderTest, NoExplicitSchema) {
+  std::string src = "{\"a\": 1}\n{\"b\": 2}\n";
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Ignore;
+  SetUpReader(src);
+  ASSERT_NE(reader_->schema(), nullptr);
+  AssertSchemaEqual(*schema({}), *reader_->schema());
+
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  ASSERT_EQ(batches.size(), 1);
+  ASSERT_EQ(batches[0]->num_columns(), 0);
+  ASSERT_EQ(batches[0]->num_rows(), 2);
+
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  SetUpReader(src);
+  ASSERT_NE(reader_->schema(), nullptr);
+  AssertSchemaEqual(*schema({}), *reader_->schema());
+  std::shared_ptr<RecordBatch> batch;
+  ASSERT_RAISES(Invalid, reader_->ReadNext(&batch));
+}
+
+TEST_P(StreamingReaderTest, NewFieldInLaterBlock) {
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  std::string src = "{\"a\": 1}\n{\"a\": 2}\n{\"a\": 3, \"b\": 4}\n";
+  read_options_.block_size = 10;
+  SetUpReader(src);
+  AssertSchemaEqual(*schema({field("a", int64())}), *reader_->schema());
+
+  Status st;
+  std::shared_ptr<RecordBatch> batch;
+  do {
+    st = reader_->ReadNext(&batch);
+  } while (st.ok() && batch != nullptr);
+  ASSERT_RAISES(Invalid, st);
+}
+
+TEST_P(StreamingReaderTest, Empty) {
+  read_options_.use_threads = GetParam();
+  std::shared_ptr<io::InputStream> stream;
+  ASSERT_OK(MakeStream("", &stream));
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::InferType;
+  ASSERT_RAISES(Invalid, StreamingReader::Make(default_memory_pool(), stream,
+                                               read_options_, parse_options_, &reader_));
+
+  parse_options_.unexpected_field_behavior = UnexpectedFieldBehavior::Error;
+  parse_options_.explicit_schema = schema({field("a", int64())});
+  SetUpReader("  \n");
+  std::vector<std::shared_ptr<RecordBatch>> batches;
+  ReadAll(&batches);
+  ASSERT_EQ(batches.size(), 0);
+}
+
 }  // namespace json
 }  // namespace arrow
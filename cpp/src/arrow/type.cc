@@ -503,26 +503,80 @@ std::string NullType::ToString() const { return name(); }
 // Schema implementation
 
 namespace {
+
+std::shared_ptr<DataType> IntegerTypeOf(int bit_width, bool is_signed) {
+  switch (bit_width) {
+    case 8:
+      return is_signed ? int8() : uint8();
+    case 16:
+      return is_signed ? int16() : uint16();
+    case 32:
+      return is_signed ? int32() : uint32();
+    case 64:
+      return is_signed ? int64() : uint64();
+    default:
+      return nullptr;
+  }
+}
+
+// Return the narrowest integer type able to represent all values of both
+// `left` and `right`, or null if either isn't an integer type or there is none.
+std::shared_ptr<DataType> PromoteIntegers(const DataType& left, const DataType& right) {
+  if (!is_integer(left.id()) || !is_integer(right.id())) {
+    return nullptr;
+  }
+  const auto& left_int = checked_cast<const IntegerType&>(left);
+  const auto& right_int = checked_cast<const IntegerType&>(right);
+
+  if (left_int.is_signed() == right_int.is_signed()) {
+    return IntegerTypeOf(std::max(left_int.bit_width(), right_int.bit_width()),
+                         left_int.is_signed());
+  }
+
+  // A signed type must be strictly wider than the unsigned one
+  const auto& signed_int = left_int.is_signed() ? left_int : right_int;
+  const auto& unsigned_int = left_int.is_signed() ? right_int : left_int;
+  return IntegerTypeOf(std::max(signed_int.bit_width(), 2 * unsigned_int.bit_width()),
+                       true);
+}
+
 // Unifies `other` with `existing`. The unified field will have the metadata of
 // `existing` and:
 //   - if `other` if of NullType or is nullable, the unified field will be nullable.
 //   - if `existing` is of NullType but other is not, the unified field will
 //     have `other`'s type and will be nullable.
+//   - if both are of integer types and integer widths may be promoted, the
+//     unified field will have the narrowest integer type able to represent
+//     the values of both.
 Result<std::shared_ptr<Field>> UnifyFields(const std::shared_ptr<Field>& existing,
-                                           const std::shared_ptr<Field>& other) {
+                                           const std::shared_ptr<Field>& other,
+                                           const Field::MergeOptions& options) {
   if (existing->type()->id() == Type::NA) {
     return other->WithNullable(true)->WithMetadata(existing->metadata());
   }
-  if (other->type()->id() != Type::NA && !existing->type()->Equals(other->type())) {
-    return Status::Invalid("Field ", existing->name(),
-                           " has incompatible types: ", existing->type()->ToString(),
-                           " vs ", other->type()->ToString());
+  if (other->type()->id() == Type::NA) {
+    return existing->WithNullable(true);
+  }
+
+  auto unified = existing;
+  if (!existing->type()->Equals(other->type())) {
+    std::shared_ptr<DataType> promoted;
+    if (options.promote_integer_widths) {
+      promoted = PromoteIntegers(*existing->type(), *other->type());
+    }
+    if (promoted == nullptr) {
+      return Status::Invalid("Field ", existing->name(),
+                             " has incompatible types: ", existing->type()->ToString(),
+                             " vs ", other->type()->ToString());
+    }
+    unified = existing->WithType(promoted);
   }
+
   // At least one field is nullable thus the unified field should also be nullable.
-  if (other->type()->id() == Type::NA || other->nullable() != existing->nullable()) {
-    return existing->WithNullable(true);
+  if (other->nullable() != existing->nullable()) {
+    return unified->WithNullable(true);
   }
-  return existing;
+  return unified;
 }
 
 }  // namespace
@@ -727,7 +781,8 @@ std::shared_ptr<Schema> schema(std::vector<std::shared_ptr<Field>>&& fields,
 }
 
 Result<std::shared_ptr<Schema>> UnifySchemas(
-    const std::vector<std::shared_ptr<Schema>>& schemas) {
+    const std::vector<std::shared_ptr<Schema>>& schemas,
+    Field::MergeOptions field_merge_options) {
   if (schemas.empty()) {
     return Status::Invalid("Must provide at least one schema to unify.");
   }
@@ -745,6 +800,7 @@ Result<std::shared_ptr<Schema>> UnifySchemas(
   for (auto schema_iter = schemas.begin() + 1; schema_iter != schemas.end();
        ++schema_iter) {
     const std::shared_ptr<Schema>& schema = *schema_iter;
+    std::vector<bool> present(fields.size(), false);
     for (const std::string& field_name : schema->field_names()) {
       const std::vector<std::shared_ptr<Field>> current_fields =
           schema->GetAllFieldsByName(field_name);
@@ -762,7 +818,17 @@ Result<std::shared_ptr<Schema>> UnifySchemas(
         const size_t existing_field_index = insertion_result.first->second;
         auto& existing_field = fields[existing_field_index];
         ARROW_ASSIGN_OR_RAISE(existing_field,
-                              UnifyFields(existing_field, current_fields[0]));
+                              UnifyFields(existing_field, current_fields[0],
+                                          field_merge_options));
+        if (existing_field_index < present.size()) {
+          present[existing_field_index] = true;
+        }
+      }
+    }
+    // Fields missing from this schema will become nullable too.
+    for (size_t i = 0; i < present.size(); ++i) {
+      if (!present[i] && !fields[i]->nullable()) {
+        fields[i] = fields[i]->WithNullable(true);
       }
     }
   }
@@ -332,6 +332,18 @@ class ARROW_EXPORT Field : public detail::Fingerprintable {
 
   ~Field() override;
 
+  /// \brief Options controlling how fields of the same name are merged by
+  /// UnifySchemas
+  struct MergeOptions {
+    /// If true, integer fields of different types are merged into the
+    /// narrowest integer type able to represent the values of both, e.g.
+    /// int8 and uint16 yield int32. uint64 can only be merged with unsigned
+    /// types.
+    bool promote_integer_widths = false;
+
+    static MergeOptions Defaults() { return MergeOptions(); }
+  };
+
   /// \brief Return the field's attached metadata
   std::shared_ptr<const KeyValueMetadata> metadata() const { return metadata_; }
 
@@ -1552,8 +1564,11 @@ std::shared_ptr<Schema> schema(
 /// Fields with the same name will be unified:
 /// - They are expected to be of the same type, or of Null type. The unified
 ///   field will be of that same type.
+/// - If field_merge_options.promote_integer_widths is set, integer fields
+///   of different types are unified to an integer type wide enough for both.
 /// - The unified field will inherit the metadata from the schema where
 ///   that field is first defined.
+/// - A field missing from any of the schemas will be nullable.
 /// - The first N fields in the schema will be ordered the same as the
 ///   N fields in the first schema.
 /// The resulting schema will inherit its metadata from the first input schema.
@@ -1562,7 +1577,8 @@ std::shared_ptr<Schema> schema(
 /// - Fields of the same name are of incompatible types.
 ARROW_EXPORT
 Result<std::shared_ptr<Schema>> UnifySchemas(
-    const std::vector<std::shared_ptr<Schema>>& schemas);
+    const std::vector<std::shared_ptr<Schema>>& schemas,
+    Field::MergeOptions field_merge_options = Field::MergeOptions::Defaults());
 
 }  // namespace arrow
 
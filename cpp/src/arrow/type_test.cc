@@ -481,7 +481,8 @@ TEST_F(TestUnifySchemas, FieldOrderingSameAsTheFirstSchema) {
 
   ASSERT_EQ(4, result->num_fields());
   ASSERT_TRUE(int32_field->Equals(result->field(0)));
-  ASSERT_TRUE(uint8_field->Equals(result->field(1)));
+  // uint8_field is missing from schema3 thus it becomes nullable.
+  ASSERT_TRUE(uint8_field->WithNullable(true)->Equals(result->field(1)));
   ASSERT_TRUE(utf8_field->Equals(result->field(2)));
   ASSERT_TRUE(binary_field->Equals(result->field(3)));
 }
@@ -504,6 +505,21 @@ TEST_F(TestUnifySchemas, MissingField) {
                     ->WithMetadata(metadata1));
 }
 
+TEST_F(TestUnifySchemas, MissingNonNullableField) {
+  auto int32_field = field("int32_field", int32(), false);
+  auto uint8_field = field("uint8_field", uint8(), false);
+  auto utf8_field = field("utf8_field", utf8(), false);
+
+  // Fields missing from a later schema become nullable as well
+  auto schema1 = schema({int32_field, uint8_field});
+  auto schema2 = schema({uint8_field, utf8_field});
+  auto schema3 = schema({uint8_field});
+
+  ASSERT_OK_AND_ASSIGN(auto result, UnifySchemas({schema1, schema2, schema3}));
+  AssertSchemaEqual(*result, *schema({int32_field->WithNullable(true), uint8_field,
+                                      utf8_field->WithNullable(true)}));
+}
+
 TEST_F(TestUnifySchemas, PromoteNullTypeField) {
   auto metadata =
       std::shared_ptr<KeyValueMetadata>(new KeyValueMetadata({"foo"}, {"bar"}));
@@ -541,6 +557,46 @@ TEST_F(TestUnifySchemas, IncompatibleTypes) {
   ASSERT_RAISES(Invalid, UnifySchemas({schema({int32_field}), schema({uint8_field})}));
 }
 
+TEST_F(TestUnifySchemas, PromoteIntegerWidths) {
+  Field::MergeOptions options;
+  options.promote_integer_widths = true;
+
+  auto CheckPromoted = [&](std::shared_ptr<DataType> left,
+                           std::shared_ptr<DataType> right,
+                           std::shared_ptr<DataType> expected) {
+    auto left_schema = schema({field("f", left, false)});
+    auto right_schema = schema({field("f", right, false)});
+    ASSERT_OK_AND_ASSIGN(auto result, UnifySchemas({left_schema, right_schema}, options));
+    AssertSchemaEqual(*result, *schema({field("f", expected, false)}));
+    ASSERT_OK_AND_ASSIGN(result, UnifySchemas({right_schema, left_schema}, options));
+    AssertSchemaEqual(*result, *schema({field("f", expected, false)}));
+  };
+
+  CheckPromoted(int8(), int32(), int32());
+  CheckPromoted(uint16(), uint64(), uint64());
+  CheckPromoted(int8(), uint8(), int16());
+  CheckPromoted(int8(), uint16(), int32());
+  CheckPromoted(int64(), uint32(), int64());
+
+  // Nullability is promoted as well
+  ASSERT_OK_AND_ASSIGN(auto result,
+                       UnifySchemas({schema({field("f", int32(), false)}),
+                                     schema({field("f", int64())})},
+                                    options));
+  AssertSchemaEqual(*result, *schema({field("f", int64())}));
+
+  // No signed type can represent all uint64 values
+  ASSERT_RAISES(Invalid, UnifySchemas({schema({field("f", int8())}),
+                                       schema({field("f", uint64())})},
+                                      options));
+  ASSERT_RAISES(Invalid, UnifySchemas({schema({field("f", int32())}),
+                                       schema({field("f", float64())})},
+                                      options));
+  // Not promoted by default
+  ASSERT_RAISES(Invalid, UnifySchemas({schema({field("f", int8())}),
+                                       schema({field("f", int32())})}));
+}
+
 TEST_F(TestUnifySchemas, DuplicateFieldNames) {
   auto int32_field = field("int32_field", int32());
   auto utf8_field = field("utf8_field", utf8());
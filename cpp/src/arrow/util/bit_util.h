@@ -296,6 +296,21 @@ static inline int CountTrailingZeros(uint64_t value) {
 #endif
 }
 
+/// \brief Count the number of set bits in an unsigned integer.
+static inline int PopCount(uint64_t value) {
+#if defined(__clang__) || defined(__GNUC__)
+  return __builtin_popcountll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  return static_cast<int>(__popcnt64(value));
+#else
+  int count = 0;
+  for (; value != 0; value &= value - 1) {
+    ++count;
+  }
+  return count;
+#endif
+}
+
 // Returns the minimum number of bits needed to represent an unsigned value
 static inline int NumRequiredBits(uint64_t x) { return 64 - CountLeadingZeros(x); }
 
@@ -647,6 +647,14 @@ TEST_F(BitmapOp, XorAligned) {
   TestUnaligned(op, left, right, result);
 }
 
+TEST_F(BitmapOp, AlignedAtLargeOffset) {
+  // The byte-wise path must only touch the bytes which hold the output bits
+  std::vector<uint8_t> left(130, 0x0F), right(130, 0x3C);
+  std::vector<uint8_t> out(3, 0xAA);
+  BitmapAnd(left.data(), 1024, right.data(), 1024, 8, 0, out.data());
+  ASSERT_EQ(out, std::vector<uint8_t>({0x0C, 0xAA, 0xAA}));
+}
+
 static inline int64_t SlowCountBits(const uint8_t* data, int64_t bit_offset,
                                     int64_t length) {
   int64_t count = 0;
@@ -1007,6 +1015,15 @@ TEST(BitUtil, CountTrailingZeros) {
   EXPECT_EQ(BitUtil::CountTrailingZeros(U64(ULLONG_MAX)), 0);
 }
 
+TEST(BitUtil, PopCount) {
+  EXPECT_EQ(BitUtil::PopCount(U64(0)), 0);
+  EXPECT_EQ(BitUtil::PopCount(U64(1)), 1);
+  EXPECT_EQ(BitUtil::PopCount(U64(1) << 63), 1);
+  EXPECT_EQ(BitUtil::PopCount(U64(0xF0F0)), 8);
+  EXPECT_EQ(BitUtil::PopCount(~U64(0)), 64);
+  EXPECT_EQ(BitUtil::PopCount(~U64(0) >> 1), 63);
+}
+
 TEST(BitUtil, RoundUpToPowerOf2) {
   EXPECT_EQ(BitUtil::RoundUpToPowerOf2(S64(7), 8), 8);
   EXPECT_EQ(BitUtil::RoundUpToPowerOf2(S64(8), 8), 8);
@@ -0,0 +1,111 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/hyperloglog.h"
+
+#include <cmath>
+
+namespace arrow {
+namespace util {
+
+namespace {
+
+// Serialized layout: format version, precision, then one byte per register
+constexpr uint8_t kFormatVersion = 1;
+constexpr size_t kHeaderSize = 2;
+
+}  // namespace
+
+constexpr int HyperLogLog::kMinPrecision;
+constexpr int HyperLogLog::kMaxPrecision;
+constexpr int HyperLogLog::kDefaultPrecision;
+
+HyperLogLog::HyperLogLog(int precision)
+    : precision_(std::min(std::max(precision, kMinPrecision), kMaxPrecision)),
+      registers_(size_t(1) << precision_, 0) {}
+
+Status HyperLogLog::Merge(const HyperLogLog& other) {
+  if (other.precision_ != precision_) {
+    return Status::Invalid("Cannot merge HyperLogLog sketches of precision ",
+                           other.precision_, " and ", precision_);
+  }
+  for (size_t i = 0; i < registers_.size(); ++i) {
+    registers_[i] = std::max(registers_[i], other.registers_[i]);
+  }
+  return Status::OK();
+}
+
+double HyperLogLog::Estimate() const {
+  const auto m = static_cast<double>(registers_.size());
+  double alpha;
+  switch (precision_) {
+    case 4:
+      alpha = 0.673;
+      break;
+    case 5:
+      alpha = 0.697;
+      break;
+    case 6:
+      alpha = 0.709;
+      break;
+    default:
+      alpha = 0.7213 / (1.0 + 1.079 / m);
+  }
+
+  double sum = 0;
+  int64_t zeros = 0;
+  for (uint8_t reg : registers_) {
+    sum += std::ldexp(1.0, -reg);
+    zeros += reg == 0;
+  }
+  const double estimate = alpha * m * m / sum;
+  // Linear counting is more accurate for small cardinalities. There is no
+  // large range correction as collisions of 64-bit hashes are negligible.
+  if (estimate <= 2.5 * m && zeros > 0) {
+    return m * std::log(m / static_cast<double>(zeros));
+  }
+  return estimate;
+}
+
+void HyperLogLog::Reset() { std::fill(registers_.begin(), registers_.end(), 0); }
+
+std::string HyperLogLog::Serialize() const {
+  std::string out;
+  out.reserve(kHeaderSize + registers_.size());
+  out.push_back(static_cast<char>(kFormatVersion));
+  out.push_back(static_cast<char>(precision_));
+  out.append(reinterpret_cast<const char*>(registers_.data()), registers_.size());
+  return out;
+}
+
+Status HyperLogLog::Deserialize(util::string_view data, HyperLogLog* out) {
+  if (data.size() < kHeaderSize || static_cast<uint8_t>(data[0]) != kFormatVersion) {
+    return Status::Invalid("Not a serialized HyperLogLog sketch");
+  }
+  const int precision = static_cast<uint8_t>(data[1]);
+  if (precision < kMinPrecision || precision > kMaxPrecision ||
+      data.size() != kHeaderSize + (size_t(1) << precision)) {
+    return Status::Invalid("Corrupt serialized HyperLogLog sketch");
+  }
+  HyperLogLog sketch(precision);
+  std::copy(data.begin() + kHeaderSize, data.end(), sketch.registers_.begin());
+  *out = std::move(sketch);
+  return Status::OK();
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,99 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/bit_util.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+/// \brief A HyperLogLog sketch estimating the number of distinct 64-bit hashes
+///
+/// The sketch has 2^precision one-byte registers; the relative standard error
+/// of the estimate is about 1.04 / sqrt(2^precision). Sketches of the same
+/// precision can be merged, and serialized to be merged in another process.
+///
+/// Hashes must be uniformly distributed over all 64 bits; see MixHash.
+class ARROW_EXPORT HyperLogLog {
+ public:
+  static constexpr int kMinPrecision = 4;
+  static constexpr int kMaxPrecision = 18;
+  static constexpr int kDefaultPrecision = 12;
+
+  /// precision is clamped to [kMinPrecision, kMaxPrecision]
+  explicit HyperLogLog(int precision = kDefaultPrecision);
+
+  int precision() const { return precision_; }
+
+  /// \brief Add a hash to the sketch
+  void Update(uint64_t hash) {
+    const uint64_t index = hash >> (64 - precision_);
+    // The rank is the position of the first set bit after the index bits;
+    // the sentinel bit bounds it when all remaining bits are zero.
+    const uint64_t rest = (hash << precision_) | (uint64_t(1) << (precision_ - 1));
+    const auto rank = static_cast<uint8_t>(BitUtil::CountLeadingZeros(rest) + 1);
+    registers_[index] = std::max(registers_[index], rank);
+  }
+
+  /// \brief Fold another sketch into this one
+  ///
+  /// Both sketches must have the same precision.
+  Status Merge(const HyperLogLog& other);
+
+  /// \brief Estimate the number of distinct hashes added to the sketch
+  double Estimate() const;
+
+  /// \brief Remove all hashes from the sketch
+  void Reset();
+
+  /// \brief Serialize the sketch to a platform-independent string
+  std::string Serialize() const;
+
+  /// \brief Read a sketch written by Serialize
+  static Status Deserialize(util::string_view data, HyperLogLog* out);
+
+  /// \brief Finalize a hash from util/hashing.h so that all its bits depend on
+  /// all bits of the input
+  ///
+  /// The integer hashes of util/hashing.h are only meant to spread hash table
+  /// indices, and their top bits don't depend on the top bits of the value.
+  static uint64_t MixHash(uint64_t hash) {
+    // The finalizer of MurmurHash3
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+ private:
+  int precision_;
+  std::vector<uint8_t> registers_;
+};
+
+}  // namespace util
+}  // namespace arrow
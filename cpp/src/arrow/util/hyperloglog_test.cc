@@ -0,0 +1,112 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <cmath>
+#include <cstdint>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/hashing.h"
+#include "arrow/util/hyperloglog.h"
+
+namespace arrow {
+namespace util {
+
+static uint64_t HashInt(int64_t value) {
+  return HyperLogLog::MixHash(
+      ::arrow::internal::ScalarHelper<int64_t, 0>::ComputeHash(value));
+}
+
+static void AssertEstimateNear(const HyperLogLog& sketch, double expected) {
+  // Allow for 4 standard errors
+  const double error = 4 * 1.04 / std::sqrt(std::ldexp(1.0, sketch.precision()));
+  ASSERT_NEAR(sketch.Estimate(), expected, expected * error + 1)
+      << "precision " << sketch.precision();
+}
+
+TEST(HyperLogLog, Estimate) {
+  for (int precision : {4, 10, 14}) {
+    HyperLogLog sketch(precision);
+    ASSERT_EQ(sketch.Estimate(), 0);
+    for (int64_t n : {1, 10, 1000, 100000}) {
+      sketch.Reset();
+      // Duplicates don't change the estimate
+      for (int repeat = 0; repeat < 3; ++repeat) {
+        for (int64_t i = 0; i < n; ++i) {
+          sketch.Update(HashInt(i));
+        }
+      }
+      AssertEstimateNear(sketch, static_cast<double>(n));
+    }
+  }
+}
+
+TEST(HyperLogLog, HighBits) {
+  // Values which only differ in their high bits must be told apart
+  HyperLogLog sketch;
+  for (int64_t i = 0; i < 10000; ++i) {
+    sketch.Update(HashInt(i << 40));
+  }
+  AssertEstimateNear(sketch, 10000);
+}
+
+TEST(HyperLogLog, Precision) {
+  ASSERT_EQ(HyperLogLog(0).precision(), HyperLogLog::kMinPrecision);
+  ASSERT_EQ(HyperLogLog(30).precision(), HyperLogLog::kMaxPrecision);
+  ASSERT_EQ(HyperLogLog().precision(), HyperLogLog::kDefaultPrecision);
+}
+
+TEST(HyperLogLog, Merge) {
+  HyperLogLog left, right, both;
+  for (int64_t i = 0; i < 20000; ++i) {
+    (i < 15000 ? left : right).Update(HashInt(i));
+    if (i >= 5000) {
+      both.Update(HashInt(i));
+    }
+  }
+  ASSERT_OK(left.Merge(right));
+  AssertEstimateNear(left, 20000);
+  // Merging overlapping sketches doesn't count common values twice
+  ASSERT_OK(left.Merge(both));
+  AssertEstimateNear(left, 20000);
+
+  HyperLogLog other_precision(HyperLogLog::kDefaultPrecision + 1);
+  ASSERT_RAISES(Invalid, left.Merge(other_precision));
+}
+
+TEST(HyperLogLog, Serialize) {
+  HyperLogLog sketch(8);
+  for (int64_t i = 0; i < 1000; ++i) {
+    sketch.Update(HashInt(i));
+  }
+  const std::string serialized = sketch.Serialize();
+
+  HyperLogLog roundtripped;
+  ASSERT_OK(HyperLogLog::Deserialize(serialized, &roundtripped));
+  ASSERT_EQ(roundtripped.precision(), 8);
+  ASSERT_EQ(roundtripped.Estimate(), sketch.Estimate());
+  ASSERT_EQ(roundtripped.Serialize(), serialized);
+
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize("", &roundtripped));
+  ASSERT_RAISES(Invalid, HyperLogLog::Deserialize(serialized.substr(0, 100),
+                                                  &roundtripped));
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -23,6 +23,8 @@
 #include <type_traits>
 #include <vector>
 
+#include "arrow/array.h"
+#include "arrow/builder.h"
 #include "arrow/testing/gtest_util.h"
 #include "arrow/testing/random.h"
 #include "arrow/util/formatting.h"
@@ -160,6 +162,52 @@ static void TimestampParsing(benchmark::State& state) {  // NOLINT non-const ref
   state.SetItemsProcessed(state.iterations() * strings.size());
 }
 
+// Parse a whole string array at once, as the cast kernels do
+template <typename ARROW_TYPE>
+static void ArrayParsing(benchmark::State& state,  // NOLINT non-const reference
+                         const std::vector<std::string>& strings,
+                         const std::shared_ptr<DataType>& type) {
+  using c_type = typename ARROW_TYPE::c_type;
+
+  StringBuilder builder;
+  ABORT_NOT_OK(builder.AppendValues(strings));
+  std::shared_ptr<Array> array;
+  ABORT_NOT_OK(builder.Finish(&array));
+  const auto& string_array = static_cast<const StringArray&>(*array);
+
+  StringConverter<ARROW_TYPE> converter(type);
+  std::vector<c_type> values(strings.size());
+
+  while (state.KeepRunning()) {
+    const int64_t converted = ConvertStrings(
+        &converter, string_array.raw_value_offsets(), string_array.value_data()->data(),
+        /*null_bitmap=*/NULLPTR, 0, string_array.length(), values.data());
+    if (converted != string_array.length()) {
+      std::cerr << "Conversion failed for '" << strings[converted] << "'";
+      std::abort();
+    }
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * strings.size());
+}
+
+template <typename ARROW_TYPE, typename C_TYPE = typename ARROW_TYPE::c_type>
+static void IntegerArrayParsing(benchmark::State& state) {  // NOLINT non-const reference
+  ArrayParsing<ARROW_TYPE>(state, MakeIntStrings<C_TYPE>(1000),
+                           TypeTraits<ARROW_TYPE>::type_singleton());
+}
+
+template <typename ARROW_TYPE>
+static void FloatArrayParsing(benchmark::State& state) {  // NOLINT non-const reference
+  ArrayParsing<ARROW_TYPE>(state, MakeFloatStrings(1000),
+                           TypeTraits<ARROW_TYPE>::type_singleton());
+}
+
+template <TimeUnit::type UNIT>
+static void TimestampArrayParsing(benchmark::State& state) {  // NOLINT non-const ref
+  ArrayParsing<TimestampType>(state, MakeTimestampStrings(1000), timestamp(UNIT));
+}
+
 struct DummyAppender {
   Status operator()(util::string_view v) {
     if (pos_ >= static_cast<int32_t>(v.size())) {
@@ -220,6 +268,17 @@ BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::MILLI);
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::MICRO);
 BENCHMARK_TEMPLATE(TimestampParsing, TimeUnit::NANO);
 
+BENCHMARK_TEMPLATE(IntegerArrayParsing, Int8Type);
+BENCHMARK_TEMPLATE(IntegerArrayParsing, Int32Type);
+BENCHMARK_TEMPLATE(IntegerArrayParsing, Int64Type);
+BENCHMARK_TEMPLATE(IntegerArrayParsing, UInt64Type);
+
+BENCHMARK_TEMPLATE(FloatArrayParsing, FloatType);
+BENCHMARK_TEMPLATE(FloatArrayParsing, DoubleType);
+
+BENCHMARK_TEMPLATE(TimestampArrayParsing, TimeUnit::SECOND);
+BENCHMARK_TEMPLATE(TimestampArrayParsing, TimeUnit::NANO);
+
 BENCHMARK_TEMPLATE(IntegerFormatting, Int8Type);
 BENCHMARK_TEMPLATE(IntegerFormatting, Int16Type);
 BENCHMARK_TEMPLATE(IntegerFormatting, Int32Type);
@@ -16,11 +16,113 @@
 // under the License.
 
 #include "arrow/util/parsing.h"
+
+#include <cstdint>
+
 #include "arrow/util/double_conversion.h"
 
 namespace arrow {
 namespace internal {
 
+namespace {
+
+// Powers of ten which are exactly representable as a double
+constexpr double kExactPowersOfTen[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,
+                                        1e8,  1e9,  1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+                                        1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+template <typename T>
+struct FastFloatTraits;
+
+// A float significand with at most 24 bits and a power of ten of at most 10^10
+// are both exact, so that a single float operation gives a correctly rounded
+// result.  Same for a double with 53 bits and 10^22.
+template <>
+struct FastFloatTraits<float> {
+  static constexpr uint64_t kMaxSignificand = uint64_t(1) << 24;
+  static constexpr int kMaxExponent = 10;
+};
+
+template <>
+struct FastFloatTraits<double> {
+  static constexpr uint64_t kMaxSignificand = uint64_t(1) << 53;
+  static constexpr int kMaxExponent = 22;
+};
+
+// Parse simple decimal numbers such as "-12.345" or "1.5e-3" with Clinger's
+// fast path, which is exact when both the significand and the power of ten
+// are exactly representable.  Returns false if the string is not of that
+// form, in which case the caller should use the general algorithm.
+template <typename T>
+bool ParseFastFloat(const char* s, size_t length, T* out) {
+  using Traits = FastFloatTraits<T>;
+  const char* end = s + length;
+  const bool negative = (s != end && *s == '-');
+  if (negative) {
+    ++s;
+  }
+
+  uint64_t significand = 0;
+  int num_digits = 0;
+  int exponent = 0;
+  const char* start = s;
+  for (; s != end && detail::ParseDecimalDigit(*s) <= 9U; ++s) {
+    significand = significand * 10 + detail::ParseDecimalDigit(*s);
+  }
+  num_digits = static_cast<int>(s - start);
+  if (num_digits == 0) {
+    return false;
+  }
+  if (s != end && *s == '.') {
+    start = ++s;
+    for (; s != end && detail::ParseDecimalDigit(*s) <= 9U; ++s) {
+      significand = significand * 10 + detail::ParseDecimalDigit(*s);
+    }
+    if (s == start) {
+      return false;
+    }
+    num_digits += static_cast<int>(s - start);
+    exponent = -static_cast<int>(s - start);
+  }
+  // More than 19 digits may have overflowed the significand
+  if (num_digits > 19 || significand > Traits::kMaxSignificand) {
+    return false;
+  }
+  if (s != end && (*s == 'e' || *s == 'E')) {
+    ++s;
+    bool negative_exponent = false;
+    if (s != end && (*s == '-' || *s == '+')) {
+      negative_exponent = (*s++ == '-');
+    }
+    start = s;
+    int explicit_exponent = 0;
+    for (; s != end && detail::ParseDecimalDigit(*s) <= 9U; ++s) {
+      explicit_exponent = explicit_exponent * 10 + detail::ParseDecimalDigit(*s);
+      if (s - start >= 4) {
+        return false;
+      }
+    }
+    if (s == start) {
+      return false;
+    }
+    exponent += negative_exponent ? -explicit_exponent : explicit_exponent;
+  }
+  if (s != end || exponent < -Traits::kMaxExponent || exponent > Traits::kMaxExponent) {
+    return false;
+  }
+
+  T value = static_cast<T>(significand);
+  if (exponent < 0) {
+    value /= static_cast<T>(kExactPowersOfTen[-exponent]);
+  } else {
+    value *= static_cast<T>(kExactPowersOfTen[exponent]);
+  }
+  *out = negative ? -value : value;
+  return true;
+}
+
+}  // namespace
+
 struct StringToFloatConverter::Impl {
   Impl()
       : main_converter_(flags_, main_junk_value_, main_junk_value_, "inf", "nan"),
@@ -48,6 +150,9 @@ StringToFloatConverter::StringToFloatConverter() : impl_(new Impl()) {}
 StringToFloatConverter::~StringToFloatConverter() {}
 
 bool StringToFloatConverter::StringToFloat(const char* s, size_t length, float* out) {
+  if (ParseFastFloat(s, length, out)) {
+    return true;
+  }
   int processed_length;
   float v;
   v = impl_->main_converter_.StringToFloat(s, static_cast<int>(length),
@@ -64,6 +169,9 @@ bool StringToFloatConverter::StringToFloat(const char* s, size_t length, float*
 }
 
 bool StringToFloatConverter::StringToFloat(const char* s, size_t length, double* out) {
+  if (ParseFastFloat(s, length, out)) {
+    return true;
+  }
   int processed_length;
   double v;
   v = impl_->main_converter_.StringToDouble(s, static_cast<int>(length),
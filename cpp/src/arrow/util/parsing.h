@@ -22,6 +22,8 @@
 
 #include <cassert>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <string>
@@ -29,6 +31,7 @@
 
 #include "arrow/type.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/checked_cast.h"
 #include "arrow/util/config.h"
 #include "arrow/vendored/datetime.h"
@@ -189,56 +192,110 @@ inline bool ParseUnsigned(const char* s, size_t length, uint16_t* out) {
   return true;
 }
 
-inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
-  uint32_t result = 0;
-
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
-  PARSE_UNSIGNED_ITERATION(uint32_t);
+// Parse exactly eight decimal digits at once, using SWAR (SIMD within a
+// register) arithmetic on a single 64-bit load.  Returns false if any of the
+// eight characters is not a digit.
+inline bool ParseEightDigits(const char* s, uint32_t* out) {
+  uint64_t v;
+  std::memcpy(&v, s, sizeof(v));
+  // The first character is now in the lowest byte
+  v = BitUtil::FromLittleEndian(v);
+  // Every byte must be in ['0', '9'], i.e. 0x3X with X + 6 not carrying
+  if (ARROW_PREDICT_FALSE(
+          ((v & 0xF0F0F0F0F0F0F0F0ULL) |
+           (((v + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) !=
+          0x3333333333333333ULL)) {
+    return false;
+  }
+  v -= 0x3030303030303030ULL;
+  // Combine adjacent digits into 2-digit, then 4-digit, then 8-digit values
+  v = (v * (1 + (10 << 8))) >> 8;
+  v = ((v & 0x00FF00FF00FF00FFULL) * (1 + (100 << 16))) >> 16;
+  v = ((v & 0x0000FFFF0000FFFFULL) * (1 + (10000ULL << 32))) >> 32;
+  *out = static_cast<uint32_t>(v);
+  return true;
+}
 
-  PARSE_UNSIGNED_ITERATION_LAST(uint32_t);
+// Parse at most 19 decimal digits, which cannot overflow a uint64_t
+inline bool ParseDigits(const char* s, size_t length, uint64_t* out) {
+  uint64_t result = 0;
+  for (; length >= 8; s += 8, length -= 8) {
+    uint32_t chunk;
+    if (ARROW_PREDICT_FALSE(!ParseEightDigits(s, &chunk))) {
+      return false;
+    }
+    result = result * 100000000U + chunk;
+  }
+  for (; length > 0; ++s, --length) {
+    const uint8_t digit = ParseDecimalDigit(*s);
+    if (ARROW_PREDICT_FALSE(digit > 9U)) {
+      return false;
+    }
+    result = result * 10U + digit;
+  }
   *out = result;
   return true;
 }
 
-inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
-  uint64_t result = 0;
+inline bool ParseUnsigned(const char* s, size_t length, uint32_t* out) {
+  uint64_t result;
+  if (ARROW_PREDICT_FALSE(length > 10)) {
+    // Too many digits
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(!ParseDigits(s, length, &result))) {
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(result > std::numeric_limits<uint32_t>::max())) {
+    // Overflow
+    return false;
+  }
+  *out = static_cast<uint32_t>(result);
+  return true;
+}
 
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-  PARSE_UNSIGNED_ITERATION(uint64_t);
-
-  PARSE_UNSIGNED_ITERATION_LAST(uint64_t);
-  *out = result;
+inline bool ParseUnsigned(const char* s, size_t length, uint64_t* out) {
+  static constexpr uint64_t kMax = std::numeric_limits<uint64_t>::max();
+  uint64_t result;
+  if (ARROW_PREDICT_TRUE(length < 20)) {
+    return ParseDigits(s, length, out);
+  }
+  if (ARROW_PREDICT_FALSE(length > 20)) {
+    // Too many digits
+    return false;
+  }
+  // Only the 20th digit may overflow
+  if (ARROW_PREDICT_FALSE(!ParseDigits(s, 19, &result))) {
+    return false;
+  }
+  const uint8_t digit = ParseDecimalDigit(s[19]);
+  if (ARROW_PREDICT_FALSE(digit > 9U)) {
+    // Non-digit
+    return false;
+  }
+  if (ARROW_PREDICT_FALSE(result > kMax / 10U || result * 10U > kMax - digit)) {
+    // Overflow
+    return false;
+  }
+  *out = result * 10U + digit;
   return true;
 }
 
+// Parse exactly two and four decimal digits, as found in fixed-width fields
+inline bool ParseTwoDigits(const char* s, uint8_t* out) {
+  const uint8_t d0 = ParseDecimalDigit(s[0]);
+  const uint8_t d1 = ParseDecimalDigit(s[1]);
+  *out = static_cast<uint8_t>(d0 * 10 + d1);
+  return ARROW_PREDICT_TRUE((d0 <= 9U) & (d1 <= 9U));
+}
+
+inline bool ParseFourDigits(const char* s, uint16_t* out) {
+  uint8_t hi, lo;
+  const bool ok = ParseTwoDigits(s, &hi) & ParseTwoDigits(s + 2, &lo);
+  *out = static_cast<uint16_t>(hi * 100 + lo);
+  return ARROW_PREDICT_TRUE(ok);
+}
+
 #undef PARSE_UNSIGNED_ITERATION
 #undef PARSE_UNSIGNED_ITERATION_LAST
 
@@ -430,13 +487,9 @@ class StringConverter<TimestampType> {
     if (ARROW_PREDICT_FALSE(s[4] != '-') || ARROW_PREDICT_FALSE(s[7] != '-')) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 4, &year))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 5, 2, &month))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 8, 2, &day))) {
+    if (ARROW_PREDICT_FALSE(!(detail::ParseFourDigits(s + 0, &year) &
+                              detail::ParseTwoDigits(s + 5, &month) &
+                              detail::ParseTwoDigits(s + 8, &day)))) {
       return false;
     }
     *out = {arrow_vendored::date::year{year}, arrow_vendored::date::month{month},
@@ -449,13 +502,9 @@ class StringConverter<TimestampType> {
     if (ARROW_PREDICT_FALSE(s[2] != ':') || ARROW_PREDICT_FALSE(s[5] != ':')) {
       return false;
     }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 0, 2, &hours))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 3, 2, &minutes))) {
-      return false;
-    }
-    if (ARROW_PREDICT_FALSE(!detail::ParseUnsigned(s + 6, 2, &seconds))) {
+    if (ARROW_PREDICT_FALSE(!(detail::ParseTwoDigits(s + 0, &hours) &
+                              detail::ParseTwoDigits(s + 3, &minutes) &
+                              detail::ParseTwoDigits(s + 6, &seconds)))) {
       return false;
     }
     if (ARROW_PREDICT_FALSE(hours >= 24)) {
@@ -474,6 +523,45 @@ class StringConverter<TimestampType> {
   const TimeUnit::type unit_;
 };
 
+/// \brief Convert a run of binary-like values with a StringConverter
+///
+/// `offsets` and `data` are the raw offsets and data of the values, and
+/// `null_bitmap` (which may be null if there are no nulls) is read starting at
+/// bit `bitmap_offset`.  Output slots of null values are left untouched.
+///
+/// Returns the index of the first value that failed to convert, or `length`
+/// if all values were converted.
+template <typename Converter, typename offset_type>
+int64_t ConvertStrings(Converter* converter, const offset_type* offsets,
+                       const uint8_t* data, const uint8_t* null_bitmap,
+                       int64_t bitmap_offset, int64_t length,
+                       typename Converter::value_type* out) {
+  if (null_bitmap == NULLPTR) {
+    for (int64_t i = 0; i < length; ++i) {
+      const offset_type pos = offsets[i];
+      if (ARROW_PREDICT_FALSE(!(*converter)(reinterpret_cast<const char*>(data + pos),
+                                            static_cast<size_t>(offsets[i + 1] - pos),
+                                            out + i))) {
+        return i;
+      }
+    }
+    return length;
+  }
+  BitmapReader valid_reader(null_bitmap, bitmap_offset, length);
+  for (int64_t i = 0; i < length; ++i, valid_reader.Next()) {
+    if (!valid_reader.IsSet()) {
+      continue;
+    }
+    const offset_type pos = offsets[i];
+    if (ARROW_PREDICT_FALSE(!(*converter)(reinterpret_cast<const char*>(data + pos),
+                                          static_cast<size_t>(offsets[i + 1] - pos),
+                                          out + i))) {
+      return i;
+    }
+  }
+  return length;
+}
+
 }  // namespace internal
 }  // namespace arrow
 
@@ -16,6 +16,7 @@
 // under the License.
 
 #include <string>
+#include <vector>
 
 #include <gtest/gtest.h>
 
@@ -81,6 +82,28 @@ TEST(StringConversion, ToDouble) {
   AssertConversionFails(converter, "e");
 }
 
+TEST(StringConversion, ToDoubleFastPath) {
+  StringConverter<DoubleType> converter;
+
+  // Simple decimals are parsed without double-conversion
+  AssertConversion(converter, "0.1", 0.1);
+  AssertConversion(converter, "-123.456", -123.456);
+  AssertConversion(converter, "1.5e-3", 1.5e-3);
+  AssertConversion(converter, "1E22", 1e22);
+  AssertConversion(converter, "9007199254740992", 9007199254740992.0);
+  // Outside of the fast path range
+  AssertConversion(converter, "9007199254740993", 9007199254740992.0);
+  AssertConversion(converter, "1e23", 1e23);
+  AssertConversion(converter, "1.", 1.0);
+  AssertConversion(converter, ".5", 0.5);
+  AssertConversion(converter, "+1.5", 1.5);
+
+  AssertConversionFails(converter, "-");
+  AssertConversionFails(converter, "1e");
+  AssertConversionFails(converter, "1.5x");
+  AssertConversionFails(converter, "1.5e3x");
+}
+
 #if !defined(_WIN32) || defined(NDEBUG)
 
 TEST(StringConversion, ToFloatLocale) {
@@ -204,12 +227,20 @@ TEST(StringConversion, ToUInt32) {
   AssertConversion(converter, "432198765", 432198765UL);
   AssertConversion(converter, "4294967295", 4294967295UL);
   AssertConversion(converter, "04294967295", 4294967295UL);
+  AssertConversion(converter, "12345678", 12345678UL);
+  AssertConversion(converter, "1234567890", 1234567890UL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "4294967296");
+  AssertConversionFails(converter, "9999999999");
   AssertConversionFails(converter, "12345678901");
 
+  // Non-digits within and after a block of eight digits
+  AssertConversionFails(converter, "1234:678");
+  AssertConversionFails(converter, "1234/678");
+  AssertConversionFails(converter, "12345678a");
+
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
   AssertConversionFails(converter, "0.0");
@@ -240,10 +271,17 @@ TEST(StringConversion, ToUInt64) {
 
   AssertConversion(converter, "0", 0);
   AssertConversion(converter, "18446744073709551615", 18446744073709551615ULL);
+  AssertConversion(converter, "1234567890123456789", 1234567890123456789ULL);
+  AssertConversion(converter, "10000000000000000000", 10000000000000000000ULL);
 
   // Non-representable values
   AssertConversionFails(converter, "-1");
   AssertConversionFails(converter, "18446744073709551616");
+  AssertConversionFails(converter, "19999999999999999999");
+  AssertConversionFails(converter, "100000000000000000000");
+
+  AssertConversionFails(converter, "1234567890123456 89");
+  AssertConversionFails(converter, "1844674407370955161x");
 
   AssertConversionFails(converter, "");
   AssertConversionFails(converter, "-");
@@ -345,4 +383,28 @@ TEST(StringConversion, ToTimestamp2) {
   }
 }
 
+TEST(StringConversion, ConvertStrings) {
+  StringConverter<Int32Type> converter;
+  // "12", "", "-3", "x", "45"
+  const std::string data = "12-3x45";
+  const std::vector<int32_t> offsets = {0, 2, 2, 4, 5, 7};
+  const auto raw_data = reinterpret_cast<const uint8_t*>(data.data());
+  std::vector<int32_t> out(5, 0);
+
+  // Without a null bitmap, the empty string fails
+  ASSERT_EQ(1, internal::ConvertStrings(&converter, offsets.data(), raw_data,
+                                         NULLPTR, 0, 5, out.data()));
+
+  // Slots 1 and 3 are null (bitmap read from bit 1)
+  const uint8_t null_bitmap[] = {0x2A};
+  ASSERT_EQ(5, internal::ConvertStrings(&converter, offsets.data(), raw_data,
+                                         null_bitmap, 1, 5, out.data()));
+  ASSERT_EQ(out, std::vector<int32_t>({12, 0, -3, 0, 45}));
+
+  // Slot 3 is valid
+  const uint8_t bad_null_bitmap[] = {0x3A};
+  ASSERT_EQ(3, internal::ConvertStrings(&converter, offsets.data(), raw_data,
+                                         bad_null_bitmap, 1, 5, out.data()));
+}
+
 }  // namespace arrow
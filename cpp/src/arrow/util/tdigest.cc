@@ -0,0 +1,243 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include "arrow/util/tdigest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+
+#include "arrow/util/bit_util.h"
+
+namespace arrow {
+namespace util {
+
+namespace {
+
+// Serialized layout, little-endian: format version (uint8), compression (uint32),
+// min and max (double), number of centroids (uint32), then the mean and weight
+// (double) of each centroid
+constexpr uint8_t kFormatVersion = 1;
+constexpr size_t kHeaderSize = 1 + 4 + 8 + 8 + 4;
+constexpr size_t kCentroidSize = 8 + 8;
+
+constexpr double kPi = 3.14159265358979323846;
+
+void AppendUInt32(uint32_t value, std::string* out) {
+  value = BitUtil::ToLittleEndian(value);
+  out->append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void AppendDouble(double value, std::string* out) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  bits = BitUtil::ToLittleEndian(bits);
+  out->append(reinterpret_cast<const char*>(&bits), sizeof(bits));
+}
+
+uint32_t ReadUInt32(const char* data) {
+  uint32_t value;
+  std::memcpy(&value, data, sizeof(value));
+  return BitUtil::FromLittleEndian(value);
+}
+
+double ReadDouble(const char* data) {
+  uint64_t bits;
+  std::memcpy(&bits, data, sizeof(bits));
+  bits = BitUtil::FromLittleEndian(bits);
+  double value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+}  // namespace
+
+constexpr uint32_t TDigest::kDefaultCompression;
+
+TDigest::TDigest(uint32_t compression)
+    : compression_(std::max<uint32_t>(compression, 10)),
+      buffer_capacity_(5 * static_cast<size_t>(compression_)),
+      min_(std::numeric_limits<double>::infinity()),
+      max_(-std::numeric_limits<double>::infinity()) {}
+
+void TDigest::Merge(const TDigest& other) {
+  values_.insert(values_.end(), other.values_.begin(), other.values_.end());
+  buffer_.insert(buffer_.end(), other.centroids_.begin(), other.centroids_.end());
+  buffer_.insert(buffer_.end(), other.buffer_.begin(), other.buffer_.end());
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  if (values_.size() + buffer_.size() >= buffer_capacity_) {
+    Compress();
+  }
+}
+
+void TDigest::Compress() {
+  if (values_.empty() && buffer_.empty()) return;
+
+  // Merge the sorted values, buffered centroids and current centroids
+  auto by_mean = [](const Centroid& l, const Centroid& r) { return l.mean < r.mean; };
+  std::sort(values_.begin(), values_.end());
+  std::sort(buffer_.begin(), buffer_.end(), by_mean);
+  sorted_.clear();
+  sorted_.reserve(values_.size() + buffer_.size() + centroids_.size());
+  for (double value : values_) {
+    sorted_.push_back({value, 1});
+  }
+  const auto num_values = static_cast<std::ptrdiff_t>(sorted_.size());
+  sorted_.insert(sorted_.end(), buffer_.begin(), buffer_.end());
+  std::inplace_merge(sorted_.begin(), sorted_.begin() + num_values, sorted_.end(),
+                     by_mean);
+  const auto num_buffered = static_cast<std::ptrdiff_t>(sorted_.size());
+  sorted_.insert(sorted_.end(), centroids_.begin(), centroids_.end());
+  std::inplace_merge(sorted_.begin(), sorted_.begin() + num_buffered, sorted_.end(),
+                     by_mean);
+  values_.clear();
+  buffer_.clear();
+
+  min_ = std::min(min_, sorted_.front().mean);
+  max_ = std::max(max_, sorted_.back().mean);
+  double total_weight = 0;
+  for (const Centroid& centroid : sorted_) {
+    total_weight += centroid.weight;
+  }
+
+  // With the scale function k(q) = compression / (2 pi) * asin(2q - 1), a
+  // centroid may span at most one unit of k. Return the highest quantile which
+  // a centroid starting at quantile q may reach.
+  const double normalizer = compression_ / (2 * kPi);
+  auto quantile_limit = [&](double q) {
+    const double k = normalizer * std::asin(2 * q - 1) + 1;
+    if (k >= compression_ / 4.0) return 1.0;
+    return (std::sin(k / normalizer) + 1) / 2;
+  };
+
+  centroids_.clear();
+  Centroid current = sorted_.front();
+  double weight_before = 0;
+  double limit = quantile_limit(0);
+  for (size_t i = 1; i < sorted_.size(); ++i) {
+    const Centroid& next = sorted_[i];
+    const double merged_weight = current.weight + next.weight;
+    if ((weight_before + merged_weight) / total_weight <= limit) {
+      current.mean += (next.mean - current.mean) * next.weight / merged_weight;
+      current.weight = merged_weight;
+    } else {
+      centroids_.push_back(current);
+      weight_before += current.weight;
+      limit = quantile_limit(weight_before / total_weight);
+      current = next;
+    }
+  }
+  centroids_.push_back(current);
+  total_weight_ = total_weight;
+}
+
+void TDigest::Reset() {
+  centroids_.clear();
+  values_.clear();
+  buffer_.clear();
+  total_weight_ = 0;
+  min_ = std::numeric_limits<double>::infinity();
+  max_ = -std::numeric_limits<double>::infinity();
+}
+
+double TDigest::Quantile(double q) {
+  Compress();
+  if (centroids_.empty()) {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  if (centroids_.size() == 1) {
+    return centroids_[0].mean;
+  }
+
+  // Each centroid is assumed to be centered on its mean, and values in between
+  // centroids (or between the extreme centroids and min / max) are interpolated
+  const double target = std::min(std::max(q, 0.0), 1.0) * total_weight_;
+  const Centroid& first = centroids_.front();
+  const Centroid& last = centroids_.back();
+  if (target <= first.weight / 2) {
+    return min_ + (first.mean - min_) * target / (first.weight / 2);
+  }
+  if (target >= total_weight_ - last.weight / 2) {
+    const double past = target - (total_weight_ - last.weight / 2);
+    return last.mean + (max_ - last.mean) * past / (last.weight / 2);
+  }
+
+  double center = first.weight / 2;
+  for (size_t i = 0; i + 1 < centroids_.size(); ++i) {
+    const double next_center =
+        center + (centroids_[i].weight + centroids_[i + 1].weight) / 2;
+    if (target <= next_center) {
+      const double fraction = (target - center) / (next_center - center);
+      return centroids_[i].mean +
+             fraction * (centroids_[i + 1].mean - centroids_[i].mean);
+    }
+    center = next_center;
+  }
+  return last.mean;
+}
+
+std::string TDigest::Serialize() const {
+  if (!values_.empty() || !buffer_.empty()) {
+    TDigest compressed = *this;
+    compressed.Compress();
+    return compressed.Serialize();
+  }
+
+  std::string out;
+  out.reserve(kHeaderSize + centroids_.size() * kCentroidSize);
+  out.push_back(static_cast<char>(kFormatVersion));
+  AppendUInt32(compression_, &out);
+  AppendDouble(min_, &out);
+  AppendDouble(max_, &out);
+  AppendUInt32(static_cast<uint32_t>(centroids_.size()), &out);
+  for (const Centroid& centroid : centroids_) {
+    AppendDouble(centroid.mean, &out);
+    AppendDouble(centroid.weight, &out);
+  }
+  return out;
+}
+
+Status TDigest::Deserialize(util::string_view data, TDigest* out) {
+  if (data.size() < kHeaderSize || static_cast<uint8_t>(data[0]) != kFormatVersion) {
+    return Status::Invalid("Not a serialized t-digest sketch");
+  }
+  const char* p = data.data() + 1;
+  TDigest digest(ReadUInt32(p));
+  digest.min_ = ReadDouble(p + 4);
+  digest.max_ = ReadDouble(p + 12);
+  const uint32_t num_centroids = ReadUInt32(p + 20);
+  if (data.size() != kHeaderSize + num_centroids * kCentroidSize) {
+    return Status::Invalid("Corrupt serialized t-digest sketch");
+  }
+
+  p = data.data() + kHeaderSize;
+  digest.centroids_.resize(num_centroids);
+  for (Centroid& centroid : digest.centroids_) {
+    centroid.mean = ReadDouble(p);
+    centroid.weight = ReadDouble(p + 8);
+    digest.total_weight_ += centroid.weight;
+    p += kCentroidSize;
+  }
+  *out = std::move(digest);
+  return Status::OK();
+}
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,103 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "arrow/status.h"
+#include "arrow/util/string_view.h"
+#include "arrow/util/visibility.h"
+
+namespace arrow {
+namespace util {
+
+/// \brief A t-digest sketch estimating quantiles of a stream of doubles
+///
+/// The values are summarized by at most about `compression` weighted centroids,
+/// which are smaller near the extremes so that tail quantiles are the most
+/// accurate (see Dunning & Ertl, "Computing extremely accurate quantiles using
+/// t-digests"). Added values are buffered and merged into the centroids in
+/// batches. Sketches can be merged, and serialized to be merged in another
+/// process.
+class ARROW_EXPORT TDigest {
+ public:
+  static constexpr uint32_t kDefaultCompression = 100;
+
+  explicit TDigest(uint32_t compression = kDefaultCompression);
+
+  uint32_t compression() const { return compression_; }
+
+  /// \brief Add a value to the sketch; NaN values are ignored
+  void Add(double value) {
+    if (value != value) return;
+    values_.push_back(value);
+    if (values_.size() >= buffer_capacity_) {
+      Compress();
+    }
+  }
+
+  /// \brief Fold another sketch into this one
+  void Merge(const TDigest& other);
+
+  /// \brief Merge the buffered values into the centroids
+  void Compress();
+
+  /// \brief Remove all values from the sketch
+  void Reset();
+
+  /// \brief Whether no value was added to the sketch
+  bool is_empty() const {
+    return total_weight_ == 0 && values_.empty() && buffer_.empty();
+  }
+
+  /// \brief Estimate the q-th quantile of the values, with q in [0, 1]
+  ///
+  /// Returns NaN if the sketch is empty.
+  double Quantile(double q);
+
+  /// \brief Serialize the sketch to a platform-independent string
+  std::string Serialize() const;
+
+  /// \brief Read a sketch written by Serialize
+  static Status Deserialize(util::string_view data, TDigest* out);
+
+ private:
+  struct Centroid {
+    double mean;
+    double weight;
+  };
+
+  uint32_t compression_;
+  size_t buffer_capacity_;
+  // Sorted by mean
+  std::vector<Centroid> centroids_;
+  // Added values and merged centroids, not yet compressed. Unit weight values
+  // are kept apart as doubles are much faster to sort.
+  std::vector<double> values_;
+  std::vector<Centroid> buffer_;
+  // All centroids in order of mean, before compression
+  std::vector<Centroid> sorted_;
+  double total_weight_ = 0;
+  double min_;
+  double max_;
+};
+
+}  // namespace util
+}  // namespace arrow
@@ -0,0 +1,136 @@
+// Licensed to the Apache Software Foundation (ASF) under one
+// or more contributor license agreements.  See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership.  The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing,
+// software distributed under the License is distributed on an
+// "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.  See the License for the
+// specific language governing permissions and limitations
+// under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arrow/testing/gtest_util.h"
+#include "arrow/util/tdigest.h"
+
+namespace arrow {
+namespace util {
+
+static std::vector<double> RandomValues(int64_t n, uint32_t seed) {
+  std::default_random_engine gen(seed);
+  std::normal_distribution<double> dist(10, 3);
+  std::vector<double> values(n);
+  std::generate(values.begin(), values.end(), [&] { return dist(gen); });
+  return values;
+}
+
+// Check the estimates against the exact quantiles, in rank space: the estimate of
+// the q-th quantile must lie between the exact (q - error)-th and (q + error)-th
+static void AssertQuantilesNear(TDigest* digest, std::vector<double> values,
+                                double error) {
+  std::sort(values.begin(), values.end());
+  const auto last = static_cast<double>(values.size() - 1);
+  auto exact = [&](double q) {
+    return values[static_cast<size_t>(std::min(std::max(q, 0.0), 1.0) * last)];
+  };
+  for (double q : {0.0, 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1.0}) {
+    const double estimate = digest->Quantile(q);
+    ASSERT_GE(estimate, exact(q - error)) << "quantile " << q;
+    ASSERT_LE(estimate, exact(q + error)) << "quantile " << q;
+  }
+  ASSERT_EQ(digest->Quantile(0), values.front());
+  ASSERT_EQ(digest->Quantile(1), values.back());
+}
+
+TEST(TDigest, Empty) {
+  TDigest digest;
+  ASSERT_TRUE(digest.is_empty());
+  ASSERT_TRUE(std::isnan(digest.Quantile(0.5)));
+  digest.Add(std::nan(""));
+  ASSERT_TRUE(digest.is_empty());
+}
+
+TEST(TDigest, Small) {
+  TDigest digest;
+  for (double value : {3.0, 1.0, 2.0}) {
+    digest.Add(value);
+  }
+  ASSERT_FALSE(digest.is_empty());
+  ASSERT_EQ(digest.Quantile(0), 1.0);
+  ASSERT_EQ(digest.Quantile(0.5), 2.0);
+  ASSERT_EQ(digest.Quantile(1), 3.0);
+}
+
+TEST(TDigest, Quantiles) {
+  const auto values = RandomValues(100000, 42);
+  TDigest digest;
+  for (double value : values) {
+    digest.Add(value);
+  }
+  AssertQuantilesNear(&digest, values, 0.01);
+}
+
+TEST(TDigest, Merge) {
+  auto values = RandomValues(50000, 1);
+  // Merge sketches of very different distributions
+  for (double& value : values) {
+    value += 100;
+  }
+  const auto other_values = RandomValues(50000, 2);
+
+  TDigest digest, other;
+  for (double value : values) {
+    digest.Add(value);
+  }
+  for (double value : other_values) {
+    other.Add(value);
+  }
+  digest.Merge(other);
+  values.insert(values.end(), other_values.begin(), other_values.end());
+  AssertQuantilesNear(&digest, values, 0.01);
+
+  TDigest empty;
+  digest.Merge(empty);
+  AssertQuantilesNear(&digest, values, 0.01);
+}
+
+TEST(TDigest, Serialize) {
+  const auto values = RandomValues(10000, 3);
+  TDigest digest(50);
+  for (double value : values) {
+    digest.Add(value);
+  }
+  // Buffered values are serialized too
+  const std::string serialized = digest.Serialize();
+
+  TDigest roundtripped;
+  ASSERT_OK(TDigest::Deserialize(serialized, &roundtripped));
+  ASSERT_EQ(roundtripped.compression(), 50);
+  for (double q : {0.0, 0.1, 0.5, 0.99, 1.0}) {
+    ASSERT_EQ(roundtripped.Quantile(q), digest.Quantile(q));
+  }
+  ASSERT_EQ(roundtripped.Serialize(), serialized);
+
+  TDigest empty;
+  ASSERT_OK(TDigest::Deserialize(TDigest().Serialize(), &empty));
+  ASSERT_TRUE(empty.is_empty());
+
+  ASSERT_RAISES(Invalid, TDigest::Deserialize("", &roundtripped));
+  ASSERT_RAISES(Invalid, TDigest::Deserialize(serialized.substr(0, 40), &roundtripped));
+}
+
+}  // namespace util
+}  // namespace arrow
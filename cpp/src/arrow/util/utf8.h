@@ -172,6 +172,34 @@ inline bool ValidateUTF8(const util::string_view& str) {
   return ValidateUTF8(data, length);
 }
 
+// Return whether all bytes are ASCII, i.e. have their high bit cleared.
+// ASCII data is valid UTF8 where each character is a single byte.
+inline bool ValidateAscii(const uint8_t* data, int64_t size) {
+  static constexpr uint64_t high_bits_64 = 0x8080808080808080ULL;
+  uint64_t words[8];
+
+  // Check 64 bytes at a time, without branching on each word
+  while (size >= 64) {
+    memcpy(words, data, 64);
+    const uint64_t mask = words[0] | words[1] | words[2] | words[3] | words[4] |
+                          words[5] | words[6] | words[7];
+    if (ARROW_PREDICT_FALSE((mask & high_bits_64) != 0)) {
+      return false;
+    }
+    size -= 64;
+    data += 64;
+  }
+  uint8_t mask = 0;
+  while (size-- > 0) {
+    mask |= *data++;
+  }
+  return (mask & 0x80) == 0;
+}
+
+inline bool ValidateAscii(const util::string_view& str) {
+  return ValidateAscii(reinterpret_cast<const uint8_t*>(str.data()), str.size());
+}
+
 // Skip UTF8 byte order mark, if any.
 ARROW_EXPORT
 Result<const uint8_t*> SkipUTF8BOM(const uint8_t* data, int64_t size);
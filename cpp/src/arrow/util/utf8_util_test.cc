@@ -251,6 +251,21 @@ TEST_F(UTF8ValidationTest, RandomTruncated) {
   }
 }
 
+TEST(ValidateAscii, Basics) {
+  ASSERT_TRUE(ValidateAscii(""));
+  ASSERT_TRUE(ValidateAscii("abc\x7f"));
+  ASSERT_FALSE(ValidateAscii("\xc3\xa9"));
+
+  // A single non-ASCII byte anywhere, in the word-wise part or the tail
+  const std::string ascii(200, 'x');
+  for (size_t pos : {0, 7, 63, 64, 100, 127, 128, 199}) {
+    std::string s = ascii;
+    s[pos] = '\x80';
+    ASSERT_FALSE(ValidateAscii(s)) << pos;
+    ASSERT_TRUE(ValidateAscii(util::string_view(s).substr(pos + 1))) << pos;
+  }
+}
+
 TEST(SkipUTF8BOM, Basics) {
   auto CheckOk = [](const std::string& s, size_t expected_offset) -> void {
     const uint8_t* data = reinterpret_cast<const uint8_t*>(s.data());
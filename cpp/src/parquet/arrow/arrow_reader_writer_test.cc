@@ -24,15 +24,18 @@
 #include "gtest/gtest.h"
 
 #include <arrow/compute/api.h>
+#include <algorithm>
 #include <cstdint>
 #include <functional>
 #include <sstream>
 #include <vector>
 
 #include "arrow/api.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/testing/random.h"
 #include "arrow/testing/util.h"
 #include "arrow/type_traits.h"
+#include "arrow/util/bit_util.h"
 #include "arrow/util/decimal.h"
 #include "arrow/util/logging.h"
 
@@ -2575,10 +2578,119 @@ TEST_F(TestNestedSchemaRead, ReadTablePartial) {
   ASSERT_NO_FATAL_FAILURE(ValidateTableArrayTypes(*table));
 }
 
-TEST_F(TestNestedSchemaRead, StructAndListTogetherUnsupported) {
+TEST_F(TestNestedSchemaRead, RepeatedGroupAsListOfStruct) {
   ASSERT_NO_FATAL_FAILURE(CreateSimpleNestedParquet(Repetition::REPEATED));
   std::shared_ptr<Table> table;
-  ASSERT_RAISES(NotImplemented, reader_->ReadTable(&table));
+  ASSERT_OK_NO_THROW(reader_->ReadTable(&table));
+  ASSERT_EQ(table->num_rows(), NUM_SIMPLE_TEST_ROWS);
+  ASSERT_EQ(table->num_columns(), 2);
+  ASSERT_NO_FATAL_FAILURE(ValidateTableArrayTypes(*table));
+
+  // Every third list is empty, the others hold a single struct
+  auto list_array = std::static_pointer_cast<ListArray>(table->column(0)->chunk(0));
+  ASSERT_OK(list_array->ValidateFull());
+  ASSERT_EQ(list_array->null_count(), 0);
+  for (int i = 0; i < NUM_SIMPLE_TEST_ROWS; i++) {
+    ASSERT_EQ(list_array->value_length(i), (i % 3 == 0) ? 0 : 1);
+  }
+
+  auto struct_array =
+      std::static_pointer_cast<::arrow::StructArray>(list_array->values());
+  ASSERT_EQ(struct_array->length(), NUM_SIMPLE_TEST_ROWS * 2 / 3);
+  ASSERT_EQ(struct_array->null_count(), 0);
+  auto leaf1_array =
+      std::static_pointer_cast<::arrow::Int32Array>(struct_array->field(0));
+  auto leaf2_array =
+      std::static_pointer_cast<::arrow::Int32Array>(struct_array->field(1));
+  ASSERT_EQ(leaf1_array->null_count(), 0);
+  ASSERT_EQ(leaf2_array->null_count(), NUM_SIMPLE_TEST_ROWS / 3);
+  for (int i = 0; i < struct_array->length(); i++) {
+    ASSERT_EQ(leaf1_array->Value(i), values_array_->Value(i));
+    if (i % 2 == 0) {
+      ASSERT_TRUE(leaf2_array->IsNull(i));
+    } else {
+      ASSERT_EQ(leaf2_array->Value(i), values_array_->Value(i / 2));
+    }
+  }
+}
+
+TEST_F(TestNestedSchemaRead, ListOfStructWithNestedList) {
+  // optional group col (LIST) {
+  //   repeated group list {
+  //     optional group element {
+  //       optional int32 a;
+  //       optional group b (LIST) {
+  //         repeated group list {
+  //           optional int32 element;
+  //         }
+  //       }
+  //     }
+  //   }
+  // }
+  auto b_node = GroupNode::Make(
+      "b", Repetition::OPTIONAL,
+      {GroupNode::Make(
+          "list", Repetition::REPEATED,
+          {PrimitiveNode::Make("element", Repetition::OPTIONAL, ParquetType::INT32)})},
+      LogicalType::List());
+  auto element_node = GroupNode::Make(
+      "element", Repetition::OPTIONAL,
+      {PrimitiveNode::Make("a", Repetition::OPTIONAL, ParquetType::INT32), b_node});
+  auto col_node = GroupNode::Make(
+      "col", Repetition::OPTIONAL,
+      {GroupNode::Make("list", Repetition::REPEATED, {element_node})},
+      LogicalType::List());
+  auto schema_node = GroupNode::Make("schema", Repetition::REQUIRED, {col_node});
+
+  // Rows:
+  //   null
+  //   []
+  //   [null, {"a": 1, "b": null}, {"a": null, "b": []}]
+  //   [{"a": 2, "b": [3, null, 4]}]
+  std::vector<int16_t> a_def_levels = {0, 1, 2, 4, 3, 4};
+  std::vector<int16_t> a_rep_levels = {0, 0, 0, 1, 1, 0};
+  std::vector<int32_t> a_values = {1, 2};
+  std::vector<int16_t> b_def_levels = {0, 1, 2, 3, 4, 6, 5, 6};
+  std::vector<int16_t> b_rep_levels = {0, 0, 0, 1, 1, 0, 2, 2};
+  std::vector<int32_t> b_values = {3, 4};
+
+  InitNewParquetFile(std::static_pointer_cast<GroupNode>(schema_node), 4);
+  WriteColumnData(a_def_levels.size(), a_def_levels.data(), a_rep_levels.data(),
+                  a_values.data());
+  WriteColumnData(b_def_levels.size(), b_def_levels.data(), b_rep_levels.data(),
+                  b_values.data());
+  FinalizeParquetFile();
+  InitReader();
+
+  auto b_type = ::arrow::list(::arrow::field("element", ::arrow::int32()));
+  auto MakeExpected = [](std::vector<std::shared_ptr<::arrow::Field>> element_fields,
+                         const std::string& json) {
+    auto type =
+        ::arrow::list(::arrow::field("element", ::arrow::struct_(element_fields)));
+    return ::arrow::ArrayFromJSON(type, json);
+  };
+
+  std::shared_ptr<Table> table;
+  ASSERT_OK_NO_THROW(reader_->ReadTable(&table));
+  ASSERT_EQ(table->num_rows(), 4);
+  ASSERT_OK(table->ValidateFull());
+  auto expected = MakeExpected(
+      {::arrow::field("a", ::arrow::int32()), ::arrow::field("b", b_type)},
+      R"([null, [], [null, {"a": 1, "b": null}, {"a": null, "b": []}],
+          [{"a": 2, "b": [3, null, 4]}]])");
+  ::arrow::AssertArraysEqual(*expected, *table->column(0)->chunk(0));
+
+  // Only the levels of the selected leaf are used to reassemble the lists
+  ASSERT_OK_NO_THROW(reader_->ReadTable({0}, &table));
+  expected = MakeExpected({::arrow::field("a", ::arrow::int32())},
+                          R"([null, [], [null, {"a": 1}, {"a": null}], [{"a": 2}]])");
+  ::arrow::AssertArraysEqual(*expected, *table->column(0)->chunk(0));
+
+  ASSERT_OK_NO_THROW(reader_->ReadTable({1}, &table));
+  expected = MakeExpected({::arrow::field("b", b_type)},
+                          R"([null, [], [null, {"b": null}, {"b": []}],
+                              [{"b": [3, null, 4]}]])");
+  ::arrow::AssertArraysEqual(*expected, *table->column(0)->chunk(0));
 }
 
 TEST_P(TestNestedSchemaRead, DeepNestedSchemaRead) {
@@ -2608,6 +2720,122 @@ TEST_P(TestNestedSchemaRead, DeepNestedSchemaRead) {
 INSTANTIATE_TEST_CASE_P(Repetition_type, TestNestedSchemaRead,
                         ::testing::Values(Repetition::REQUIRED, Repetition::OPTIONAL));
 
+LevelInfo MakeLevelInfo(int16_t def_level, int16_t rep_level,
+                        int16_t repeated_ancestor_def_level, bool nullable) {
+  LevelInfo level_info;
+  level_info.def_level = def_level;
+  level_info.rep_level = rep_level;
+  level_info.repeated_ancestor_def_level = repeated_ancestor_def_level;
+  level_info.nullable = nullable;
+  return level_info;
+}
+
+void CheckLevelsBitmap(const std::shared_ptr<Buffer>& valid_bits,
+                       const std::vector<bool>& expected) {
+  if (std::find(expected.begin(), expected.end(), false) == expected.end()) {
+    // No bitmap without nulls
+    ASSERT_EQ(nullptr, valid_bits);
+    return;
+  }
+  ASSERT_NE(nullptr, valid_bits);
+  for (size_t i = 0; i < expected.size(); ++i) {
+    ASSERT_EQ(expected[i], ::arrow::BitUtil::GetBit(valid_bits->data(), i)) << i;
+  }
+}
+
+void CheckListOffsets(const std::vector<int16_t>& def_levels,
+                      const std::vector<int16_t>& rep_levels,
+                      const LevelInfo& level_info,
+                      const std::vector<int32_t>& expected_offsets,
+                      const std::vector<bool>& expected_valid) {
+  int64_t length = -1;
+  int64_t null_count = -1;
+  std::shared_ptr<Buffer> offsets, valid_bits;
+  ASSERT_OK(LevelsToListOffsets(def_levels.data(), rep_levels.data(),
+                                static_cast<int64_t>(def_levels.size()), level_info,
+                                default_memory_pool(), &length, &offsets, &valid_bits,
+                                &null_count));
+  ASSERT_EQ(static_cast<int64_t>(expected_valid.size()), length);
+  ASSERT_EQ(std::count(expected_valid.begin(), expected_valid.end(), false), null_count);
+  ASSERT_EQ((length + 1) * static_cast<int64_t>(sizeof(int32_t)), offsets->size());
+  auto offsets_data = reinterpret_cast<const int32_t*>(offsets->data());
+  ASSERT_EQ(expected_offsets,
+            std::vector<int32_t>(offsets_data, offsets_data + length + 1));
+  CheckLevelsBitmap(valid_bits, expected_valid);
+}
+
+// rep_levels may be empty if the struct is not nested in a list
+void CheckStructBitmap(const std::vector<int16_t>& def_levels,
+                       const std::vector<int16_t>& rep_levels,
+                       const LevelInfo& level_info,
+                       const std::vector<bool>& expected_valid) {
+  int64_t length = -1;
+  int64_t null_count = -1;
+  std::shared_ptr<Buffer> valid_bits;
+  ASSERT_OK(LevelsToStructBitmap(def_levels.data(),
+                                 rep_levels.empty() ? nullptr : rep_levels.data(),
+                                 static_cast<int64_t>(def_levels.size()), level_info,
+                                 default_memory_pool(), &length, &valid_bits,
+                                 &null_count));
+  ASSERT_EQ(static_cast<int64_t>(expected_valid.size()), length);
+  ASSERT_EQ(std::count(expected_valid.begin(), expected_valid.end(), false), null_count);
+  CheckLevelsBitmap(valid_bits, expected_valid);
+}
+
+// The levels of the two leaves of the schema and rows of
+// TestNestedSchemaRead.ListOfStructWithNestedList:
+//   col: optional list (def 1, list def 2, rep 1)
+//     element: optional struct (def 3)
+//       a: optional int32 (def 4)
+//       b: optional list (def 4, list def 5, rep 2)
+//         element: optional int32 (def 6)
+const std::vector<int16_t> kNestedADefLevels = {0, 1, 2, 4, 3, 4};
+const std::vector<int16_t> kNestedARepLevels = {0, 0, 0, 1, 1, 0};
+const std::vector<int16_t> kNestedBDefLevels = {0, 1, 2, 3, 4, 6, 5, 6};
+const std::vector<int16_t> kNestedBRepLevels = {0, 0, 0, 1, 1, 0, 2, 2};
+
+TEST(TestLevelsToListOffsets, NullAndEmptyLists) {
+  // null, [], [null, {...}, {...}], [{...}]
+  const auto level_info = MakeLevelInfo(2, 1, 0, true);
+  CheckListOffsets(kNestedADefLevels, kNestedARepLevels, level_info, {0, 0, 0, 3, 4},
+                   {false, true, true, true});
+  // The elements of the nested list are skipped
+  CheckListOffsets(kNestedBDefLevels, kNestedBRepLevels, level_info, {0, 0, 0, 3, 4},
+                   {false, true, true, true});
+}
+
+TEST(TestLevelsToListOffsets, NestedLists) {
+  // One slot per element of the enclosing list: null (null struct), null, [],
+  // [3, null, 4]
+  CheckListOffsets(kNestedBDefLevels, kNestedBRepLevels, MakeLevelInfo(5, 2, 2, true),
+                   {0, 0, 0, 0, 3}, {false, false, true, true});
+}
+
+TEST(TestLevelsToListOffsets, RequiredList) {
+  // required list<required int32>: [], [1, 2], []
+  CheckListOffsets({0, 1, 1, 0}, {0, 0, 1, 0}, MakeLevelInfo(1, 1, 0, false),
+                   {0, 0, 2, 2}, {true, true, true});
+}
+
+TEST(TestLevelsToStructBitmap, StructInList) {
+  // Null and empty lists have no slot in the struct: null, {...}, {...}, {...}
+  const auto level_info = MakeLevelInfo(3, 1, 2, true);
+  CheckStructBitmap(kNestedADefLevels, kNestedARepLevels, level_info,
+                    {false, true, true, true});
+  // The elements of the nested list are skipped
+  CheckStructBitmap(kNestedBDefLevels, kNestedBRepLevels, level_info,
+                    {false, true, true, true});
+}
+
+TEST(TestLevelsToStructBitmap, TopLevelStruct) {
+  // optional struct<x: optional int32>: null, {x: 1}, {x: null}, null, {x: 2}
+  const std::vector<int16_t> def_levels = {0, 2, 1, 0, 2};
+  CheckStructBitmap(def_levels, {}, MakeLevelInfo(1, 0, 0, true),
+                    {false, true, true, false, true});
+  // required struct<x: optional int32>
+  CheckStructBitmap({1, 0, 1}, {}, MakeLevelInfo(0, 0, 0, false), {true, true, true});
+}
+
 TEST(TestImpalaConversion, ArrowTimestampToImpalaTimestamp) {
   // June 20, 2017 16:32:56 and 123456789 nanoseconds
   int64_t nanoseconds = INT64_C(1497976376123456789);
@@ -2861,6 +3089,111 @@ INSTANTIATE_TEST_CASE_P(
     ReadDictionary, TestArrowReadDictionary,
     ::testing::ValuesIn(TestArrowReadDictionary::null_probabilities()));
 
+TEST(TestArrowReadDictionaryPhysicalTypes, Int64SharedDictionary) {
+  // Each row group has the same values in the same order, so every column chunk
+  // is written with an identical dictionary page
+  constexpr int kNumRowGroups = 4;
+  auto row_group_values =
+      ::arrow::ArrayFromJSON(::arrow::int64(), "[3, 1, null, 3, 7, 1, 7, 3]");
+  std::shared_ptr<Array> dense_values;
+  ASSERT_OK(::arrow::Concatenate(::arrow::ArrayVector(kNumRowGroups, row_group_values),
+                                 default_memory_pool(), &dense_values));
+
+  ::arrow::Dictionary32Builder<::arrow::Int64Type> dict_builder;
+  ASSERT_OK(dict_builder.AppendArray(*dense_values));
+  std::shared_ptr<Array> dict_values;
+  ASSERT_OK(dict_builder.Finish(&dict_values));
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+
+  std::shared_ptr<Table> actual;
+  DoRoundtrip(MakeSimpleTable(dense_values, /*nullable=*/true),
+              row_group_values->length(), &actual, default_writer_properties(),
+              default_arrow_writer_properties(), properties);
+  ::arrow::AssertTablesEqual(*MakeSimpleTable(dict_values, /*nullable=*/true), *actual,
+                             /*same_chunk_layout=*/false);
+
+  // The dictionary is reused across row groups rather than starting new chunks
+  ASSERT_EQ(1, actual->column(0)->num_chunks());
+}
+
+TEST(TestArrowReadDictionaryPhysicalTypes, ChangingDictionaries) {
+  auto CheckType = [](const std::shared_ptr<DataType>& type, const std::string& json) {
+    auto values = ::arrow::ArrayFromJSON(type, json);
+    const int64_t row_group_size = values->length() / 2;
+
+    std::vector<std::shared_ptr<Array>> chunks(2);
+    for (int64_t i = 0; i < 2; ++i) {
+      std::shared_ptr<Array> slice = values->Slice(i * row_group_size, row_group_size);
+      FunctionContext ctx(default_memory_pool());
+      Datum out;
+      ASSERT_OK(DictionaryEncode(&ctx, Datum(slice), &out));
+      chunks[i] = out.make_array();
+    }
+
+    ArrowReaderProperties properties = default_arrow_reader_properties();
+    properties.set_read_dictionary(0, true);
+
+    std::shared_ptr<Table> actual;
+    DoRoundtrip(MakeSimpleTable(values, /*nullable=*/true), row_group_size, &actual,
+                default_writer_properties(), default_arrow_writer_properties(),
+                properties);
+
+    auto expected =
+        MakeSimpleTable(std::make_shared<ChunkedArray>(chunks), /*nullable=*/true);
+    ::arrow::AssertTablesEqual(*expected, *actual, /*same_chunk_layout=*/false);
+  };
+
+  CheckType(::arrow::int32(), "[1, 2, null, 1, 4, 2, 4, 3]");
+  CheckType(::arrow::float64(), "[1.5, null, 1.5, 2.5, 0.5, 0.5, null, 3.5]");
+  CheckType(::arrow::fixed_size_binary(3),
+            R"(["aaa", "bbb", "aaa", null, "ccc", "aaa", "ddd", "ccc"])");
+}
+
+TEST(TestArrowReadDictionaryPhysicalTypes, ListOfChangingDictionaries) {
+  constexpr int64_t kRowGroupSize = 4;
+  auto values = ::arrow::ArrayFromJSON(
+      ::arrow::list(::arrow::int32()),
+      "[[1, 2], null, [], [1, null], [4, 4], [3], null, [5]]");
+
+  ArrowReaderProperties properties = default_arrow_reader_properties();
+  properties.set_read_dictionary(0, true);
+
+  std::shared_ptr<Table> actual;
+  DoRoundtrip(MakeSimpleTable(values, /*nullable=*/true), kRowGroupSize, &actual,
+              default_writer_properties(), default_arrow_writer_properties(),
+              properties);
+
+  // The dictionary of the second row group starts a new chunk of lists
+  const auto& column = *actual->column(0);
+  ASSERT_EQ(2, column.num_chunks());
+  for (int i = 0; i < column.num_chunks(); ++i) {
+    const auto& list = static_cast<const ListArray&>(*column.chunk(i));
+    ASSERT_OK(list.ValidateFull());
+    auto expected = std::static_pointer_cast<ListArray>(
+        values->Slice(i * kRowGroupSize, kRowGroupSize));
+    ASSERT_EQ(expected->length(), list.length());
+    for (int64_t j = 0; j < list.length(); ++j) {
+      ASSERT_EQ(expected->IsNull(j), list.IsNull(j));
+      ASSERT_EQ(expected->value_length(j), list.value_length(j));
+    }
+
+    const auto& dict_values =
+        static_cast<const ::arrow::DictionaryArray&>(*list.values());
+    FunctionContext ctx(default_memory_pool());
+    std::shared_ptr<Array> decoded;
+    ASSERT_OK(::arrow::compute::Take(&ctx, *dict_values.dictionary(),
+                                     *dict_values.indices(),
+                                     ::arrow::compute::TakeOptions(), &decoded));
+    const int32_t values_begin = expected->value_offset(0);
+    ::arrow::AssertArraysEqual(
+        *expected->values()->Slice(values_begin,
+                                   expected->value_offset(kRowGroupSize) - values_begin),
+        *decoded);
+  }
+}
+
 TEST(TestArrowWriteDictionaries, ChangingDictionaries) {
   constexpr int num_unique = 50;
   constexpr int repeat = 10000;
@@ -24,6 +24,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/record_batch.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -40,6 +41,7 @@
 
 using arrow::Array;
 using arrow::BooleanArray;
+using arrow::Buffer;
 using arrow::ChunkedArray;
 using arrow::DataType;
 using arrow::Field;
@@ -390,13 +392,14 @@ class LeafReader : public ColumnReaderImpl {
   }
 
   Status GetDefLevels(const int16_t** data, int64_t* length) override {
-    *data = record_reader_->def_levels();
+    // Required, non-nested columns have no definition levels
+    *data = descr_->max_definition_level() > 0 ? record_reader_->def_levels() : nullptr;
     *length = record_reader_->levels_position();
     return Status::OK();
   }
 
   Status GetRepLevels(const int16_t** data, int64_t* length) override {
-    *data = record_reader_->rep_levels();
+    *data = descr_->max_repetition_level() > 0 ? record_reader_->rep_levels() : nullptr;
     *length = record_reader_->levels_position();
     return Status::OK();
   }
@@ -442,15 +445,174 @@ class LeafReader : public ColumnReaderImpl {
   std::shared_ptr<RecordReader> record_reader_;
 };
 
-class NestedListReader : public ColumnReaderImpl {
+namespace {
+
+Status GetOnlyChunk(MemoryPool* pool, const ChunkedArray& array,
+                    std::shared_ptr<Array>* out) {
+  if (array.num_chunks() == 0) {
+    return ::arrow::MakeArrayOfNull(pool, array.type(), 0, out);
+  }
+  DCHECK_EQ(array.num_chunks(), 1);
+  *out = array.chunk(0);
+  return Status::OK();
+}
+
+// Copy the bits [offset, offset + length) of a levels-derived bitmap, which
+// may be null if there are no nulls at all
+Status SliceValidity(MemoryPool* pool, const std::shared_ptr<Buffer>& valid_bits,
+                     int64_t offset, int64_t length, std::shared_ptr<Buffer>* out,
+                     int64_t* null_count) {
+  if (valid_bits == nullptr) {
+    *out = nullptr;
+    *null_count = 0;
+    return Status::OK();
+  }
+  ARROW_ASSIGN_OR_RAISE(*out, ::arrow::internal::CopyBitmap(pool, valid_bits->data(),
+                                                            offset, length));
+  *null_count = length - ::arrow::internal::CountSetBits((*out)->data(), 0, length);
+  return Status::OK();
+}
+
+// Assemble the list arrays of a batch over list values which may have been
+// read in several chunks. A list never straddles two output chunks: the value
+// chunks spanned by a single list are concatenated.
+Status AssembleListChunks(const std::shared_ptr<DataType>& type, int64_t length,
+                          const std::shared_ptr<Buffer>& offsets,
+                          const std::shared_ptr<Buffer>& valid_bits, int64_t null_count,
+                          const ChunkedArray& values, MemoryPool* pool,
+                          std::shared_ptr<ChunkedArray>* out) {
+  if (values.num_chunks() <= 1) {
+    std::shared_ptr<Array> list_values;
+    RETURN_NOT_OK(GetOnlyChunk(pool, values, &list_values));
+    *out = std::make_shared<ChunkedArray>(std::make_shared<ListArray>(
+        type, length, offsets, list_values, valid_bits, null_count));
+    return Status::OK();
+  }
+
+  const auto offsets_data = reinterpret_cast<const int32_t*>(offsets->data());
+  const int num_value_chunks = values.num_chunks();
+  std::vector<int64_t> chunk_starts = {0};
+  for (const auto& chunk : values.chunks()) {
+    chunk_starts.push_back(chunk_starts.back() + chunk->length());
+  }
+
+  ::arrow::ArrayVector chunks;
+  int64_t list_begin = 0;
+  int chunk_begin = 0;
+  int chunk_end = 0;
+  for (int64_t i = 1; i <= length; ++i) {
+    while (chunk_end < num_value_chunks &&
+           chunk_starts[chunk_end + 1] <= offsets_data[i]) {
+      ++chunk_end;
+    }
+    // Cut the batch after list i - 1 if its values end on a chunk boundary
+    if (i < length &&
+        !(chunk_end > chunk_begin && chunk_starts[chunk_end] == offsets_data[i])) {
+      continue;
+    }
+
+    std::shared_ptr<Array> chunk_values;
+    if (chunk_end == chunk_begin) {
+      // Only empty or null lists remain after the last value chunk
+      chunk_values = values.chunk(chunk_end - 1)->Slice(0, 0);
+    } else if (chunk_end == chunk_begin + 1) {
+      chunk_values = values.chunk(chunk_begin);
+    } else {
+      ::arrow::ArrayVector spanned(values.chunks().begin() + chunk_begin,
+                                   values.chunks().begin() + chunk_end);
+      RETURN_NOT_OK(::arrow::Concatenate(spanned, pool, &chunk_values));
+    }
+
+    const int64_t chunk_length = i - list_begin;
+    std::shared_ptr<Buffer> chunk_offsets;
+    RETURN_NOT_OK(::arrow::AllocateBuffer(pool, (chunk_length + 1) * sizeof(int32_t),
+                                          &chunk_offsets));
+    auto chunk_offsets_data = reinterpret_cast<int32_t*>(chunk_offsets->mutable_data());
+    const int32_t base = offsets_data[list_begin];
+    for (int64_t j = 0; j <= chunk_length; ++j) {
+      chunk_offsets_data[j] = offsets_data[list_begin + j] - base;
+    }
+
+    std::shared_ptr<Buffer> chunk_valid_bits;
+    int64_t chunk_null_count;
+    RETURN_NOT_OK(SliceValidity(pool, valid_bits, list_begin, chunk_length,
+                                &chunk_valid_bits, &chunk_null_count));
+    chunks.push_back(std::make_shared<ListArray>(type, chunk_length, chunk_offsets,
+                                                 chunk_values, chunk_valid_bits,
+                                                 chunk_null_count));
+    list_begin = i;
+    chunk_begin = chunk_end;
+  }
+  *out = std::make_shared<ChunkedArray>(chunks, type);
+  return Status::OK();
+}
+
+// Assemble the struct arrays of a batch over children which may have been
+// read in differently chunked arrays, cutting the batch at every chunk
+// boundary of any child
+Status AssembleStructChunks(const std::shared_ptr<DataType>& type, int64_t length,
+                            const std::shared_ptr<Buffer>& valid_bits,
+                            int64_t null_count,
+                            const std::vector<std::shared_ptr<ChunkedArray>>& children,
+                            MemoryPool* pool, std::shared_ptr<ChunkedArray>* out) {
+  std::vector<int64_t> boundaries = {0, length};
+  for (const auto& child : children) {
+    int64_t position = 0;
+    for (const auto& chunk : child->chunks()) {
+      position += chunk->length();
+      boundaries.push_back(position);
+    }
+  }
+  std::sort(boundaries.begin(), boundaries.end());
+  boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+
+  if (boundaries.size() <= 2) {
+    ::arrow::ArrayVector children_arrays(children.size());
+    for (size_t c = 0; c < children.size(); ++c) {
+      RETURN_NOT_OK(GetOnlyChunk(pool, *children[c], &children_arrays[c]));
+    }
+    *out = std::make_shared<ChunkedArray>(std::make_shared<StructArray>(
+        type, length, children_arrays, valid_bits, null_count));
+    return Status::OK();
+  }
+
+  // Position of each child in its chunks
+  std::vector<int> child_chunk(children.size(), 0);
+  std::vector<int64_t> child_chunk_start(children.size(), 0);
+  ::arrow::ArrayVector chunks;
+  for (size_t b = 1; b < boundaries.size(); ++b) {
+    const int64_t begin = boundaries[b - 1];
+    const int64_t chunk_length = boundaries[b] - begin;
+    ::arrow::ArrayVector children_arrays;
+    for (size_t c = 0; c < children.size(); ++c) {
+      const ChunkedArray& child = *children[c];
+      while (child_chunk_start[c] + child.chunk(child_chunk[c])->length() <= begin) {
+        child_chunk_start[c] += child.chunk(child_chunk[c])->length();
+        ++child_chunk[c];
+      }
+      children_arrays.push_back(
+          child.chunk(child_chunk[c])->Slice(begin - child_chunk_start[c], chunk_length));
+    }
+    std::shared_ptr<Buffer> chunk_valid_bits;
+    int64_t chunk_null_count;
+    RETURN_NOT_OK(SliceValidity(pool, valid_bits, begin, chunk_length, &chunk_valid_bits,
+                                &chunk_null_count));
+    chunks.push_back(std::make_shared<StructArray>(type, chunk_length, children_arrays,
+                                                   chunk_valid_bits, chunk_null_count));
+  }
+  *out = std::make_shared<ChunkedArray>(chunks, type);
+  return Status::OK();
+}
+
+}  // namespace
+
+class PARQUET_NO_EXPORT ListReader : public ColumnReaderImpl {
  public:
-  NestedListReader(std::shared_ptr<ReaderContext> ctx, std::shared_ptr<Field> field,
-                   int16_t max_definition_level, int16_t max_repetition_level,
-                   std::unique_ptr<ColumnReaderImpl> item_reader)
+  ListReader(std::shared_ptr<ReaderContext> ctx, std::shared_ptr<Field> field,
+             const LevelInfo& level_info, std::unique_ptr<ColumnReaderImpl> item_reader)
       : ctx_(std::move(ctx)),
         field_(std::move(field)),
-        max_definition_level_(max_definition_level),
-        max_repetition_level_(max_repetition_level),
+        level_info_(level_info),
         item_reader_(std::move(item_reader)) {}
 
   Status GetDefLevels(const int16_t** data, int64_t* length) override {
@@ -462,30 +624,31 @@ class NestedListReader : public ColumnReaderImpl {
   }
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override {
-    if (item_reader_->type() == ColumnReaderImpl::STRUCT) {
-      return Status::Invalid("Mix of struct and list types not yet supported");
-    }
-
-    RETURN_NOT_OK(item_reader_->NextBatch(records_to_read, out));
-
-    // ARROW-3762(wesm): If item reader yields a chunked array, we reject as
-    // this is not yet implemented
-    if ((*out)->num_chunks() > 1) {
-      return Status::NotImplemented(
-          "Nested data conversions not implemented for chunked array outputs");
-    }
+    std::shared_ptr<ChunkedArray> values;
+    RETURN_NOT_OK(item_reader_->NextBatch(records_to_read, &values));
 
     const int16_t* def_levels;
     const int16_t* rep_levels;
     int64_t num_levels;
     RETURN_NOT_OK(item_reader_->GetDefLevels(&def_levels, &num_levels));
     RETURN_NOT_OK(item_reader_->GetRepLevels(&rep_levels, &num_levels));
-    std::shared_ptr<Array> result;
-    RETURN_NOT_OK(ReconstructNestedList((*out)->chunk(0), field_, max_definition_level_,
-                                        max_repetition_level_, def_levels, rep_levels,
-                                        num_levels, ctx_->pool, &result));
-    *out = std::make_shared<ChunkedArray>(result);
-    return Status::OK();
+
+    int64_t length;
+    int64_t null_count;
+    std::shared_ptr<Buffer> offsets;
+    std::shared_ptr<Buffer> valid_bits;
+    RETURN_NOT_OK(LevelsToListOffsets(def_levels, rep_levels, num_levels, level_info_,
+                                      ctx_->pool, &length, &offsets, &valid_bits,
+                                      &null_count));
+    const int32_t num_elements =
+        reinterpret_cast<const int32_t*>(offsets->data())[length];
+    if (num_elements != values->length()) {
+      return Status::IOError("Parquet list decoding error. Expected ", num_elements,
+                             " list elements in field \"", field_->ToString(),
+                             "\" but read ", values->length());
+    }
+    return AssembleListChunks(field_->type(), length, offsets, valid_bits, null_count,
+                              *values, ctx_->pool, out);
   }
 
   const std::shared_ptr<Field> field() override { return field_; }
@@ -497,249 +660,149 @@ class NestedListReader : public ColumnReaderImpl {
  private:
   std::shared_ptr<ReaderContext> ctx_;
   std::shared_ptr<Field> field_;
-  int16_t max_definition_level_;
-  int16_t max_repetition_level_;
+  LevelInfo level_info_;
   std::unique_ptr<ColumnReaderImpl> item_reader_;
 };
 
 class PARQUET_NO_EXPORT StructReader : public ColumnReaderImpl {
  public:
   explicit StructReader(std::shared_ptr<ReaderContext> ctx,
-                        const SchemaField& schema_field,
                         std::shared_ptr<Field> filtered_field,
+                        const LevelInfo& level_info,
                         std::vector<std::unique_ptr<ColumnReaderImpl>>&& children)
       : ctx_(std::move(ctx)),
-        schema_field_(schema_field),
         filtered_field_(std::move(filtered_field)),
-        struct_def_level_(schema_field.max_definition_level),
+        level_info_(level_info),
         children_(std::move(children)) {}
 
   Status NextBatch(int64_t records_to_read, std::shared_ptr<ChunkedArray>* out) override;
-  Status GetDefLevels(const int16_t** data, int64_t* length) override;
-  Status GetRepLevels(const int16_t** data, int64_t* length) override;
+
+  // All leaves of a struct carry the struct's levels, so those of the first
+  // child are used
+  Status GetDefLevels(const int16_t** data, int64_t* length) override {
+    return children_[0]->GetDefLevels(data, length);
+  }
+
+  Status GetRepLevels(const int16_t** data, int64_t* length) override {
+    return children_[0]->GetRepLevels(data, length);
+  }
+
   const std::shared_ptr<Field> field() override { return filtered_field_; }
   const ColumnDescriptor* descr() const override { return nullptr; }
   ReaderType type() const override { return STRUCT; }
 
  private:
   std::shared_ptr<ReaderContext> ctx_;
-  SchemaField schema_field_;
   std::shared_ptr<Field> filtered_field_;
-  int16_t struct_def_level_;
+  LevelInfo level_info_;
   std::vector<std::unique_ptr<ColumnReaderImpl>> children_;
-  std::shared_ptr<ResizableBuffer> def_levels_buffer_;
-  Status DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap, int64_t* null_count);
 };
 
-Status StructReader::DefLevelsToNullArray(std::shared_ptr<Buffer>* null_bitmap_out,
-                                          int64_t* null_count_out) {
-  std::shared_ptr<Buffer> null_bitmap;
-  auto null_count = 0;
-  const int16_t* def_levels_data;
-  int64_t def_levels_length;
-  RETURN_NOT_OK(GetDefLevels(&def_levels_data, &def_levels_length));
-  RETURN_NOT_OK(AllocateEmptyBitmap(ctx_->pool, def_levels_length, &null_bitmap));
-  uint8_t* null_bitmap_ptr = null_bitmap->mutable_data();
-  for (int64_t i = 0; i < def_levels_length; i++) {
-    if (def_levels_data[i] < struct_def_level_) {
-      // Mark null
-      null_count += 1;
-    } else {
-      DCHECK_EQ(def_levels_data[i], struct_def_level_);
-      ::arrow::BitUtil::SetBit(null_bitmap_ptr, i);
-    }
-  }
-
-  *null_count_out = null_count;
-  *null_bitmap_out = (null_count == 0) ? nullptr : null_bitmap;
-  return Status::OK();
-}
-
-// TODO(itaiin): Consider caching the results of this calculation -
-//   note that this is only used once for each read for now
-Status StructReader::GetDefLevels(const int16_t** data, int64_t* length) {
-  *data = nullptr;
-  if (children_.size() == 0) {
-    // Empty struct
-    *length = 0;
-    return Status::OK();
-  }
-
-  // We have at least one child
-  const int16_t* child_def_levels;
-  int64_t child_length = 0;
-  bool found_nullable_child = false;
-  int16_t* result_levels = nullptr;
-
-  int child_index = 0;
-  while (child_index < static_cast<int>(children_.size())) {
-    if (!children_[child_index]->field()->nullable()) {
-      ++child_index;
-      continue;
-    }
-    RETURN_NOT_OK(children_[child_index]->GetDefLevels(&child_def_levels, &child_length));
-    auto size = child_length * sizeof(int16_t);
-    RETURN_NOT_OK(AllocateResizableBuffer(ctx_->pool, size, &def_levels_buffer_));
-    // Initialize with the minimal def level
-    std::memset(def_levels_buffer_->mutable_data(), -1, size);
-    result_levels = reinterpret_cast<int16_t*>(def_levels_buffer_->mutable_data());
-    found_nullable_child = true;
-    break;
-  }
-
-  if (!found_nullable_child) {
-    *data = nullptr;
-    *length = 0;
-    return Status::OK();
-  }
-
-  // Look at the rest of the children
-
-  // When a struct is defined, all of its children def levels are at least at
-  // nesting level, and def level equals nesting level.
-  // When a struct is not defined, all of its children def levels are less than
-  // the nesting level, and the def level equals max(children def levels)
-  // All other possibilities are malformed definition data.
-  for (; child_index < static_cast<int>(children_.size()); ++child_index) {
-    // Child is non-nullable, and therefore has no definition levels
-    if (!children_[child_index]->field()->nullable()) {
-      continue;
-    }
-
-    auto& child = children_[child_index];
-    int64_t current_child_length;
-    RETURN_NOT_OK(child->GetDefLevels(&child_def_levels, &current_child_length));
-
-    if (child_length != current_child_length) {
-      std::stringstream ss;
-      ss << "Parquet struct decoding error. Expected to decode " << child_length
-         << " definition levels"
-         << " from child field \"" << child->field()->ToString() << "\" in parent \""
-         << this->field()->ToString() << "\" but was only able to decode "
-         << current_child_length;
-      return Status::IOError(ss.str());
-    }
-
-    DCHECK_EQ(child_length, current_child_length);
-    for (int64_t i = 0; i < child_length; i++) {
-      // Check that value is either uninitialized, or current
-      // and previous children def levels agree on the struct level
-      DCHECK((result_levels[i] == -1) || ((result_levels[i] >= struct_def_level_) ==
-                                          (child_def_levels[i] >= struct_def_level_)));
-      result_levels[i] =
-          std::max(result_levels[i], std::min(child_def_levels[i], struct_def_level_));
-    }
-  }
-  *data = reinterpret_cast<const int16_t*>(def_levels_buffer_->data());
-  *length = static_cast<int64_t>(child_length);
-  return Status::OK();
-}
-
-Status StructReader::GetRepLevels(const int16_t** data, int64_t* length) {
-  return Status::NotImplemented("GetRepLevels is not implemented for struct");
-}
-
 Status StructReader::NextBatch(int64_t records_to_read,
                                std::shared_ptr<ChunkedArray>* out) {
-  std::vector<std::shared_ptr<Array>> children_arrays;
-  std::shared_ptr<Buffer> null_bitmap;
-  int64_t null_count;
-
-  // Gather children arrays and def levels
+  std::vector<std::shared_ptr<ChunkedArray>> children_arrays;
   for (auto& child : children_) {
-    if (child->type() == ColumnReaderImpl::LIST) {
-      return Status::Invalid("Mix of struct and list types not yet supported");
-    }
-
     std::shared_ptr<ChunkedArray> field;
     RETURN_NOT_OK(child->NextBatch(records_to_read, &field));
-
-    if (field->num_chunks() > 1) {
-      return Status::Invalid("Chunked field reads not yet supported with StructArray");
-    }
-    children_arrays.push_back(field->chunk(0));
+    children_arrays.push_back(std::move(field));
   }
 
-  RETURN_NOT_OK(DefLevelsToNullArray(&null_bitmap, &null_count));
+  const int16_t* def_levels;
+  const int16_t* rep_levels;
+  int64_t num_levels;
+  RETURN_NOT_OK(GetDefLevels(&def_levels, &num_levels));
+  RETURN_NOT_OK(GetRepLevels(&rep_levels, &num_levels));
 
-  int64_t struct_length = children_arrays[0]->length();
-  for (size_t i = 1; i < children_arrays.size(); ++i) {
+  int64_t struct_length;
+  int64_t null_count = 0;
+  std::shared_ptr<Buffer> null_bitmap;
+  if (def_levels == nullptr) {
+    // Required struct whose leaves are all required: no levels, no nulls
+    struct_length = children_arrays[0]->length();
+  } else {
+    RETURN_NOT_OK(LevelsToStructBitmap(def_levels, rep_levels, num_levels, level_info_,
+                                       ctx_->pool, &struct_length, &null_bitmap,
+                                       &null_count));
+  }
+
+  for (size_t i = 0; i < children_arrays.size(); ++i) {
     if (children_arrays[i]->length() != struct_length) {
       // TODO(wesm): This should really only occur if the Parquet file is
       // malformed. Should this be a DCHECK?
       return Status::Invalid("Struct children had different lengths");
     }
   }
-
-  auto result = std::make_shared<StructArray>(field()->type(), struct_length,
-                                              children_arrays, null_bitmap, null_count);
-  *out = std::make_shared<ChunkedArray>(result);
-  return Status::OK();
+  return AssembleStructChunks(field()->type(), struct_length, null_bitmap, null_count,
+                              children_arrays, ctx_->pool, out);
 }
 
 // ----------------------------------------------------------------------
 // File reader implementation
 
-Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>& ctx,
+namespace {
+
+Status GetReader(const SchemaField& field, int16_t repeated_ancestor_def_level,
+                 const std::shared_ptr<ReaderContext>& ctx,
                  std::unique_ptr<ColumnReaderImpl>* out) {
   auto type_id = field.field->type()->id();
+  LevelInfo level_info;
+  level_info.def_level = field.max_definition_level;
+  level_info.rep_level = field.max_repetition_level;
+  level_info.repeated_ancestor_def_level = repeated_ancestor_def_level;
+  level_info.nullable = field.field->nullable();
   if (field.children.size() == 0) {
+    if (!ctx->IncludesLeaf(field.column_index)) {
+      *out = nullptr;
+      return Status::OK();
+    }
     std::unique_ptr<FileColumnIterator> input(
         ctx->iterator_factory(field.column_index, ctx->reader));
     out->reset(new LeafReader(ctx, field.field, std::move(input)));
   } else if (type_id == ::arrow::Type::LIST) {
-    // We can only read lists-of-lists or structs at the moment
-    auto list_field = field.field;
-    auto child = &field.children[0];
-    while (child->field->type()->id() == ::arrow::Type::LIST) {
-      child = &child->children[0];
-    }
-    if (child->field->type()->id() == ::arrow::Type::STRUCT) {
-      return Status::NotImplemented(
-          "Reading lists of structs from Parquet files "
-          "not yet supported: ",
-          field.field->ToString());
-    }
-    if (!ctx->IncludesLeaf(child->column_index)) {
+    // The list elements have a slot wherever the list is non-empty
+    std::unique_ptr<ColumnReaderImpl> item_reader;
+    RETURN_NOT_OK(GetReader(field.children[0], field.max_definition_level, ctx,
+                            &item_reader));
+    if (!item_reader) {
+      // All leaves of the list elements were pruned
       *out = nullptr;
       return Status::OK();
     }
-    std::unique_ptr<ColumnReaderImpl> child_reader;
-    RETURN_NOT_OK(GetReader(*child, ctx, &child_reader));
-    // Use the max definition/repetition level of the leaf here
-    out->reset(new NestedListReader(ctx, list_field, child->max_definition_level,
-                                    child->max_repetition_level,
-                                    std::move(child_reader)));
+    auto list_field = field.field->WithType(::arrow::list(item_reader->field()));
+    out->reset(new ListReader(ctx, list_field, level_info, std::move(item_reader)));
   } else if (type_id == ::arrow::Type::STRUCT) {
     std::vector<std::shared_ptr<Field>> child_fields;
     std::vector<std::unique_ptr<ColumnReaderImpl>> child_readers;
     for (const auto& child : field.children) {
-      if (child.is_leaf() && !ctx->IncludesLeaf(child.column_index)) {
-        // Excluded leaf
-        continue;
-      }
       std::unique_ptr<ColumnReaderImpl> child_reader;
-      RETURN_NOT_OK(GetReader(child, ctx, &child_reader));
+      RETURN_NOT_OK(GetReader(child, repeated_ancestor_def_level, ctx, &child_reader));
       if (!child_reader) {
         // If all children were pruned, then we do not try to read this field
         continue;
       }
-      child_fields.push_back(child.field);
+      child_fields.push_back(child_reader->field());
       child_readers.emplace_back(std::move(child_reader));
     }
     if (child_fields.size() == 0) {
       *out = nullptr;
       return Status::OK();
     }
-    auto filtered_field = ::arrow::field(
-        field.field->name(), ::arrow::struct_(child_fields), field.field->nullable());
-    out->reset(new StructReader(ctx, field, filtered_field, std::move(child_readers)));
+    auto filtered_field = field.field->WithType(::arrow::struct_(child_fields));
+    out->reset(
+        new StructReader(ctx, filtered_field, level_info, std::move(child_readers)));
   } else {
     return Status::Invalid("Unsupported nested type: ", field.field->ToString());
   }
   return Status::OK();
 }
 
+}  // namespace
+
+Status GetReader(const SchemaField& field, const std::shared_ptr<ReaderContext>& ctx,
+                 std::unique_ptr<ColumnReaderImpl>* out) {
+  return GetReader(field, /*repeated_ancestor_def_level=*/0, ctx, out);
+}
+
 Status FileReaderImpl::GetRecordBatchReader(const std::vector<int>& row_group_indices,
                                             const std::vector<int>& column_indices,
                                             std::unique_ptr<RecordBatchReader>* out) {
@@ -55,6 +55,7 @@
 
 using arrow::Array;
 using arrow::BooleanArray;
+using arrow::Buffer;
 using arrow::ChunkedArray;
 using arrow::DataType;
 using arrow::Field;
@@ -334,8 +335,20 @@ struct SchemaTreeContext {
 };
 
 bool IsDictionaryReadSupported(const DataType& type) {
-  // Only supported currently for BYTE_ARRAY types
-  return type.id() == ::arrow::Type::BINARY || type.id() == ::arrow::Type::STRING;
+  // Supported for Arrow types whose storage is identical to the Parquet
+  // physical type, so that dictionary pages can be used without conversion
+  switch (type.id()) {
+    case ::arrow::Type::INT32:
+    case ::arrow::Type::INT64:
+    case ::arrow::Type::FLOAT:
+    case ::arrow::Type::DOUBLE:
+    case ::arrow::Type::BINARY:
+    case ::arrow::Type::STRING:
+    case ::arrow::Type::FIXED_SIZE_BINARY:
+      return true;
+    default:
+      return false;
+  }
 }
 
 Status GetTypeForNode(int column_index, const schema::PrimitiveNode& primitive_node,
@@ -1332,115 +1345,101 @@ Status TransferColumnData(internal::RecordReader* reader,
   return Status::OK();
 }
 
-Status ReconstructNestedList(const std::shared_ptr<Array>& arr,
-                             std::shared_ptr<Field> field, int16_t max_def_level,
-                             int16_t max_rep_level, const int16_t* def_levels,
-                             const int16_t* rep_levels, int64_t total_levels,
-                             ::arrow::MemoryPool* pool, std::shared_ptr<Array>* out) {
-  // Walk downwards to extract nullability
-  std::vector<std::string> item_names;
-  std::vector<bool> nullable;
-  std::vector<std::shared_ptr<::arrow::Int32Builder>> offset_builders;
-  std::vector<std::shared_ptr<::arrow::BooleanBuilder>> valid_bits_builders;
-  nullable.push_back(field->nullable());
-  while (field->type()->num_children() > 0) {
-    if (field->type()->num_children() > 1) {
-      return Status::NotImplemented("Fields with more than one child are not supported.");
-    } else {
-      if (field->type()->id() != ::arrow::Type::LIST) {
-        return Status::NotImplemented("Currently only nesting with Lists is supported.");
-      }
-      field = field->type()->child(0);
-    }
-    item_names.push_back(field->name());
-    offset_builders.emplace_back(
-        std::make_shared<::arrow::Int32Builder>(::arrow::int32(), pool));
-    valid_bits_builders.emplace_back(
-        std::make_shared<::arrow::BooleanBuilder>(::arrow::boolean(), pool));
-    nullable.push_back(field->nullable());
-  }
+namespace {
 
-  int64_t list_depth = offset_builders.size();
-  // This describes the minimal definition that describes a level that
-  // reflects a value in the primitive values array.
-  int16_t values_def_level = max_def_level;
-  if (nullable[nullable.size() - 1]) {
-    values_def_level--;
+Status FinishLevelsBitmap(int64_t length, int64_t null_count,
+                          std::shared_ptr<ResizableBuffer> bitmap,
+                          std::shared_ptr<Buffer>* valid_bits) {
+  if (null_count == 0) {
+    *valid_bits = nullptr;
+    return Status::OK();
   }
+  RETURN_NOT_OK(bitmap->Resize(::arrow::BitUtil::BytesForBits(length)));
+  *valid_bits = std::move(bitmap);
+  return Status::OK();
+}
 
-  // The definition levels that are needed so that a list is declared
-  // as empty and not null.
-  std::vector<int16_t> empty_def_level(list_depth);
-  int def_level = 0;
-  for (int i = 0; i < list_depth; i++) {
-    if (nullable[i]) {
-      def_level++;
+}  // namespace
+
+Status LevelsToStructBitmap(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_levels, const LevelInfo& level_info,
+                            MemoryPool* pool, int64_t* length,
+                            std::shared_ptr<Buffer>* valid_bits, int64_t* null_count) {
+  std::shared_ptr<ResizableBuffer> bitmap;
+  RETURN_NOT_OK(::arrow::AllocateResizableBuffer(
+      pool, ::arrow::BitUtil::BytesForBits(num_levels), &bitmap));
+  ::arrow::internal::FirstTimeBitmapWriter writer(bitmap->mutable_data(), 0, num_levels);
+  int64_t nulls = 0;
+  for (int64_t i = 0; i < num_levels; ++i) {
+    // Levels continuing a list nested inside the struct, or describing a
+    // null or empty ancestor list, have no slot in the struct
+    if ((rep_levels != nullptr && rep_levels[i] > level_info.rep_level) ||
+        def_levels[i] < level_info.repeated_ancestor_def_level) {
+      continue;
     }
-    empty_def_level[i] = static_cast<int16_t>(def_level);
-    def_level++;
+    if (!level_info.nullable || def_levels[i] >= level_info.def_level) {
+      writer.Set();
+    } else {
+      ++nulls;
+    }
+    writer.Next();
   }
+  writer.Finish();
+  *length = writer.position();
+  *null_count = nulls;
+  return FinishLevelsBitmap(*length, nulls, std::move(bitmap), valid_bits);
+}
 
-  int32_t values_offset = 0;
-  std::vector<int64_t> null_counts(list_depth, 0);
-  for (int64_t i = 0; i < total_levels; i++) {
-    int16_t rep_level = rep_levels[i];
-    if (rep_level < max_rep_level) {
-      for (int64_t j = rep_level; j < list_depth; j++) {
-        if (j == (list_depth - 1)) {
-          RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-        } else {
-          RETURN_NOT_OK(offset_builders[j]->Append(
-              static_cast<int32_t>(offset_builders[j + 1]->length())));
-        }
-
-        if (((empty_def_level[j] - 1) == def_levels[i]) && (nullable[j])) {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(false));
-          null_counts[j]++;
-          break;
-        } else {
-          RETURN_NOT_OK(valid_bits_builders[j]->Append(true));
-          if (empty_def_level[j] == def_levels[i]) {
-            break;
-          }
-        }
-      }
+Status LevelsToListOffsets(const int16_t* def_levels, const int16_t* rep_levels,
+                           int64_t num_levels, const LevelInfo& level_info,
+                           MemoryPool* pool, int64_t* length,
+                           std::shared_ptr<Buffer>* offsets,
+                           std::shared_ptr<Buffer>* valid_bits, int64_t* null_count) {
+  DCHECK_NE(rep_levels, nullptr);
+  std::shared_ptr<ResizableBuffer> offsets_buffer;
+  std::shared_ptr<ResizableBuffer> bitmap;
+  RETURN_NOT_OK(::arrow::AllocateResizableBuffer(pool, (num_levels + 1) * sizeof(int32_t),
+                                                &offsets_buffer));
+  RETURN_NOT_OK(::arrow::AllocateResizableBuffer(
+      pool, ::arrow::BitUtil::BytesForBits(num_levels), &bitmap));
+  auto offsets_data = reinterpret_cast<int32_t*>(offsets_buffer->mutable_data());
+  ::arrow::internal::FirstTimeBitmapWriter writer(bitmap->mutable_data(), 0, num_levels);
+
+  // An empty list is defined one level below the level of its elements
+  const int16_t empty_def_level = level_info.def_level - 1;
+  int32_t num_elements = 0;
+  int64_t nulls = 0;
+  for (int64_t i = 0; i < num_levels; ++i) {
+    const int16_t def_level = def_levels[i];
+    const int16_t rep_level = rep_levels[i];
+    if (rep_level > level_info.rep_level) {
+      // Continuation of a list nested in the elements
+      continue;
     }
-    if (def_levels[i] >= values_def_level) {
-      values_offset++;
+    if (rep_level < level_info.rep_level) {
+      // Start of a new list, unless an ancestor list is null or empty
+      if (def_level < level_info.repeated_ancestor_def_level) {
+        continue;
+      }
+      offsets_data[writer.position()] = num_elements;
+      if (!level_info.nullable || def_level >= empty_def_level) {
+        writer.Set();
+      } else {
+        ++nulls;
+      }
+      writer.Next();
     }
-  }
-  // Add the final offset to all lists
-  for (int64_t j = 0; j < list_depth; j++) {
-    if (j == (list_depth - 1)) {
-      RETURN_NOT_OK(offset_builders[j]->Append(values_offset));
-    } else {
-      RETURN_NOT_OK(offset_builders[j]->Append(
-          static_cast<int32_t>(offset_builders[j + 1]->length())));
+    if (def_level >= level_info.def_level) {
+      ++num_elements;
     }
   }
-
-  std::vector<std::shared_ptr<Buffer>> offsets;
-  std::vector<std::shared_ptr<Buffer>> valid_bits;
-  std::vector<int64_t> list_lengths;
-  for (int64_t j = 0; j < list_depth; j++) {
-    list_lengths.push_back(offset_builders[j]->length() - 1);
-    std::shared_ptr<Array> array;
-    RETURN_NOT_OK(offset_builders[j]->Finish(&array));
-    offsets.emplace_back(std::static_pointer_cast<Int32Array>(array)->values());
-    RETURN_NOT_OK(valid_bits_builders[j]->Finish(&array));
-    valid_bits.emplace_back(std::static_pointer_cast<BooleanArray>(array)->values());
-  }
-
-  *out = arr;
-
-  // TODO(wesm): Use passed-in field
-  for (int64_t j = list_depth - 1; j >= 0; j--) {
-    auto list_type =
-        ::arrow::list(::arrow::field(item_names[j], (*out)->type(), nullable[j + 1]));
-    *out = std::make_shared<::arrow::ListArray>(list_type, list_lengths[j], offsets[j],
-                                                *out, valid_bits[j], null_counts[j]);
-  }
-  return Status::OK();
+  writer.Finish();
+  *length = writer.position();
+  offsets_data[*length] = num_elements;
+  *null_count = nulls;
+  RETURN_NOT_OK(offsets_buffer->Resize((*length + 1) * sizeof(int32_t)));
+  *offsets = std::move(offsets_buffer);
+  return FinishLevelsBitmap(*length, nulls, std::move(bitmap), valid_bits);
 }
 
 }  // namespace arrow
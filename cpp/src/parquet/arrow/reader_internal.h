@@ -37,6 +37,7 @@
 namespace arrow {
 
 class Array;
+class Buffer;
 class ChunkedArray;
 class DataType;
 class Field;
@@ -104,12 +105,43 @@ Status TransferColumnData(::parquet::internal::RecordReader* reader,
                           const ColumnDescriptor* descr, ::arrow::MemoryPool* pool,
                           std::shared_ptr<::arrow::ChunkedArray>* out);
 
-Status ReconstructNestedList(const std::shared_ptr<::arrow::Array>& arr,
-                             std::shared_ptr<::arrow::Field> field, int16_t max_def_level,
-                             int16_t max_rep_level, const int16_t* def_levels,
-                             const int16_t* rep_levels, int64_t total_levels,
-                             ::arrow::MemoryPool* pool,
-                             std::shared_ptr<::arrow::Array>* out);
+/// \brief Levels describing one node of a nested column, used to reassemble
+/// the node from the definition and repetition levels of one of its leaves
+struct LevelInfo {
+  /// \brief Definition level at which the node is defined. For lists this is
+  /// the level at which the list has at least one element
+  int16_t def_level = 0;
+  /// \brief Repetition level of the node. For lists this is the level of
+  /// the repeated node holding the list elements
+  int16_t rep_level = 0;
+  /// \brief Definition level of the nearest enclosing list, or 0. Lower
+  /// levels belong to a null or empty ancestor and have no slot in the node
+  int16_t repeated_ancestor_def_level = 0;
+  /// \brief Whether the node may be null
+  bool nullable = false;
+};
+
+/// \brief Compute the validity bitmap of a struct in a single pass over the
+/// levels of one of its leaves
+///
+/// rep_levels may be null if the struct is not nested in a list. The bitmap
+/// is null if there are no nulls.
+Status LevelsToStructBitmap(const int16_t* def_levels, const int16_t* rep_levels,
+                            int64_t num_levels, const LevelInfo& level_info,
+                            ::arrow::MemoryPool* pool, int64_t* length,
+                            std::shared_ptr<::arrow::Buffer>* valid_bits,
+                            int64_t* null_count);
+
+/// \brief Compute the int32 offsets and validity bitmap of a list in a single
+/// pass over the levels of one of its leaves
+///
+/// The bitmap is null if there are no nulls.
+Status LevelsToListOffsets(const int16_t* def_levels, const int16_t* rep_levels,
+                           int64_t num_levels, const LevelInfo& level_info,
+                           ::arrow::MemoryPool* pool, int64_t* length,
+                           std::shared_ptr<::arrow::Buffer>* offsets,
+                           std::shared_ptr<::arrow::Buffer>* valid_bits,
+                           int64_t* null_count);
 
 struct ReaderContext {
   ParquetFileReader* reader;
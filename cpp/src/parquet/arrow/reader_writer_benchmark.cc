@@ -28,6 +28,7 @@
 #include "parquet/platform.h"
 
 #include "arrow/api.h"
+#include "arrow/util/bit_util.h"
 
 using arrow::BooleanBuilder;
 using arrow::NumericBuilder;
@@ -267,6 +268,84 @@ static void BM_ReadMultipleRowGroups(::benchmark::State& state) {
 
 BENCHMARK(BM_ReadMultipleRowGroups);
 
+// Wrap values in `depth` levels of lists of four elements, where every eighth
+// list is null
+static std::shared_ptr<::arrow::Array> MakeNestedLists(
+    std::shared_ptr<::arrow::Array> values, int depth) {
+  for (int d = 0; d < depth; ++d) {
+    const int64_t num_lists = values->length() / 4;
+    ::arrow::Int32Builder offsets_builder;
+    for (int64_t i = 0; i <= num_lists; ++i) {
+      if (i < num_lists && i % 8 == 7) {
+        EXIT_NOT_OK(offsets_builder.AppendNull());
+      } else {
+        EXIT_NOT_OK(offsets_builder.Append(static_cast<int32_t>(i * 4)));
+      }
+    }
+    std::shared_ptr<::arrow::Array> offsets;
+    EXIT_NOT_OK(offsets_builder.Finish(&offsets));
+    std::shared_ptr<::arrow::Array> lists;
+    EXIT_NOT_OK(::arrow::ListArray::FromArrays(*offsets, *values,
+                                               ::arrow::default_memory_pool(), &lists));
+    values = lists;
+  }
+  return values;
+}
+
+// Write a single nested column of BENCHMARK_SIZE leaf values, and read it
+// back in every iteration
+static void BenchmarkReadNestedColumn(::benchmark::State& state,
+                                      const std::shared_ptr<::arrow::Array>& array) {
+  auto table = ::arrow::Table::Make(
+      ::arrow::schema({::arrow::field("column", array->type(), true)}), {array});
+  auto output = CreateOutputStream();
+  EXIT_NOT_OK(WriteTable(*table, ::arrow::default_memory_pool(), output, BENCHMARK_SIZE));
+  PARQUET_ASSIGN_OR_THROW(auto buffer, output->Finish());
+
+  while (state.KeepRunning()) {
+    auto reader =
+        ParquetFileReader::Open(std::make_shared<::arrow::io::BufferReader>(buffer));
+    std::unique_ptr<FileReader> arrow_reader;
+    EXIT_NOT_OK(FileReader::Make(::arrow::default_memory_pool(), std::move(reader),
+                                 &arrow_reader));
+    std::shared_ptr<::arrow::Table> table;
+    EXIT_NOT_OK(arrow_reader->ReadTable(&table));
+  }
+  SetBytesProcessed<true, Int64Type>(state);
+}
+
+static void BM_ReadNestedListColumn(::benchmark::State& state) {
+  const int depth = static_cast<int>(state.range(0));
+  std::vector<int64_t> values(BENCHMARK_SIZE, 128);
+  std::shared_ptr<::arrow::Table> leaf_table = TableFromVector<Int64Type>(values, true);
+  BenchmarkReadNestedColumn(state,
+                            MakeNestedLists(leaf_table->column(0)->chunk(0), depth));
+}
+
+BENCHMARK(BM_ReadNestedListColumn)->Arg(1)->Arg(2)->Arg(3);
+
+// Lists of structs with two int64 fields, where every sixteenth struct is null
+static void BM_ReadListOfStructColumn(::benchmark::State& state) {
+  const int64_t length = BENCHMARK_SIZE / 2;
+  std::vector<int64_t> values(length, 128);
+  std::shared_ptr<::arrow::Table> leaf_table = TableFromVector<Int64Type>(values, true);
+  auto leaf = leaf_table->column(0)->chunk(0);
+
+  std::shared_ptr<::arrow::Buffer> null_bitmap;
+  EXIT_NOT_OK(::arrow::AllocateEmptyBitmap(length, &null_bitmap));
+  for (int64_t i = 0; i < length; ++i) {
+    if (i % 16 != 15) {
+      ::arrow::BitUtil::SetBit(null_bitmap->mutable_data(), i);
+    }
+  }
+  std::vector<std::string> field_names = {"a", "b"};
+  PARQUET_ASSIGN_OR_THROW(
+      auto structs, ::arrow::StructArray::Make({leaf, leaf}, field_names, null_bitmap));
+  BenchmarkReadNestedColumn(state, MakeNestedLists(structs, 1));
+}
+
+BENCHMARK(BM_ReadListOfStructColumn);
+
 }  // namespace benchmark
 
 }  // namespace parquet
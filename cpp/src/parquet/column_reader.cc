@@ -29,6 +29,7 @@
 #include <vector>
 
 #include "arrow/array.h"
+#include "arrow/array/concatenate.h"
 #include "arrow/builder.h"
 #include "arrow/table.h"
 #include "arrow/type.h"
@@ -878,7 +879,8 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   using T = typename DType::c_type;
   using BASE = ColumnReaderImplBase<DType>;
   TypedRecordReader(const ColumnDescriptor* descr, MemoryPool* pool) : BASE(descr, pool) {
-    nullable_values_ = internal::HasSpacedValues(descr);
+    repeated_ancestor_def_level_ = internal::RepeatedAncestorDefLevel(descr);
+    nullable_values_ = repeated_ancestor_def_level_ < descr->max_definition_level();
     at_record_start_ = true;
     records_read_ = 0;
     values_written_ = 0;
@@ -1176,10 +1178,10 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
     int64_t null_count = 0;
     if (nullable_values_) {
       int64_t values_with_nulls = 0;
-      internal::DefinitionLevelsToBitmap(
+      internal::DefinitionLevelsToSlotBitmap(
           def_levels() + start_levels_position, levels_position_ - start_levels_position,
-          this->max_def_level_, this->max_rep_level_, &values_with_nulls, &null_count,
-          valid_bits_->mutable_data(), values_written_);
+          this->max_def_level_, repeated_ancestor_def_level_, &values_with_nulls,
+          &null_count, valid_bits_->mutable_data(), values_written_);
       values_to_read = values_with_nulls - null_count;
       ReadValuesSpaced(values_with_nulls, null_count);
     } else {
@@ -1243,6 +1245,9 @@ class TypedRecordReader : public ColumnReaderImplBase<DType>,
   T* ValuesHead() {
     return reinterpret_cast<T*>(values_->mutable_data()) + values_written_;
   }
+
+  // Definition level below which a level has no slot in the values
+  int16_t repeated_ancestor_def_level_;
 };
 
 class FLBARecordReader : public TypedRecordReader<FLBAType>,
@@ -1338,18 +1343,45 @@ class ByteArrayChunkedRecordReader : public TypedRecordReader<ByteArrayType>,
   typename EncodingTraits<ByteArrayType>::Accumulator accumulator_;
 };
 
-class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
-                                        virtual public DictionaryRecordReader {
+template <typename DType>
+struct DictionaryValueType {
+  static std::shared_ptr<::arrow::DataType> Make(const ColumnDescriptor*) {
+    using ArrowType = typename EncodingTraits<DType>::ArrowType;
+    return ::arrow::TypeTraits<ArrowType>::type_singleton();
+  }
+};
+
+template <>
+struct DictionaryValueType<FLBAType> {
+  static std::shared_ptr<::arrow::DataType> Make(const ColumnDescriptor* descr) {
+    return ::arrow::fixed_size_binary(descr->type_length());
+  }
+};
+
+/// \brief Reads dictionary-encoded pages directly into a
+/// ::arrow::Dictionary32Builder, appending only the decoded indices. Pages that
+/// fell back to another encoding are hashed into the same builder.
+///
+/// A new output chunk is started only when a dictionary page is encountered
+/// whose values do not extend the dictionary currently in use, so column chunks
+/// (row groups) written with identical dictionaries share a single chunk.
+template <typename DType>
+class DictionaryRecordReaderImpl : public TypedRecordReader<DType>,
+                                   virtual public DictionaryRecordReader {
  public:
-  ByteArrayDictionaryRecordReader(const ColumnDescriptor* descr,
-                                  ::arrow::MemoryPool* pool)
-      : TypedRecordReader<ByteArrayType>(descr, pool), builder_(pool) {
+  DictionaryRecordReaderImpl(const ColumnDescriptor* descr, ::arrow::MemoryPool* pool)
+      : TypedRecordReader<DType>(descr, pool),
+        builder_(DictionaryValueType<DType>::Make(descr), pool) {
     this->read_dictionary_ = true;
+    // Values are decoded straight into the builder
+    this->uses_values_ = false;
   }
 
   std::shared_ptr<::arrow::ChunkedArray> GetResult() override {
     FlushBuilder();
-    return std::make_shared<::arrow::ChunkedArray>(result_chunks_, builder_.type());
+    std::vector<std::shared_ptr<::arrow::Array>> result;
+    std::swap(result, result_chunks_);
+    return std::make_shared<::arrow::ChunkedArray>(std::move(result), builder_.type());
   }
 
   void FlushBuilder() {
@@ -1358,61 +1390,86 @@ class ByteArrayDictionaryRecordReader : public TypedRecordReader<ByteArrayType>,
       PARQUET_THROW_NOT_OK(builder_.Finish(&chunk));
       result_chunks_.emplace_back(std::move(chunk));
 
-      // Also clears the dictionary memo table
-      builder_.ResetFull();
+      // Retains the dictionary memo table, which may still be in use by
+      // subsequent reads from the current column chunk
+      builder_.Reset();
     }
   }
 
   void MaybeWriteNewDictionary() {
     if (this->new_dictionary_) {
-      /// If there is a new dictionary, we may need to flush the builder, then
-      /// insert the new dictionary values
-      FlushBuilder();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
+      std::shared_ptr<::arrow::Array> dictionary = decoder->GetDictionaryArray();
+      if (!ExtendsCurrentDictionary(*dictionary)) {
+        /// The indices that follow refer to a different dictionary, so we
+        /// must flush the builder and start over with an empty memo table
+        FlushBuilder();
+        builder_.ResetFull();
+      }
+      /// Values already in the memo table keep their index, so this is a
+      /// no-op when the dictionary is unchanged
       decoder->InsertDictionary(&builder_);
+
+      // The decoder reuses its dictionary storage, so retain a copy
+      PARQUET_THROW_NOT_OK(
+          ::arrow::Concatenate({dictionary}, this->pool_, &current_dictionary_));
       this->new_dictionary_ = false;
     }
   }
 
   void ReadValuesDense(int64_t values_to_read) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndices(static_cast<int>(values_to_read), &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrowNonNull(
           static_cast<int>(values_to_read), &builder_);
-
-      /// Flush values since they have been copied into the builder
-      ResetValues();
+      current_dictionary_.reset();
     }
+    /// Flush values since they have been copied into the builder
+    this->ResetValues();
     DCHECK_EQ(num_decoded, values_to_read);
   }
 
   void ReadValuesSpaced(int64_t values_to_read, int64_t null_count) override {
     int64_t num_decoded = 0;
-    if (current_encoding_ == Encoding::RLE_DICTIONARY) {
+    if (this->current_encoding_ == Encoding::RLE_DICTIONARY) {
       MaybeWriteNewDictionary();
-      auto decoder = dynamic_cast<BinaryDictDecoder*>(this->current_decoder_);
+      auto decoder = dynamic_cast<DictDecoder<DType>*>(this->current_decoder_);
       num_decoded = decoder->DecodeIndicesSpaced(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
     } else {
       num_decoded = this->current_decoder_->DecodeArrow(
           static_cast<int>(values_to_read), static_cast<int>(null_count),
-          valid_bits_->mutable_data(), values_written_, &builder_);
-
-      /// Flush values since they have been copied into the builder
-      ResetValues();
+          this->valid_bits_->mutable_data(), this->values_written_, &builder_);
+      current_dictionary_.reset();
     }
+    /// Flush values since they have been copied into the builder
+    this->ResetValues();
     DCHECK_EQ(num_decoded, values_to_read - null_count);
   }
 
  private:
-  using BinaryDictDecoder = DictDecoder<ByteArrayType>;
+  // True if `dictionary` starts with the values of the memo table, so that
+  // indices decoded against `dictionary` are valid against the memo table once
+  // the remaining values are inserted
+  bool ExtendsCurrentDictionary(const ::arrow::Array& dictionary) const {
+    if (current_dictionary_ == nullptr) {
+      return false;
+    }
+    const int64_t length = current_dictionary_->length();
+    return dictionary.length() >= length &&
+           dictionary.RangeEquals(0, length, 0, current_dictionary_);
+  }
 
-  ::arrow::BinaryDictionary32Builder builder_;
+  typename EncodingTraits<DType>::DictAccumulator builder_;
+  // Copy of the last inserted dictionary page, or null if the memo table
+  // contents no longer match a dictionary page (e.g. after a fallback page
+  // was hashed into the builder)
+  std::shared_ptr<::arrow::Array> current_dictionary_;
   std::vector<std::shared_ptr<::arrow::Array>> result_chunks_;
 };
 
@@ -1430,12 +1487,22 @@ std::shared_ptr<RecordReader> MakeByteArrayRecordReader(const ColumnDescriptor*
                                                         arrow::MemoryPool* pool,
                                                         bool read_dictionary) {
   if (read_dictionary) {
-    return std::make_shared<ByteArrayDictionaryRecordReader>(descr, pool);
+    return std::make_shared<DictionaryRecordReaderImpl<ByteArrayType>>(descr, pool);
   } else {
     return std::make_shared<ByteArrayChunkedRecordReader>(descr, pool);
   }
 }
 
+template <typename DType, typename DenseReaderType = TypedRecordReader<DType>>
+std::shared_ptr<RecordReader> MakeDictionaryCapableRecordReader(
+    const ColumnDescriptor* descr, arrow::MemoryPool* pool, bool read_dictionary) {
+  if (read_dictionary) {
+    return std::make_shared<DictionaryRecordReaderImpl<DType>>(descr, pool);
+  } else {
+    return std::make_shared<DenseReaderType>(descr, pool);
+  }
+}
+
 std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
                                                  MemoryPool* pool,
                                                  const bool read_dictionary) {
@@ -1443,19 +1510,20 @@ std::shared_ptr<RecordReader> RecordReader::Make(const ColumnDescriptor* descr,
     case Type::BOOLEAN:
       return std::make_shared<TypedRecordReader<BooleanType>>(descr, pool);
     case Type::INT32:
-      return std::make_shared<TypedRecordReader<Int32Type>>(descr, pool);
+      return MakeDictionaryCapableRecordReader<Int32Type>(descr, pool, read_dictionary);
     case Type::INT64:
-      return std::make_shared<TypedRecordReader<Int64Type>>(descr, pool);
+      return MakeDictionaryCapableRecordReader<Int64Type>(descr, pool, read_dictionary);
     case Type::INT96:
       return std::make_shared<TypedRecordReader<Int96Type>>(descr, pool);
     case Type::FLOAT:
-      return std::make_shared<TypedRecordReader<FloatType>>(descr, pool);
+      return MakeDictionaryCapableRecordReader<FloatType>(descr, pool, read_dictionary);
     case Type::DOUBLE:
-      return std::make_shared<TypedRecordReader<DoubleType>>(descr, pool);
+      return MakeDictionaryCapableRecordReader<DoubleType>(descr, pool, read_dictionary);
     case Type::BYTE_ARRAY:
       return MakeByteArrayRecordReader(descr, pool, read_dictionary);
     case Type::FIXED_LEN_BYTE_ARRAY:
-      return std::make_shared<FLBARecordReader>(descr, pool);
+      return MakeDictionaryCapableRecordReader<FLBAType, FLBARecordReader>(
+          descr, pool, read_dictionary);
     default: {
       // PARQUET-1481: This can occur if the file is corrupt
       std::stringstream ss;
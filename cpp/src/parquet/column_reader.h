@@ -305,7 +305,8 @@ class BinaryRecordReader : virtual public RecordReader {
 };
 
 /// \brief Read records directly to dictionary-encoded Arrow form (int32
-/// indices). Only valid for BYTE_ARRAY columns
+/// indices). Valid for INT32, INT64, FLOAT, DOUBLE, BYTE_ARRAY and
+/// FIXED_LEN_BYTE_ARRAY columns
 class DictionaryRecordReader : virtual public RecordReader {
  public:
   virtual std::shared_ptr<::arrow::ChunkedArray> GetResult() = 0;
@@ -373,6 +374,61 @@ static inline bool HasSpacedValues(const ColumnDescriptor* descr) {
   }
 }
 
+/// \brief Return the definition level of the nearest repeated node on the path
+/// from the column's leaf (inclusive) to the schema root, or 0 if there is none
+///
+/// Definition levels below this value do not have a slot in the leaf values
+/// because they describe a null or empty ancestor list.
+static inline int16_t RepeatedAncestorDefLevel(const ColumnDescriptor* descr) {
+  int16_t def_level = descr->max_definition_level();
+  const schema::Node* node = descr->schema_node().get();
+  // The root node does not contribute any levels
+  while (node != nullptr && node->parent() != nullptr) {
+    if (node->is_repeated()) {
+      return def_level;
+    }
+    if (node->is_optional()) {
+      --def_level;
+    }
+    node = node->parent();
+  }
+  return 0;
+}
+
+/// \brief Build the validity bitmap of the leaf values from definition levels
+///
+/// Each level that is at least repeated_ancestor_def_level (see
+/// RepeatedAncestorDefLevel) occupies one slot in the leaf values, which is
+/// valid only if the level equals max_definition_level. Unlike
+/// DefinitionLevelsToBitmap this also handles optional structs nested inside
+/// lists, whose nulls must be represented in the leaf values.
+static inline void DefinitionLevelsToSlotBitmap(
+    const int16_t* def_levels, int64_t num_def_levels, const int16_t max_definition_level,
+    const int16_t repeated_ancestor_def_level, int64_t* values_read, int64_t* null_count,
+    uint8_t* valid_bits, int64_t valid_bits_offset) {
+  // We assume here that valid_bits is large enough to accommodate the
+  // additional definition levels and the ones that have already been written
+  ::arrow::internal::BitmapWriter valid_bits_writer(valid_bits, valid_bits_offset,
+                                                    num_def_levels);
+  for (int64_t i = 0; i < num_def_levels; ++i) {
+    const int16_t level = def_levels[i];
+    if (level < repeated_ancestor_def_level) {
+      continue;
+    }
+    if (level == max_definition_level) {
+      valid_bits_writer.Set();
+    } else if (level < max_definition_level) {
+      valid_bits_writer.Clear();
+      *null_count += 1;
+    } else {
+      throw ParquetException("definition level exceeds maximum");
+    }
+    valid_bits_writer.Next();
+  }
+  valid_bits_writer.Finish();
+  *values_read = valid_bits_writer.position();
+}
+
 }  // namespace internal
 
 using BoolReader = TypedColumnReader<BooleanType>;
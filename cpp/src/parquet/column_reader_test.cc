@@ -433,5 +433,46 @@ TEST(TestColumnReader, DefinitionLevelsToBitmapPowerOfTwo) {
   ASSERT_EQ(0, null_count);
 }
 
+TEST(TestColumnReader, DefinitionLevelsToSlotBitmap) {
+  // list<optional struct<a: optional int32>> with the rows null, [],
+  // [null, {"a": 1}, {"a": null}], [{"a": 2}]: null and empty lists have no
+  // slot, null structs have a null slot
+  std::vector<int16_t> def_levels = {0, 1, 2, 4, 3, 4};
+  std::vector<uint8_t> valid_bits(1, 0);
+
+  const int16_t max_def_level = 4;
+  const int16_t repeated_ancestor_def_level = 2;
+
+  int64_t values_read = -1;
+  int64_t null_count = 0;
+  internal::DefinitionLevelsToSlotBitmap(def_levels.data(), 6, max_def_level,
+                                         repeated_ancestor_def_level, &values_read,
+                                         &null_count, valid_bits.data(),
+                                         0 /* valid_bits_offset */);
+  ASSERT_EQ(4, values_read);
+  ASSERT_EQ(2, null_count);
+  ASSERT_EQ(0x0A, valid_bits[0]);
+
+  // Append the slots of the last row again, after the existing ones
+  values_read = -1;
+  null_count = 0;
+  internal::DefinitionLevelsToSlotBitmap(def_levels.data() + 5, 1, max_def_level,
+                                         repeated_ancestor_def_level, &values_read,
+                                         &null_count, valid_bits.data(),
+                                         4 /* valid_bits_offset */);
+  ASSERT_EQ(1, values_read);
+  ASSERT_EQ(0, null_count);
+  ASSERT_EQ(0x1A, valid_bits[0]);
+
+  // Only empty lists: no slots
+  std::vector<int16_t> empty_def_levels = {1, 1};
+  internal::DefinitionLevelsToSlotBitmap(empty_def_levels.data(), 2, max_def_level,
+                                         repeated_ancestor_def_level, &values_read,
+                                         &null_count, valid_bits.data(),
+                                         5 /* valid_bits_offset */);
+  ASSERT_EQ(0, values_read);
+  ASSERT_EQ(0x1A, valid_bits[0]);
+}
+
 }  // namespace test
 }  // namespace parquet
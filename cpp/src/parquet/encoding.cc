@@ -1487,6 +1487,8 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
                   int64_t valid_bits_offset,
                   typename EncodingTraits<Type>::DictAccumulator* out) override;
 
+  std::shared_ptr<arrow::Array> GetDictionaryArray() override;
+
   void InsertDictionary(arrow::ArrayBuilder* builder) override;
 
   int DecodeIndicesSpaced(int num_values, int null_count, const uint8_t* valid_bits,
@@ -1515,9 +1517,7 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
       bit_reader.Next();
     }
 
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(
-        binary_builder->AppendIndices(indices_buffer, num_values, valid_bytes.data()));
+    AppendIndices(indices_buffer, num_values, valid_bytes.data(), builder);
     num_values_ -= num_values - null_count;
     return num_values - null_count;
   }
@@ -1537,13 +1537,16 @@ class DictDecoderImpl : public DecoderImpl, virtual public DictDecoder<Type> {
     if (num_values != idx_decoder_.GetBatch(indices_buffer, num_values)) {
       ParquetException::EofException();
     }
-    auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
-    PARQUET_THROW_NOT_OK(binary_builder->AppendIndices(indices_buffer, num_values));
+    AppendIndices(indices_buffer, num_values, /*valid_bytes=*/nullptr, builder);
     num_values_ -= num_values;
     return num_values;
   }
 
  protected:
+  // Append decoded indices to an EncodingTraits<Type>::DictAccumulator
+  void AppendIndices(const int32_t* indices, int64_t length, const uint8_t* valid_bytes,
+                     arrow::ArrayBuilder* builder);
+
   inline void DecodeDict(TypedDecoder<Type>* dictionary) {
     dictionary_length_ = static_cast<int32_t>(dictionary->values_left());
     PARQUET_THROW_NOT_OK(dictionary_->Resize(dictionary_length_ * sizeof(T),
@@ -1598,10 +1601,10 @@ void DictDecoderImpl<ByteArrayType>::SetDict(TypedDecoder<ByteArrayType>* dictio
   if (total_size > 0) {
     PARQUET_THROW_NOT_OK(byte_array_data_->Resize(total_size,
                                                   /*shrink_to_fit=*/false));
-    PARQUET_THROW_NOT_OK(
-        byte_array_offsets_->Resize((dictionary_length_ + 1) * sizeof(int32_t),
-                                    /*shrink_to_fit=*/false));
   }
+  PARQUET_THROW_NOT_OK(
+      byte_array_offsets_->Resize((dictionary_length_ + 1) * sizeof(int32_t),
+                                  /*shrink_to_fit=*/false));
 
   int32_t offset = 0;
   uint8_t* bytes_data = byte_array_data_->mutable_data();
@@ -1791,18 +1794,74 @@ int DictDecoderImpl<Type>::DecodeArrow(
 }
 
 template <typename Type>
-void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
-  ParquetException::NYI("InsertDictionary only implemented for BYTE_ARRAY types");
+std::shared_ptr<arrow::Array> DictDecoderImpl<Type>::GetDictionaryArray() {
+  using ArrowType = typename EncodingTraits<Type>::ArrowType;
+  using ArrayType = typename arrow::TypeTraits<ArrowType>::ArrayType;
+  return std::make_shared<ArrayType>(dictionary_length_, dictionary_);
+}
+
+template <>
+std::shared_ptr<arrow::Array> DictDecoderImpl<BooleanType>::GetDictionaryArray() {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
 }
 
 template <>
-void DictDecoderImpl<ByteArrayType>::InsertDictionary(arrow::ArrayBuilder* builder) {
-  auto binary_builder = checked_cast<arrow::BinaryDictionary32Builder*>(builder);
+std::shared_ptr<arrow::Array> DictDecoderImpl<Int96Type>::GetDictionaryArray() {
+  ParquetException::NYI("No Arrow dictionary representation for INT96");
+}
 
+template <>
+std::shared_ptr<arrow::Array> DictDecoderImpl<ByteArrayType>::GetDictionaryArray() {
   // Make an BinaryArray referencing the internal dictionary data
-  auto arr = std::make_shared<arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
-                                                  byte_array_data_);
-  PARQUET_THROW_NOT_OK(binary_builder->InsertMemoValues(*arr));
+  return std::make_shared<arrow::BinaryArray>(dictionary_length_, byte_array_offsets_,
+                                              byte_array_data_);
+}
+
+template <>
+std::shared_ptr<arrow::Array> DictDecoderImpl<FLBAType>::GetDictionaryArray() {
+  return std::make_shared<arrow::FixedSizeBinaryArray>(
+      arrow::fixed_size_binary(descr_->type_length()), dictionary_length_,
+      byte_array_data_);
+}
+
+template <typename Type>
+void DictDecoderImpl<Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->InsertMemoValues(*GetDictionaryArray()));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::InsertDictionary(arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("InsertDictionary not implemented for INT96");
+}
+
+template <typename Type>
+void DictDecoderImpl<Type>::AppendIndices(const int32_t* indices, int64_t length,
+                                          const uint8_t* valid_bytes,
+                                          arrow::ArrayBuilder* builder) {
+  auto dict_builder =
+      checked_cast<typename EncodingTraits<Type>::DictAccumulator*>(builder);
+  PARQUET_THROW_NOT_OK(dict_builder->AppendIndices(indices, length, valid_bytes));
+}
+
+template <>
+void DictDecoderImpl<BooleanType>::AppendIndices(const int32_t* indices, int64_t length,
+                                                 const uint8_t* valid_bytes,
+                                                 arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("Dictionary encoding is not implemented for boolean values");
+}
+
+template <>
+void DictDecoderImpl<Int96Type>::AppendIndices(const int32_t* indices, int64_t length,
+                                               const uint8_t* valid_bytes,
+                                               arrow::ArrayBuilder* builder) {
+  ParquetException::NYI("DecodeIndices not implemented for INT96");
 }
 
 class DictByteArrayDecoderImpl : public DictDecoderImpl<ByteArrayType>,
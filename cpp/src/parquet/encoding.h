@@ -349,8 +349,17 @@ class DictDecoder : virtual public TypedDecoder<DType> {
  public:
   virtual void SetDict(TypedDecoder<DType>* dictionary) = 0;
 
+  /// \brief Return the decoded dictionary values as an Arrow array of the
+  /// column's physical Arrow type (int32, int64, float, double, binary or
+  /// fixed_size_binary)
+  ///
+  /// \warning The returned array references memory owned by the decoder and
+  /// is invalidated by the next call to SetDict
+  virtual std::shared_ptr<::arrow::Array> GetDictionaryArray() = 0;
+
   /// \brief Insert dictionary values into the Arrow dictionary builder's memo,
-  /// but do not append any indices
+  /// but do not append any indices. The builder must be an
+  /// EncodingTraits<DType>::DictAccumulator
   virtual void InsertDictionary(::arrow::ArrayBuilder* builder) = 0;
 
   /// \brief Decode only dictionary indices and append to dictionary
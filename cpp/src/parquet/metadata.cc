@@ -594,6 +594,32 @@ class FileMetaData::FileMetaDataImpl {
     }
   }
 
+  std::unique_ptr<FileMetaDataImpl> Subset(const std::vector<int>& row_groups) const {
+    for (int i : row_groups) {
+      if (i < 0 || i >= num_row_groups()) {
+        std::stringstream ss;
+        ss << "The file only has " << num_row_groups()
+           << " row groups, requested a subset with row group: " << i;
+        throw ParquetException(ss.str());
+      }
+    }
+
+    std::unique_ptr<FileMetaDataImpl> out(new FileMetaDataImpl());
+    out->metadata_.reset(new format::FileMetaData(*metadata_));
+    out->metadata_->row_groups.clear();
+    out->metadata_->num_rows = 0;
+    for (int i : row_groups) {
+      out->metadata_->row_groups.push_back(metadata_->row_groups[i]);
+      out->metadata_->num_rows += metadata_->row_groups[i].num_rows;
+    }
+    out->metadata_len_ = metadata_len_;
+    out->writer_version_ = writer_version_;
+    out->InitSchema();
+    out->InitColumnOrders();
+    out->InitKeyValueMetadata();
+    return out;
+  }
+
  private:
   friend FileMetaDataBuilder;
   uint32_t metadata_len_;
@@ -717,6 +743,13 @@ void FileMetaData::AppendRowGroups(const FileMetaData& other) {
   impl_->AppendRowGroups(other.impl_);
 }
 
+std::shared_ptr<FileMetaData> FileMetaData::Subset(
+    const std::vector<int>& row_groups) const {
+  std::shared_ptr<FileMetaData> out(new FileMetaData());
+  out->impl_ = impl_->Subset(row_groups);
+  return out;
+}
+
 void FileMetaData::WriteTo(::arrow::io::OutputStream* dst,
                            const std::shared_ptr<Encryptor>& encryptor) const {
   return impl_->WriteTo(dst, encryptor);
@@ -245,6 +245,10 @@ class PARQUET_EXPORT FileMetaData {
   // Merge row-group metadata from "other" FileMetaData object
   void AppendRowGroups(const FileMetaData& other);
 
+  /// \brief Return a FileMetaData holding only the given row groups, e.g. to
+  /// extract the metadata of one file from a dataset's "_metadata" summary
+  std::shared_ptr<FileMetaData> Subset(const std::vector<int>& row_groups) const;
+
  private:
   friend FileMetaDataBuilder;
 
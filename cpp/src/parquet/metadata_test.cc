@@ -202,6 +202,17 @@ TEST(Metadata, TestBuildAccess) {
   ASSERT_EQ(ParquetVersion::PARQUET_2_0, f_accessor->version());
   ASSERT_EQ(DEFAULT_CREATED_BY, f_accessor->created_by());
   ASSERT_EQ(3, f_accessor->num_schema_elements());
+
+  // Test Subset
+  auto f_subset = f_accessor->Subset({1, 3});
+  ASSERT_EQ(2, f_subset->num_row_groups());
+  ASSERT_EQ(f_accessor->RowGroup(1)->num_rows() + f_accessor->RowGroup(3)->num_rows(),
+            f_subset->num_rows());
+  ASSERT_EQ(f_accessor->RowGroup(3)->total_byte_size(),
+            f_subset->RowGroup(1)->total_byte_size());
+  ASSERT_TRUE(f_subset->schema()->Equals(*f_accessor->schema()));
+  ASSERT_EQ(4, f_accessor->num_row_groups());
+  ASSERT_THROW(f_accessor->Subset({4}), ParquetException);
 }
 
 TEST(Metadata, TestV1Version) {
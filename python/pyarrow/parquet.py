@@ -946,7 +946,8 @@ def _open_dataset_file(dataset, path, meta=None):
 _read_docstring_common = """\
 read_dictionary : list, default None
     List of names or column paths (for nested types) to read directly
-    as DictionaryArray. Only supported for BYTE_ARRAY storage. To read
+    as DictionaryArray. Supported for BYTE_ARRAY, FIXED_LEN_BYTE_ARRAY,
+    INT32, INT64, FLOAT and DOUBLE storage. To read
     a flat column as dictionary-encoded pass the column name. For
     nested types, you must pass the full column "path", which could be
     something like level1.level2.list.item. Refer to the Parquet